@@ -108,6 +108,7 @@ class GAMEPLAYDEBUGGER_API AGameplayDebuggingReplicator : public AActor
 	virtual class UNetConnection* GetNetConnection() override;
 
 	virtual bool IsNetRelevantFor(const APlayerController* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+	virtual bool IsNetRelevancySpatial() const override { return false; }
 
 	virtual void PostNetInit() override;
 	
@@ -473,6 +473,8 @@ void FProfilerSession::UpdateMetadata( const FStatMetaData& InClientStatMetaData
 
 FRawProfilerSession::FRawProfilerSession( const FString& InRawStatsFileFileath )
 : FProfilerSession( EProfilerSessionTypes::StatsFileRaw, nullptr, FGuid::NewGuid(), InRawStatsFileFileath.Replace( *FStatConstants::StatsFileRawExtension, TEXT( "" ) ) )
+, LastTargetFrame( -1 )
+, CycleCounterAdjustmentMS( 0.0 )
 , CurrentMiniViewFrame( 0 )
 {
 	OnTick = FTickerDelegate::CreateRaw( this, &FRawProfilerSession::HandleTicker );
@@ -620,9 +622,16 @@ void FRawProfilerSession::PrepareLoading()
 		return;
 	}
 
+	// Chunked data is read through the chunk table, a window of frames at a time.
+	if( Stream.Header.HasChunkedData() )
+	{
+		PrepareLoadingChunks( Filepath );
+		return;
+	}
+
 	const bool bIsFinalized = Stream.Header.IsFinalized();
 	check( bIsFinalized );
-	check( Stream.Header.Version == EStatMagicWithHeader::VERSION_5 );
+	check( Stream.Header.Version >= EStatMagicWithHeader::VERSION_5 );
 	StatsThreadStats.MarkAsLoaded();
 
 	TArray<FStatMessage> Messages;
@@ -678,40 +687,44 @@ void FRawProfilerSession::PrepareLoading()
 
 				FMemoryReader MemoryReader( DestArray, true );
 
-				FStatPacket* StatPacket = new FStatPacket();
-				Stream.ReadStatPacket( MemoryReader, *StatPacket );
+				// Chunked data may contain more than one packet.
+				while( MemoryReader.Tell() < MemoryReader.TotalSize() )
+				{
+					FStatPacket* StatPacket = new FStatPacket();
+					Stream.ReadStatPacket( MemoryReader, *StatPacket );
 				
-				const int64 FrameNum = StatPacket->Frame;
-				FStatPacketArray& Frame = CombinedHistory.FindOrAdd(FrameNum);
+					const int64 FrameNum = StatPacket->Frame;
+					FStatPacketArray& Frame = CombinedHistory.FindOrAdd(FrameNum);
 			
-				// Check if we need to combine packets from the same thread.
-				FStatPacket** CombinedPacket = Frame.Packets.FindByPredicate([&](FStatPacket* Item) -> bool
-				{
-					return Item->ThreadId == StatPacket->ThreadId;
-				});
+					// Check if we need to combine packets from the same thread.
+					FStatPacket** CombinedPacket = Frame.Packets.FindByPredicate([&](FStatPacket* Item) -> bool
+					{
+						return Item->ThreadId == StatPacket->ThreadId;
+					});
 				
-				if( CombinedPacket )
-				{
-					(*CombinedPacket)->StatMessages += StatPacket->StatMessages;
-				}
-				else
-				{
-					Frame.Packets.Add(StatPacket);
-				}
+					if( CombinedPacket )
+					{
+						(*CombinedPacket)->StatMessages += StatPacket->StatMessages;
+					}
+					else
+					{
+						Frame.Packets.Add(StatPacket);
+					}
 
-				const int64 CurrentPos = FileReader->Tell();
-				const int32 PctPos = int32(100.0f*CurrentPos/FileSize);
+					const int64 CurrentPos = FileReader->Tell();
+					const int32 PctPos = int32(100.0f*CurrentPos/FileSize);
 
-				UE_LOG( LogStats, Log, TEXT( "%3i Processing FStatPacket: Frame %5i for thread %5i with %6i messages (%.1f MB)" ), 
-					PctPos, 
-					StatPacket->Frame, 
-					StatPacket->ThreadId, 
-					StatPacket->StatMessages.Num(), 
-					StatPacket->StatMessages.GetAllocatedSize()/1024.0f/1024.0f );
+					UE_LOG( LogStats, Log, TEXT( "%3i Processing FStatPacket: Frame %5i for thread %5i with %6i messages (%.1f MB)" ), 
+						PctPos, 
+						StatPacket->Frame, 
+						StatPacket->ThreadId, 
+						StatPacket->StatMessages.Num(), 
+						StatPacket->StatMessages.GetAllocatedSize()/1024.0f/1024.0f );
 
-				const int64 PacketSize = StatPacket->StatMessages.GetAllocatedSize();
-				TotalPacketSize += PacketSize;
-				MaximumPacketSize = FMath::Max( MaximumPacketSize, PacketSize );
+					const int64 PacketSize = StatPacket->StatMessages.GetAllocatedSize();
+					TotalPacketSize += PacketSize;
+					MaximumPacketSize = FMath::Max( MaximumPacketSize, PacketSize );
+				}
 			}
 		}
 
@@ -794,8 +807,6 @@ void FRawProfilerSession::PrepareLoading()
 		{
 			SCOPE_LOG_TIME( TEXT( "Processing the raw stats" ), nullptr );
 
-			double CycleCounterAdjustmentMS = 0.0f;
-
 			// Read the raw stats messages.
 			for( int32 FrameIndex = 0; FrameIndex < Frames.Num()-1; ++FrameIndex )
 			{
@@ -837,6 +848,250 @@ void FRawProfilerSession::PrepareLoading()
 #endif // 0
 }
 
+/** Combines the raw stat packets by the frame and the thread, the combined history takes over the packets. */
+static void CombineStatPackets( FStatPacketArray& StatPackets, TMap<int64, FStatPacketArray>& out_CombinedHistory )
+{
+	for( FStatPacket* StatPacket : StatPackets.Packets )
+	{
+		FStatPacketArray& Frame = out_CombinedHistory.FindOrAdd( StatPacket->Frame );
+
+		// Check if we need to combine packets from the same thread.
+		FStatPacket** CombinedPacket = Frame.Packets.FindByPredicate([&](FStatPacket* Item) -> bool
+		{
+			return Item->ThreadId == StatPacket->ThreadId;
+		});
+
+		if( CombinedPacket )
+		{
+			(*CombinedPacket)->StatMessages += StatPacket->StatMessages;
+			delete StatPacket;
+		}
+		else
+		{
+			Frame.Packets.Add( StatPacket );
+		}
+	}
+	StatPackets.RemovePtrsButNoData();
+}
+
+enum
+{
+	/** Number of frames read at once, only the stat packets of these frames are kept in memory. */
+	NUM_FRAMES_PER_WINDOW = 64,
+
+	/** Number of profiler frames whose stack nodes are kept in memory, frames in view are kept even if there are more. */
+	MAX_PAGED_IN_FRAMES = 1024,
+};
+
+void FRawProfilerSession::PrepareLoadingChunks( const FString& Filepath )
+{
+	if( !ReadFile.Open( Filepath ) )
+	{
+		return;
+	}
+
+	const int64 FirstFrame = ReadFile.GetFirstFrame();
+	const int64 LastFrame = ReadFile.GetLastFrame();
+	if( !ReadFile.GetHeader().bRawStatsFile || FirstFrame < 0 )
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not open, no raw stats data: %s" ), *Filepath );
+		ReadFile.Close();
+		return;
+	}
+	LastTargetFrame = LastFrame;
+
+	StatsThreadStats.MarkAsLoaded();
+
+	// Read metadata.
+	TArray<FStatMessage> MetadataMessages = ReadFile.GetMetadataMessages();
+	StatsThreadStats.ProcessMetaDataOnly( MetadataMessages );
+
+	// Update profiler's metadata.
+	StatMetaData->UpdateFromStatsState( StatsThreadStats );
+	const uint32 GameThreadID = GetMetaData()->GetGameThreadID();
+
+	// Find the seconds per cycle in the middle of the capture, like for the captures read at once.
+	double SecondsPerCycle = 0.0;
+	{
+		const int64 MiddleFrame = (FirstFrame + LastFrame) / 2;
+		FStatPacketArray StatPackets;
+		TMap<int64, FStatPacketArray> CombinedHistory;
+		ReadFile.ReadStatPackets( MiddleFrame, FMath::Min<int64>( MiddleFrame + NUM_FRAMES_PER_WINDOW - 1, LastFrame ), StatPackets );
+		CombineStatPackets( StatPackets, CombinedHistory );
+
+		TArray<int64> Frames;
+		CombinedHistory.GenerateKeyArray( Frames );
+		Frames.Sort();
+		for( int32 FrameIndex = 0; FrameIndex < Frames.Num() && SecondsPerCycle <= 0.0; ++FrameIndex )
+		{
+			SecondsPerCycle = GetSecondsPerCycle( CombinedHistory.FindChecked( Frames[FrameIndex] ) );
+		}
+	}
+
+	if( SecondsPerCycle <= 0.0 )
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not open, no STAT_SecondsPerCycle: %s" ), *Filepath );
+		ReadFile.Close();
+		return;
+	}
+	StatMetaData->SecondsPerCycle = SecondsPerCycle;
+
+	// Prepare and process the profiler frames, reading the raw stats a window of frames at a time.
+	// !!CAUTION!! Frame number in the raw stats is time based, chunks with packets from the background threads may span
+	// many frames, they are read for every window they overlap and only the packets of the window are kept.
+	// The stack nodes are only kept for the first window, the other frames are paged in when the thread view needs them.
+	{
+		SCOPE_LOG_TIME( TEXT( "Processing the raw stats" ), nullptr );
+
+		double ElapsedTimeMS = 0;
+		int32 FrameIndex = 0;
+
+		for( int64 WindowFirstFrame = FirstFrame; WindowFirstFrame <= LastFrame; WindowFirstFrame += NUM_FRAMES_PER_WINDOW )
+		{
+			const int64 WindowLastFrame = FMath::Min<int64>( WindowFirstFrame + NUM_FRAMES_PER_WINDOW - 1, LastFrame );
+			UE_LOG( LogStats, Log, TEXT( "Processing raw stats frames: %lld-%lld/%lld" ), WindowFirstFrame, WindowLastFrame, LastFrame );
+
+			FStatPacketArray StatPackets;
+			TMap<int64, FStatPacketArray> CombinedHistory;
+			ReadFile.ReadStatPackets( WindowFirstFrame, WindowLastFrame, StatPackets );
+			CombineStatPackets( StatPackets, CombinedHistory );
+
+			TArray<int64> Frames;
+			CombinedHistory.GenerateKeyArray( Frames );
+			Frames.Sort();
+
+			for( const int64 TargetFrame : Frames )
+			{
+				const FStatPacketArray& Frame = CombinedHistory.FindChecked( TargetFrame );
+
+				// Skip all frames without the game thread messages.
+				const double GameThreadTimeMS = GetMetaData()->ConvertCyclesToMS( GetFastThreadFrameTimeInternal(Frame,EThreadType::Game) );
+				if( GameThreadTimeMS == 0.0f )
+				{
+					continue;
+				}
+
+				const double RenderThreadTimeMS = GetMetaData()->ConvertCyclesToMS( GetFastThreadFrameTimeInternal(Frame,EThreadType::Renderer) );
+
+				// Update mini-view, convert from cycles to ms.
+				TMap<uint32, float> ThreadTimesMS;
+				ThreadTimesMS.Add( GameThreadID, GameThreadTimeMS );
+				ThreadTimesMS.Add( GetMetaData()->GetRenderThreadID()[0], RenderThreadTimeMS );
+
+				// Pass the reference to the stats' metadata.
+				OnAddThreadTime.ExecuteIfBound( FrameIndex, ThreadTimesMS, StatMetaData );
+
+				// Create a new profiler frame and add it to the stream.
+				ElapsedTimeMS += GameThreadTimeMS;
+				FProfilerFrame* ProfilerFrame = new FProfilerFrame( TargetFrame, GameThreadTimeMS, ElapsedTimeMS );
+				ProfilerFrame->ThreadTimesMS = ThreadTimesMS;
+				ProfilerStream.AddProfilerFrame( TargetFrame, ProfilerFrame );
+
+				// The last frame may be incomplete, it is not processed, like for the captures read at once.
+				if( TargetFrame != LastFrame )
+				{
+					ProcessStatPacketArray( Frame, *ProfilerFrame, FrameIndex );
+
+					// Find the first cycle counter for the game thread.
+					if( CycleCounterAdjustmentMS == 0.0f )
+					{
+						CycleCounterAdjustmentMS = ProfilerFrame->Root->CycleCounterStartTimeMS;
+					}
+
+					if( FrameIndex < NUM_FRAMES_PER_WINDOW )
+					{
+						// Update thread time and mark profiler frame as valid and ready for use.
+						ProfilerFrame->MarkAsValid();
+						PagedInFrameIndices.Add( FrameIndex );
+					}
+					else
+					{
+						// Keep the game thread times in the root node, the stack nodes are paged in later.
+						ProfilerFrame->FreeStackNodes();
+					}
+				}
+				FrameIndex++;
+			}
+		}
+
+		// Adjust all profiler frames.
+		ProfilerStream.AdjustCycleCounters( CycleCounterAdjustmentMS );
+	}
+
+	ProfilerStream.SetOnPageInFrames( FProfilerStream::FPageInFramesDelegate::CreateRaw( this, &FRawProfilerSession::PageInProfilerFrames ) );
+}
+
+void FRawProfilerSession::PageInProfilerFrames( int32 FrameStartIndex, int32 FrameEndIndex )
+{
+	// Find the target frames of the profiler frames that need to be read, the last frame is never processed.
+	TMap<int64, int32> TargetFrameToFrameIndex;
+	int64 FirstTargetFrame = MAX_int64;
+	int64 LastTargetFrameToRead = -1;
+	for( int32 FrameIndex = FrameStartIndex; FrameIndex <= FrameEndIndex; ++FrameIndex )
+	{
+		const FProfilerFrame* ProfilerFrame = ProfilerStream.GetProfilerFrameNoPageIn( FrameIndex );
+		if( !ProfilerFrame->IsValid() && ProfilerFrame->TargetFrame != LastTargetFrame )
+		{
+			TargetFrameToFrameIndex.Add( ProfilerFrame->TargetFrame, FrameIndex );
+			FirstTargetFrame = FMath::Min( FirstTargetFrame, ProfilerFrame->TargetFrame );
+			LastTargetFrameToRead = FMath::Max( LastTargetFrameToRead, ProfilerFrame->TargetFrame );
+		}
+	}
+
+	if( TargetFrameToFrameIndex.Num() == 0 )
+	{
+		return;
+	}
+
+	FStatPacketArray StatPackets;
+	TMap<int64, FStatPacketArray> CombinedHistory;
+	if( !ReadFile.ReadStatPackets( FirstTargetFrame, LastTargetFrameToRead, StatPackets ) )
+	{
+		UE_LOG( LogStats, Warning, TEXT( "Could not read raw stats frames: %lld-%lld" ), FirstTargetFrame, LastTargetFrameToRead );
+	}
+	CombineStatPackets( StatPackets, CombinedHistory );
+
+	for( const auto& It : TargetFrameToFrameIndex )
+	{
+		const FStatPacketArray* Frame = CombinedHistory.Find( It.Key );
+		if( Frame )
+		{
+			FProfilerFrame* ProfilerFrame = ProfilerStream.GetProfilerFrameNoPageIn( It.Value );
+			ProcessStatPacketArray( *Frame, *ProfilerFrame, It.Value, false );
+			ProfilerFrame->Root->AdjustCycleCounters( CycleCounterAdjustmentMS );
+			ProfilerFrame->LastAccessTime = FPlatformTime::Seconds();
+			ProfilerFrame->MarkAsValid();
+			PagedInFrameIndices.Add( It.Value );
+		}
+	}
+
+	// Page out the least recently used frames, but never the frames that have been requested.
+	if( PagedInFrameIndices.Num() > MAX_PAGED_IN_FRAMES )
+	{
+		PagedInFrameIndices.Sort( [&]( int32 A, int32 B )
+		{
+			return ProfilerStream.GetProfilerFrameNoPageIn( A )->LastAccessTime < ProfilerStream.GetProfilerFrameNoPageIn( B )->LastAccessTime;
+		} );
+
+		int32 NumToPageOut = PagedInFrameIndices.Num() - MAX_PAGED_IN_FRAMES;
+		for( int32 Index = 0; Index < PagedInFrameIndices.Num() && NumToPageOut > 0; )
+		{
+			const int32 FrameIndex = PagedInFrameIndices[Index];
+			if( FrameIndex >= FrameStartIndex && FrameIndex <= FrameEndIndex )
+			{
+				++Index;
+				continue;
+			}
+
+			FProfilerFrame* ProfilerFrame = ProfilerStream.GetProfilerFrameNoPageIn( FrameIndex );
+			ProfilerFrame->MarkAsInvalid();
+			ProfilerFrame->FreeStackNodes();
+			PagedInFrameIndices.RemoveAt( Index, 1, false );
+			--NumToPageOut;
+		}
+	}
+}
+
 
 void FProfilerStatMetaData::Update( const FStatMetaData& ClientStatMetaData )
 {
@@ -994,7 +1249,7 @@ void FProfilerStatMetaData::UpdateFromStatsState( const FStatsThreadState& Stats
 	}
 }
 
-void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPacketArray, FProfilerFrame& out_ProfilerFrame, int32 FrameIndex )
+void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPacketArray, FProfilerFrame& out_ProfilerFrame, int32 FrameIndex, bool bAddSamples /*= true*/ )
 {
 	// @TODO yrx 2014-03-24 Standardize thread names and id
 	// @TODO yrx 2014-04-22 Remove all references to the data provider, event graph etc once data graph can visualize.
@@ -1007,7 +1262,7 @@ void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPa
 	FProfilerSampleArray& MutableCollection = const_cast<FProfilerSampleArray&>(DataProvider->GetCollection());
 
 	// Add a root sample for this frame.
-	const uint32 FrameRootSampleIndex = DataProvider->AddHierarchicalSample( 0, MetaData->GetStatByID( 1 ).OwningGroup().ID(), 1, 0.0f, 0.0f, 1 );
+	const uint32 FrameRootSampleIndex = bAddSamples ? DataProvider->AddHierarchicalSample( 0, MetaData->GetStatByID( 1 ).OwningGroup().ID(), 1, 0.0f, 0.0f, 1 ) : FProfilerSample::InvalidIndex;
 
 	// Iterate through all stats packets and raw stats messages.
 	FName GameThreadFName = NAME_None;
@@ -1043,7 +1298,7 @@ void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPa
 			ThreadMessage.Clear();
 
 			// Add a thread sample.
-			const uint32 ThreadRootSampleIndex = DataProvider->AddHierarchicalSample
+			const uint32 ThreadRootSampleIndex = !bAddSamples ? FProfilerSample::InvalidIndex : DataProvider->AddHierarchicalSample
 			(
 				NewThreadID,
 				MetaData->GetStatByID( NewThreadID ).OwningGroup().ID(),
@@ -1089,7 +1344,7 @@ void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPa
 					Current->Children.Add( ChildNode );
 
 					// Add a child sample.
-					const uint32 SampleIndex = DataProvider->AddHierarchicalSample
+					const uint32 SampleIndex = !bAddSamples ? FProfilerSample::InvalidIndex : DataProvider->AddHierarchicalSample
 					(
 						NewThreadID,
 						MetaData->GetStatByFName( ShortName ).OwningGroup().ID(), // GroupID
@@ -1130,7 +1385,10 @@ void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPa
 					FProfilerStackNode* ChildNode = Current;
 
 					// Update the child sample's DurationMS.
-					MutableCollection[ChildNode->SampleIndex].SetDurationMS( MetaData->ConvertCyclesToMS( Delta ) );
+					if( bAddSamples )
+					{
+						MutableCollection[ChildNode->SampleIndex].SetDurationMS( MetaData->ConvertCyclesToMS( Delta ) );
+					}
 
 					verify( Current == Stack.Pop() );
 					Current = Stack.Last();				
@@ -1152,8 +1410,11 @@ void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPa
 			ThreadNode.CycleCounterStartTimeMS = MetaData->ConvertCyclesToMS( ThreadNode.CyclesStart );
 			ThreadNode.CycleCounterEndTimeMS = MetaData->ConvertCyclesToMS( ThreadNode.CyclesEnd );
 
-			FProfilerSample& ProfilerSample = MutableCollection[ThreadNode.SampleIndex];
-			ProfilerSample.SetStartAndEndMS( MetaData->ConvertCyclesToMS( ThreadNode.CyclesStart ), MetaData->ConvertCyclesToMS( ThreadNode.CyclesEnd ) );
+			if( bAddSamples )
+			{
+				FProfilerSample& ProfilerSample = MutableCollection[ThreadNode.SampleIndex];
+				ProfilerSample.SetStartAndEndMS( MetaData->ConvertCyclesToMS( ThreadNode.CyclesStart ), MetaData->ConvertCyclesToMS( ThreadNode.CyclesEnd ) );
+			}
 		}
 	}
 
@@ -1162,17 +1423,21 @@ void FRawProfilerSession::ProcessStatPacketArray( const FStatPacketArray& StatPa
 	const FProfilerStackNode& GameThreadNode = *ThreadNodes.FindChecked( GameThreadFName );
 	const double GameThreadStartMS = MetaData->ConvertCyclesToMS( GameThreadNode.CyclesStart );
 	const double GameThreadEndMS = MetaData->ConvertCyclesToMS( GameThreadNode.CyclesEnd );
-	MutableCollection[FrameRootSampleIndex].SetStartAndEndMS( GameThreadStartMS, GameThreadEndMS );
+
+	if( bAddSamples )
+	{
+		MutableCollection[FrameRootSampleIndex].SetStartAndEndMS( GameThreadStartMS, GameThreadEndMS );
 	
-	// Advance frame
-	const uint32 LastFrameIndex = DataProvider->GetNumFrames();
-	DataProvider->AdvanceFrame( GameThreadEndMS - GameThreadStartMS );
+		// Advance frame
+		const uint32 LastFrameIndex = DataProvider->GetNumFrames();
+		DataProvider->AdvanceFrame( GameThreadEndMS - GameThreadStartMS );
  
-	// Update aggregated stats
-	UpdateAggregatedStats( LastFrameIndex );
+		// Update aggregated stats
+		UpdateAggregatedStats( LastFrameIndex );
  
-	// Update aggregated events.
-	UpdateAggregatedEventGraphData( LastFrameIndex );
+		// Update aggregated events.
+		UpdateAggregatedEventGraphData( LastFrameIndex );
+	}
 
 	// RootNode is the same as the game thread node.
 	out_ProfilerFrame.Root->CycleCounterStartTimeMS = GameThreadStartMS;
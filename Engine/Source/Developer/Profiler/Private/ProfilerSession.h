@@ -1236,6 +1236,18 @@ class FRawProfilerSession : public FProfilerSession
 	FStatsThreadState StatsThreadStats;
 	FStatsReadStream Stream;
 
+	/** Stats file with the chunked data, kept open to page in the profiler frames. */
+	FStatsReadFile ReadFile;
+
+	/** Last frame in the stats file, this frame may be incomplete and is never processed. */
+	int64 LastTargetFrame;
+
+	/** Adjustment applied to the cycle counters of all profiler frames, also applied to the paged in frames. */
+	double CycleCounterAdjustmentMS;
+
+	/** Indices of the profiler frames whose stack nodes are in the memory. */
+	TArray<int32> PagedInFrameIndices;
+
 	/** Index of the last processed data for the mini-view. */
 	int32 CurrentMiniViewFrame;
 
@@ -1260,6 +1272,18 @@ public:
 	/** Starts a process of loading the raw stats file. */
 	void PrepareLoading();
 
+protected:
+	/**
+	 *	Loads the raw stats file with the chunked data, reading only a window of frames at a time.
+	 *	Only the frame times and the data provider's samples are kept, the stack nodes are paged in as the thread view scrolls.
+	 */
+	void PrepareLoadingChunks( const FString& Filepath );
+
+	/** Reads and processes the stack nodes of the profiler frames in the specified range of frame indices, both inclusive. */
+	void PageInProfilerFrames( int32 FrameStartIndex, int32 FrameEndIndex );
+
+public:
+
 	const FProfilerStream& GetStream() const
 	{
 		return ProfilerStream;
@@ -1268,6 +1292,8 @@ public:
 	/**
 	 *	Process all stats packets and convert them to data accessible by the profiler.
 	 *	Temporary version, will be optimized later.
+	 *
+	 *	@param bAddSamples - if false only the stack nodes are created, used when the profiler frame is paged in again
 	 */
-	void ProcessStatPacketArray( const FStatPacketArray& PacketArray, FProfilerFrame& out_ProfilerFrame, int32 FrameIndex );
+	void ProcessStatPacketArray( const FStatPacketArray& PacketArray, FProfilerFrame& out_ProfilerFrame, int32 FrameIndex, bool bAddSamples = true );
 };
\ No newline at end of file
@@ -25,6 +25,9 @@ void FProfilerUIStream::GenerateUIStream( const FProfilerStream& ProfilerStream,
 		const int32 NumFrames = ProfilerStream.GetNumFrames();
 		const int32 MaxFrameIndex = FMath::Min( FramesIndices.Y + 1, NumFrames - 1 );
 
+		// Read all frames in view at once, instead of a page for each frame.
+		ProfilerStream.PageInFrames( FramesIndices.X, MaxFrameIndex - 1 );
+
 		for( int32 FrameIndex = FramesIndices.X; FrameIndex < MaxFrameIndex; ++FrameIndex )
 		{
 			const FProfilerFrame* ProfilerFrame = ProfilerStream.GetProfilerFrame( FrameIndex );
@@ -195,6 +195,19 @@ public:
 		return ThreadTimesMS.GetAllocatedSize() + Root ? Root->GetAllocatedSize() : 0;
 	}
 
+	/**
+	 *	Frees the stack nodes of this profiler frame, keeps the root node and the thread times.
+	 *	Used by the profiler stream to page out the frames which are not in view.
+	 */
+	void FreeStackNodes()
+	{
+		for( const auto& Child : Root->Children )
+		{
+			delete Child;
+		}
+		Root->Children.Empty();
+	}
+
 	/** Frees most of the memory allocated by this profiler frame. */
 	void FreeMemory()
 	{
@@ -228,6 +241,28 @@ protected:
 	/** Critical section. */
 	mutable FCriticalSection CriticalSection;
 
+public:
+	/**
+	 *	Delegate used to page in the stack nodes of the profiler frames in the specified range of frame indices, both inclusive.
+	 *	Executed when the requested profiler frames have not been marked as valid.
+	 */
+	DECLARE_DELEGATE_TwoParams( FPageInFramesDelegate, int32 /*FrameStartIndex*/, int32 /*FrameEndIndex*/ );
+
+	/** Sets the delegate used to page in the profiler frames, only bound if the frames are loaded on demand. */
+	void SetOnPageInFrames( const FPageInFramesDelegate& InPageInFramesDelegate )
+	{
+		PageInFramesDelegate = InPageInFramesDelegate;
+	}
+
+protected:
+	/** Pages in the profiler frames that are not in the memory. */
+	FPageInFramesDelegate PageInFramesDelegate;
+
+	enum
+	{
+		/** Number of frames paged in at once when a single profiler frame is requested. */
+		NUM_FRAMES_PER_PAGE = 64,
+	};
 
 public:
 	void AddProfilerFrame( int64 TargetFrame, FProfilerFrame* ProfilerFrame )
@@ -245,14 +280,55 @@ public:
 	}
 
 	/**
-	* @return a pointer to the profiler frame, once obtained can be used until end of the profiler session.
+	* @return a pointer to the profiler frame, pages in the frame if needed.
+	* The frame itself can be used until end of the profiler session, its stack nodes only until the next page in.
 	*/
 	FProfilerFrame* GetProfilerFrame( int32 FrameIndex ) const
+	{
+		FProfilerFrame* ProfilerFrame = nullptr;
+		int32 NumFrames = 0;
+		{
+			FScopeLock Lock( &CriticalSection );
+			ProfilerFrame = Frames[FrameIndex];
+			NumFrames = Frames.Num();
+		}
+
+		if( !ProfilerFrame->IsValid() )
+		{
+			PageInFramesDelegate.ExecuteIfBound( FrameIndex, FMath::Min<int32>( FrameIndex + NUM_FRAMES_PER_PAGE, NumFrames ) - 1 );
+		}
+
+		ProfilerFrame->LastAccessTime = FPlatformTime::Seconds();
+		return ProfilerFrame;
+	}
+
+	/** @return a pointer to the profiler frame, its stack nodes may not be in the memory, used by the code that pages in the frames. */
+	FProfilerFrame* GetProfilerFrameNoPageIn( int32 FrameIndex ) const
 	{
 		FScopeLock Lock( &CriticalSection );
 		return Frames[FrameIndex];
 	}
 
+	/** Pages in all profiler frames in the specified range of frame indices, both inclusive, that are not in the memory. */
+	void PageInFrames( int32 FrameStartIndex, int32 FrameEndIndex ) const
+	{
+		bool bNeedsPageIn = false;
+		{
+			FScopeLock Lock( &CriticalSection );
+			FrameStartIndex = FMath::Max( FrameStartIndex, 0 );
+			FrameEndIndex = FMath::Min( FrameEndIndex, Frames.Num() - 1 );
+			for( int32 FrameIndex = FrameStartIndex; FrameIndex <= FrameEndIndex && !bNeedsPageIn; ++FrameIndex )
+			{
+				bNeedsPageIn = !Frames[FrameIndex]->IsValid();
+			}
+		}
+
+		if( bNeedsPageIn )
+		{
+			PageInFramesDelegate.ExecuteIfBound( FrameStartIndex, FrameEndIndex );
+		}
+	}
+
 	/**
 	 * @return frames indices, where X is the start frame index, Y is the end frame index
 	 */
@@ -279,26 +279,50 @@ void FProfilerClientManager::LoadCapture( const FString& DataFilepath, const FGu
 		return;
 	}
 
-	const bool bIsFinalized = LoadConnection->Stream.Header.IsFinalized();
-	if( bIsFinalized )
+#if PROFILER_THREADED_LOAD
+	// Chunked data is read through the chunk table, a window of frames at a time, this also works for the files that have not been finalized.
+	FStatsReadFile* ReadFile = nullptr;
+	if( LoadConnection->Stream.Header.HasChunkedData() )
 	{
+		delete FileReader;
+		FileReader = nullptr;
+
+		ReadFile = new FStatsReadFile();
+		if( !ReadFile->Open( DataFilepath ) )
+		{
+			UE_LOG( LogProfile, Error, TEXT( "Could not open, no chunk table: %s" ), *DataFilepath );
+			delete ReadFile;
+			return;
+		}
+
 		// Read metadata.
-		TArray<FStatMessage> MetadataMessages;
-		LoadConnection->Stream.ReadFNamesAndMetadataMessages( *FileReader, MetadataMessages );
+		TArray<FStatMessage> MetadataMessages = ReadFile->GetMetadataMessages();
 		LoadConnection->CurrentThreadState.ProcessMetaDataOnly( MetadataMessages );
-
-		// Read frames offsets.
-		LoadConnection->Stream.ReadFramesOffsets( *FileReader );
-		FileReader->Seek( LoadConnection->Stream.FramesInfo[0].FrameFileOffset );
 	}
-
-	if( LoadConnection->Stream.Header.HasCompressedData() )
+	else
+#endif // PROFILER_THREADED_LOAD
 	{
-		UE_CLOG( !bIsFinalized, LogProfile, Fatal, TEXT( "Compressed stats file has to be finalized" ) );
+		const bool bIsFinalized = LoadConnection->Stream.Header.IsFinalized();
+		if( bIsFinalized )
+		{
+			// Read metadata.
+			TArray<FStatMessage> MetadataMessages;
+			LoadConnection->Stream.ReadFNamesAndMetadataMessages( *FileReader, MetadataMessages );
+			LoadConnection->CurrentThreadState.ProcessMetaDataOnly( MetadataMessages );
+
+			// Read frames offsets.
+			LoadConnection->Stream.ReadFramesOffsets( *FileReader );
+			FileReader->Seek( LoadConnection->Stream.FramesInfo[0].FrameFileOffset );
+		}
+
+		if( LoadConnection->Stream.Header.HasCompressedData() )
+		{
+			UE_CLOG( !bIsFinalized, LogProfile, Fatal, TEXT( "Compressed stats file has to be finalized" ) );
+		}
 	}
 
 #if PROFILER_THREADED_LOAD
-	LoadTask = new FAsyncTask<FAsyncReadWorker>(LoadConnection, FileReader);
+	LoadTask = ReadFile ? new FAsyncTask<FAsyncReadWorker>(LoadConnection, ReadFile) : new FAsyncTask<FAsyncReadWorker>(LoadConnection, FileReader);
 	LoadTask->StartBackgroundTask();
 #endif
 
@@ -804,6 +828,14 @@ void FProfilerClientManager::FinalizeLoading()
 void FProfilerClientManager::FAsyncReadWorker::DoWork()
 {
 #if STATS
+	if( ReadFile )
+	{
+		LoadConnection->ReadAndConvertStatChunks( *ReadFile );
+		delete ReadFile;
+		ReadFile = nullptr;
+		return;
+	}
+
 	const bool bFinalize = LoadConnection->ReadAndConvertStatMessages( *FileReader, true );
 	if( bFinalize )
 	{
@@ -1202,6 +1234,67 @@ bool FServiceConnection::ReadAndConvertStatMessages( FArchive& Reader, bool bUse
 	return false;
 }
 
+void FServiceConnection::ReadAndConvertStatChunks( FStatsReadFile& ReadFile )
+{
+	enum
+	{
+		/** Number of frames read at once, only the messages of these frames are kept in memory. */
+		NUM_FRAMES_PER_WINDOW = 64
+	};
+
+	TArray<FStatMessage> WindowMessages;
+	const int64 FirstFrame = ReadFile.GetFirstFrame();
+	const int64 LastFrame = ReadFile.GetLastFrame();
+
+	SCOPE_CYCLE_COUNTER( STAT_PC_ReadStatMessages );
+	for( int64 WindowFirstFrame = FirstFrame; FirstFrame >= 0 && WindowFirstFrame <= LastFrame; WindowFirstFrame += NUM_FRAMES_PER_WINDOW )
+	{
+		const int64 WindowLastFrame = FMath::Min<int64>( WindowFirstFrame + NUM_FRAMES_PER_WINDOW - 1, LastFrame );
+
+		// Each chunk holds the messages of one frame, so the chunks of the window are read in the frame order.
+		WindowMessages.Reset();
+		if( !ReadFile.ReadMessages( WindowFirstFrame, WindowLastFrame, WindowMessages ) )
+		{
+			UE_LOG( LogProfile, Warning, TEXT( "Could not read stats frames: %lld-%lld" ), WindowFirstFrame, WindowLastFrame );
+		}
+
+		for( const FStatMessage& Message : WindowMessages )
+		{
+			ReadMessages++;
+
+			if( Message.NameAndInfo.GetShortName() == TEXT( "Unknown FName" ) )
+			{
+				continue;
+			}
+
+			if( Message.NameAndInfo.GetField<EStatOperation>() == EStatOperation::AdvanceFrameEventGameThread && ReadMessages > 2 )
+			{
+				AddCollectedStatMessages( Message );
+
+				// create an old format data frame from the data
+				GenerateProfilerDataFrame();
+
+				{
+					// add the frame to the work list
+					FScopeLock ScopeLock( &CriticalSection );
+					DataFrames.Add( CurrentData );
+					DataLoadingProgress = (double)(WindowLastFrame - FirstFrame + 1) / (double)(LastFrame - FirstFrame + 1);
+				}
+
+				if( DataFrames.Num() > FProfilerClientManager::MaxFramesPerTick )
+				{
+					while( DataFrames.Num() )
+					{
+						FPlatformProcess::Sleep( 0.001f );
+					}
+				}
+			}
+
+			new (Messages)FStatMessage( Message );
+		}
+	}
+}
+
 void FServiceConnection::AddCollectedStatMessages( FStatMessage Message )
 {
 	SCOPE_CYCLE_COUNTER( STAT_PC_AddStatMessages );
@@ -102,6 +102,12 @@ struct FServiceConnection
 	 */
 	bool ReadAndConvertStatMessages( FArchive& Reader, bool bUseInAsync );
 
+	/**
+	 * Reads stat messages of the stats file with the chunked data, a window of frames at a time, and converts them to be usable by the profiler.
+	 * Only used in async, also works for the files that have not been finalized.
+	 */
+	void ReadAndConvertStatChunks( FStatsReadFile& ReadFile );
+
 	/** Adds all collected stat messages to the current stats thread state. */
 	void AddCollectedStatMessages( FStatMessage Message );
 
@@ -121,12 +127,28 @@ class FProfilerClientManager
 	public:
 		FServiceConnection* LoadConnection;
 		FArchive* FileReader;
+#if STATS
+		/** Stats file with the chunked data, read instead of the FileReader if set. */
+		FStatsReadFile* ReadFile;
+#endif
 
 		/** Constructor */
 		FAsyncReadWorker(FServiceConnection* InConnection, FArchive* InReader)
 			: LoadConnection(InConnection)
 			, FileReader(InReader)
+#if STATS
+			, ReadFile(nullptr)
+#endif
+		{}
+
+#if STATS
+		/** Constructor for the stats files with the chunked data. */
+		FAsyncReadWorker(FServiceConnection* InConnection, FStatsReadFile* InReadFile)
+			: LoadConnection(InConnection)
+			, FileReader(nullptr)
+			, ReadFile(InReadFile)
 		{}
+#endif
 
 		void DoWork();
 
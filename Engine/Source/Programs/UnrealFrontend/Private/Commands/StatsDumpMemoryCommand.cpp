@@ -100,39 +100,43 @@ void FStatsMemoryDumpCommand::InternalRun()
 
 				FMemoryReader MemoryReader( DestArray, true );
 
-				FStatPacket* StatPacket = new FStatPacket();
-				Stream.ReadStatPacket( MemoryReader, *StatPacket );
+				// Chunked data may contain more than one packet.
+				while( MemoryReader.Tell() < MemoryReader.TotalSize() )
+				{
+					FStatPacket* StatPacket = new FStatPacket();
+					Stream.ReadStatPacket( MemoryReader, *StatPacket );
 
-				const int64 FrameNum = StatPacket->Frame;
-				FStatPacketArray& Frame = CombinedHistory.FindOrAdd( FrameNum );
+					const int64 FrameNum = StatPacket->Frame;
+					FStatPacketArray& Frame = CombinedHistory.FindOrAdd( FrameNum );
 
-				// Check if we need to combine packets from the same thread.
-				FStatPacket** CombinedPacket = Frame.Packets.FindByPredicate( [&]( FStatPacket* Item ) -> bool
-				{
-					return Item->ThreadId == StatPacket->ThreadId;
-				} );
+					// Check if we need to combine packets from the same thread.
+					FStatPacket** CombinedPacket = Frame.Packets.FindByPredicate( [&]( FStatPacket* Item ) -> bool
+					{
+						return Item->ThreadId == StatPacket->ThreadId;
+					} );
 
-				if( CombinedPacket )
-				{
-					(*CombinedPacket)->StatMessages += StatPacket->StatMessages;
-				}
-				else
-				{
-					Frame.Packets.Add( StatPacket );
-				}
+					if( CombinedPacket )
+					{
+						(*CombinedPacket)->StatMessages += StatPacket->StatMessages;
+					}
+					else
+					{
+						Frame.Packets.Add( StatPacket );
+					}
 
-				const double CurrentSeconds = FPlatformTime::Seconds();
-				if( CurrentSeconds > PreviousSeconds + NumSecondsBetweenLogs )
-				{
-					const int32 PctPos = int32( 100.0*FileReader->Tell() / FileSize );
-					UE_LOG( LogStats, Log, TEXT( "%3i%% %10llu (%.1f MB) read messages, last read frame %4i" ), PctPos, TotalStatMessagesNum, TotalDataSize / 1024.0f / 1024.0f, StatPacket->Frame );
-					PreviousSeconds = CurrentSeconds;
-				}
+					const double CurrentSeconds = FPlatformTime::Seconds();
+					if( CurrentSeconds > PreviousSeconds + NumSecondsBetweenLogs )
+					{
+						const int32 PctPos = int32( 100.0*FileReader->Tell() / FileSize );
+						UE_LOG( LogStats, Log, TEXT( "%3i%% %10llu (%.1f MB) read messages, last read frame %4i" ), PctPos, TotalStatMessagesNum, TotalDataSize / 1024.0f / 1024.0f, StatPacket->Frame );
+						PreviousSeconds = CurrentSeconds;
+					}
 
-				const int64 PacketSize = StatPacket->StatMessages.GetAllocatedSize();
-				TotalDataSize += PacketSize;
-				MaximumPacketSize = FMath::Max( MaximumPacketSize, PacketSize );
-				TotalStatMessagesNum += StatPacket->StatMessages.Num();
+					const int64 PacketSize = StatPacket->StatMessages.GetAllocatedSize();
+					TotalDataSize += PacketSize;
+					MaximumPacketSize = FMath::Max( MaximumPacketSize, PacketSize );
+					TotalStatMessagesNum += StatPacket->StatMessages.Num();
+				}
 			}
 		}
 
@@ -17,10 +17,13 @@ struct FPakCommandLineParameters
 	FPakCommandLineParameters()
 		: CompressionBlockSize(64*1024)
 		, FileSystemBlockSize(0)
+		, CompressionFormat(COMPRESS_Default)
 	{}
 
 	int32  CompressionBlockSize;
 	int64  FileSystemBlockSize;
+	/** Format used for files that need compression and don't specify their own */
+	ECompressionFlags CompressionFormat;
 };
 
 struct FPakEntryPair
@@ -36,11 +39,14 @@ struct FPakInputPair
 	uint64 SuggestedOrder; 
 	bool bNeedsCompression;
 	bool bNeedEncryption;
+	/** Compression format for this file, COMPRESS_None to use the format of the pak file */
+	ECompressionFlags CompressionFormat;
 
 	FPakInputPair()
 		: SuggestedOrder(MAX_uint64)
 		, bNeedsCompression(false)
 		, bNeedEncryption(false)
+		, CompressionFormat(COMPRESS_None)
 	{}
 
 	FPakInputPair(const FString& InSource, const FString& InDest)
@@ -48,6 +54,7 @@ struct FPakInputPair
 		, Dest(InDest)
 		, bNeedsCompression(false)
 		, bNeedEncryption(false)
+		, CompressionFormat(COMPRESS_None)
 	{}
 
 	FORCEINLINE bool operator==(const FPakInputPair& Other) const
@@ -367,6 +374,21 @@ void ProcessOrderFile(int32 ArgC, TCHAR* ArgV[], TMap<FString, uint64>& OrderMap
 	}
 }
 
+/**
+ * Looks up a compression format by name, e.g. LZ4.
+ *
+ * @return the format or COMPRESS_None if no codec with that name is available
+ */
+static ECompressionFlags ParseCompressionFormat(const FString& FormatName)
+{
+	ECompressionFlags Format = FCompression::GetFormatFromName(*FormatName);
+	if (Format == COMPRESS_None)
+	{
+		UE_LOG(LogPakFile, Warning, TEXT("Compression format \"%s\" is not available."), *FormatName);
+	}
+	return Format;
+}
+
 static void CommandLineParseHelper(const TCHAR* InCmdLine, TArray<FString>& Tokens, TArray<FString>& Switches)
 {
 	FString NextToken;
@@ -406,6 +428,16 @@ void ProcessCommandLine(int32 ArgC, TCHAR* ArgV[], TArray<FPakInputPair>& Entrie
 		CmdLineParameters.FileSystemBlockSize = 0;
 	}
 
+	FString CompressionFormatName;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-compressionformat="), CompressionFormatName))
+	{
+		ECompressionFlags Format = ParseCompressionFormat(CompressionFormatName);
+		if (Format != COMPRESS_None)
+		{
+			CmdLineParameters.CompressionFormat = Format;
+		}
+	}
+
 	if (FParse::Value(FCommandLine::Get(), TEXT("-create="), ResponseFile))
 	{
 		bool bCompress = false;
@@ -467,6 +499,7 @@ void ProcessCommandLine(int32 ArgC, TCHAR* ArgV[], TArray<FPakInputPair>& Entrie
 			FPakFile::MakeDirectoryFromPath(Input.Dest);
 
 			//check for compression switches
+			bool bUnknownCompressionFormat = false;
 			for (int32 Index = 0; Index < Switches.Num(); ++Index)
 			{
 				if (Switches[Index] == TEXT("compress"))
@@ -477,8 +510,20 @@ void ProcessCommandLine(int32 ArgC, TCHAR* ArgV[], TArray<FPakInputPair>& Entrie
 				{
 					Input.bNeedEncryption = true;
 				}
+				if (Switches[Index].StartsWith(TEXT("compressionformat=")))
+				{
+					Input.CompressionFormat = ParseCompressionFormat(Switches[Index].Mid(FCString::Strlen(TEXT("compressionformat="))));
+					Input.bNeedsCompression = true;
+					if (Input.CompressionFormat == COMPRESS_None)
+					{
+						UE_LOG(LogPakFile, Warning, TEXT("%s will be stored uncompressed."), *Input.Source);
+						bUnknownCompressionFormat = true;
+					}
+				}
 			}
 			Input.bNeedsCompression |= bCompress;
+			// Don't silently compress with another codec than the one asked for.
+			Input.bNeedsCompression &= !bUnknownCompressionFormat;
 			Input.bNeedEncryption |= bEncrypt;
 
 			UE_LOG(LogPakFile, Display, TEXT("Added file Source: %s Dest: %s"), *Input.Source, *Input.Dest);
@@ -535,6 +580,7 @@ void CollectFilesToAdd(TArray<FPakInputPair>& OutFilesToAdd, const TArray<FPakIn
 		const FString& Source = Input.Source;
 		bool bCompression = Input.bNeedsCompression;
 		bool bEncryption = Input.bNeedEncryption;
+		ECompressionFlags CompressionFormat = Input.CompressionFormat;
 
 
 		FString Filename = FPaths::GetCleanFilename(Source);
@@ -565,6 +611,7 @@ void CollectFilesToAdd(TArray<FPakInputPair>& OutFilesToAdd, const TArray<FPakIn
 				}
 				FileInput.bNeedsCompression = bCompression;
 				FileInput.bNeedEncryption = bEncryption;
+				FileInput.CompressionFormat = CompressionFormat;
 				if (!AddedFiles.Contains(FileInput.Source))
 				{
 					OutFilesToAdd.Add(FileInput);
@@ -576,6 +623,10 @@ void CollectFilesToAdd(TArray<FPakInputPair>& OutFilesToAdd, const TArray<FPakIn
 					OutFilesToAdd.Find(FileInput,FoundIndex);
 					OutFilesToAdd[FoundIndex].bNeedEncryption |= bEncryption;
 					OutFilesToAdd[FoundIndex].bNeedsCompression |= bCompression;
+					if (CompressionFormat != COMPRESS_None)
+					{
+						OutFilesToAdd[FoundIndex].CompressionFormat = CompressionFormat;
+					}
 				}
 			}
 		}
@@ -593,6 +644,7 @@ void CollectFilesToAdd(TArray<FPakInputPair>& OutFilesToAdd, const TArray<FPakIn
 			}
 			FileInput.bNeedEncryption = bEncryption;
 			FileInput.bNeedsCompression = bCompression;
+			FileInput.CompressionFormat = CompressionFormat;
 
 			if (AddedFiles.Contains(FileInput.Source))
 			{
@@ -600,6 +652,10 @@ void CollectFilesToAdd(TArray<FPakInputPair>& OutFilesToAdd, const TArray<FPakIn
 				OutFilesToAdd.Find(FileInput, FoundIndex);
 				OutFilesToAdd[FoundIndex].bNeedEncryption |= bEncryption;
 				OutFilesToAdd[FoundIndex].bNeedsCompression |= bCompression;
+				if (CompressionFormat != COMPRESS_None)
+				{
+					OutFilesToAdd[FoundIndex].CompressionFormat = CompressionFormat;
+				}
 			}
 			else
 			{
@@ -761,7 +817,8 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 		//check if this file requested to be compression
 		int64 OriginalFileSize = IFileManager::Get().FileSize(*FilesToAdd[FileIndex].Source);
 		int64 RealFileSize = OriginalFileSize + NewEntry.Info.GetSerializedSize(FPakInfo::PakFile_Version_Latest);
-		CompressionMethod = (FilesToAdd[FileIndex].bNeedsCompression && OriginalFileSize > 0) ? COMPRESS_Default : COMPRESS_None;
+		const ECompressionFlags FileCompressionFormat = (FilesToAdd[FileIndex].CompressionFormat != COMPRESS_None) ? FilesToAdd[FileIndex].CompressionFormat : CmdLineParameters.CompressionFormat;
+		CompressionMethod = (FilesToAdd[FileIndex].bNeedsCompression && OriginalFileSize > 0) ? FileCompressionFormat : COMPRESS_None;
 
 		if (CompressionMethod != COMPRESS_None)
 		{
@@ -814,7 +871,7 @@ bool CreatePakFile(const TCHAR* Filename, TArray<FPakInputPair>& FilesToAdd, con
 			if (FilesToAdd[FileIndex].bNeedsCompression && CompressionMethod != COMPRESS_None)
 			{
 				float PercentLess = ((float)NewEntry.Info.Size/(NewEntry.Info.UncompressedSize/100.f));
-				UE_LOG(LogPakFile, Display, TEXT("Added compressed file \"%s\", %.2f%% of original size. Compressed Size %lld bytes, Original Size %lld bytes. "), *NewEntry.Filename, PercentLess, NewEntry.Info.Size, NewEntry.Info.UncompressedSize);
+				UE_LOG(LogPakFile, Display, TEXT("Added %s compressed file \"%s\", %.2f%% of original size. Compressed Size %lld bytes, Original Size %lld bytes. "), FCompression::GetFormatName(CompressionMethod), *NewEntry.Filename, PercentLess, NewEntry.Info.Size, NewEntry.Info.UncompressedSize);
 			}
 			else
 			{
@@ -1012,6 +1069,8 @@ bool ExtractFilesFromPak(const TCHAR* InPakFilename, const TCHAR* InDestPath)
  *   -Test test if the pak file is healthy
  *   -Extract extracts pak file contents (followed by a path, i.e.: -extract D:\ExtractedPak)
  *   -Create=filename response file to create a pak file with
+ *   -CompressionFormat=name format for compressed files, e.g. ZLIB (default) or LZ4. Lines in the response file can override it
+ *    with their own -compressionformat=name switch, which also marks the file for compression.
  *   -Sign=filename use the key pair in filename to sign a pak file, or: -sign=key_hex_values_separated_with_+, i.e: -sign=0x123456789abcdef+0x1234567+0x12345abc
  *    where the first number is the private key exponend, the second one is modulus and the third one is the public key exponent.
  *   -Signed use with -extract and -test to let the code know this is a signed pak
@@ -0,0 +1,171 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ParallelFor.cpp: Data parallel loops on the task graph's worker threads.
+=============================================================================*/
+
+#include "CorePrivatePCH.h"
+#include "ParallelFor.h"
+#include "TaskGraphInterfaces.h"
+
+
+/**
+ * State of one ParallelFor, shared by the calling thread and the worker tasks. The tasks hold a reference to it because
+ * they can start after the loop has been finished by other threads, in which case they find nothing left to do.
+ */
+class FParallelForData
+{
+public:
+
+	FParallelForData(int32 InNum, int32 InNumThreads, const TFunctionRef<void(int32)>& InBody)
+		: Num(InNum)
+		, NumThreads(InNumThreads)
+		, Body(InBody)
+		, NextIndex(0)
+		, NumCompleted(0)
+		, CompletedEvent(FPlatformProcess::GetSynchEventFromPool(true))
+	{ }
+
+	~FParallelForData()
+	{
+		FPlatformProcess::ReturnSynchEventToPool(CompletedEvent);
+	}
+
+	/** Runs ranges of indices until they have all been handed out. */
+	void Process()
+	{
+		int32 Start;
+		int32 End;
+		while (ClaimRange(Start, End))
+		{
+			for (int32 Index = Start; Index < End; Index++)
+			{
+				Body(Index);
+			}
+
+			if (FPlatformAtomics::InterlockedAdd(&NumCompleted, End - Start) + (End - Start) == Num)
+			{
+				CompletedEvent->Trigger();
+			}
+		}
+	}
+
+	/** Waits until every index has been run. */
+	void Wait()
+	{
+		CompletedEvent->Wait();
+	}
+
+private:
+
+	/** Hands out the next range of indices, returns false once they have all been handed out. */
+	bool ClaimRange(int32& OutStart, int32& OutEnd)
+	{
+		while (true)
+		{
+			const int32 Start = NextIndex;
+			if (Start >= Num)
+			{
+				return false;
+			}
+
+			// Half of an even share of what is left, so the ranges get smaller as the loop runs out
+			const int32 Size = FMath::Max((Num - Start) / (NumThreads * 2), 1);
+			if (FPlatformAtomics::InterlockedCompareExchange(&NextIndex, Start + Size, Start) == Start)
+			{
+				OutStart = Start;
+				OutEnd = Start + Size;
+				return true;
+			}
+		}
+	}
+
+	/** Number of indices. */
+	const int32 Num;
+	/** Number of threads that can work on the loop, including the calling thread. */
+	const int32 NumThreads;
+	/** Only called for indices that were handed out, which means the calling thread is still waiting and Body is still valid. */
+	const TFunctionRef<void(int32)>& Body;
+	/** First index that hasn't been handed out. */
+	volatile int32 NextIndex;
+	/** Number of indices that have been run. */
+	volatile int32 NumCompleted;
+	/** Triggered once NumCompleted reaches Num. */
+	FEvent* CompletedEvent;
+};
+
+
+/**
+ * Task which helps with a ParallelFor on a worker thread.
+ */
+class FParallelForTask
+{
+public:
+
+	FParallelForTask(const TSharedRef<FParallelForData, ESPMode::ThreadSafe>& InData)
+		: Data(InData)
+	{ }
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FParallelForTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::FireAndForget;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Data->Process();
+	}
+
+private:
+
+	TSharedRef<FParallelForData, ESPMode::ThreadSafe> Data;
+};
+
+
+void ParallelForWithPreWork(int32 Num, TFunctionRef<void(int32)> Body, TFunctionRef<void()> CurrentThreadWorkToDoBeforeHelping, bool bForceSingleThread)
+{
+	const int32 NumWorkers = (bForceSingleThread || Num < 2 || !FApp::ShouldUseThreadingForPerformance() || !FTaskGraphInterface::IsRunning())
+		? 0
+		: FTaskGraphInterface::Get().GetNumWorkerThreads();
+
+	if (NumWorkers == 0)
+	{
+		CurrentThreadWorkToDoBeforeHelping();
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Body(Index);
+		}
+		return;
+	}
+
+	TSharedRef<FParallelForData, ESPMode::ThreadSafe> Data = MakeShareable(new FParallelForData(Num, NumWorkers + 1, Body));
+
+	// The calling thread takes a range too, so more than Num - 1 tasks would only find nothing left to do
+	const int32 NumTasks = FMath::Min(NumWorkers, Num - 1);
+	for (int32 TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+	{
+		TGraphTask<FParallelForTask>::CreateTask().ConstructAndDispatchWhenReady(Data);
+	}
+
+	CurrentThreadWorkToDoBeforeHelping();
+	Data->Process();
+
+	// Every index has been handed out, the ones left are being run by threads which are already working on them. Nothing they
+	// need is queued behind this thread, so waiting is safe even on a worker thread or inside another ParallelFor.
+	Data->Wait();
+}
+
+void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body, bool bForceSingleThread)
+{
+	ParallelForWithPreWork(Num, Body, [](){}, bForceSingleThread);
+}
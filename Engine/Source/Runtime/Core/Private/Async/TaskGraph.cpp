@@ -24,6 +24,17 @@ namespace ENamedThreads
 **/
 static class FTaskGraphImplementation* TaskGraphImplementationSingleton = NULL;
 
+/**
+ * Full memory fence, which also keeps later loads from moving before earlier stores, as the stall and wake up handshake
+ * between workers needs. FPlatformMisc::MemoryBarrier does nothing on some platforms, interlocked arithmetic is a full
+ * fence on all of them.
+ */
+static FORCEINLINE void TaskGraphFullMemoryBarrier()
+{
+	volatile int32 Fence = 0;
+	FPlatformAtomics::InterlockedIncrement(&Fence);
+}
+
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
 
 static struct FChaosMode 
@@ -371,6 +382,8 @@ public:
 				}
 				else
 				{
+					// tasks this thread spawned itself come first, they are the most likely to still be in the cache
+					Task = LocalQueue.Pop();
 					// because of stealing, we are only going to take one item
 					for (int32 Count = SPIN_COUNT + 1; !Task && Count ; Count--)
 					{
@@ -526,6 +539,37 @@ public:
 		return Queue(0).IncomingQueue.PopIfNotClosed();
 	}
 
+	/** 
+	 *	Queue an AnyThread task spawned by this worker in its work stealing queue. Must be called from this thread.
+	 *	@param Task; Task to queue.
+	 *	@return true if the task was queued, false if the queue is full and the task has to go to the shared queue.
+	 **/
+	bool EnqueueLocalFromThisThread(FBaseGraphTask* Task)
+	{
+		checkThreadGraph(bAllowsStealsFromMe);
+		checkThreadGraph((FTaskThread*)FPlatformTLS::GetTlsValue(PerThreadIDTLSSlot) == this); // only the owner can push
+		return LocalQueue.Push(Task);
+	}
+
+	/** 
+	 *	Attempt to steal the oldest task this worker spawned.
+	 *	@return Task; Stolen task, if one was found, otherwise NULL.
+	 **/
+	FBaseGraphTask* StealFromLocalQueue()
+	{
+		checkThreadGraph(bAllowsStealsFromMe);
+		return LocalQueue.Steal();
+	}
+
+	/** 
+	 *	Check the (unsafe) status of the work stealing queue of this worker.
+	 *	@return true if the queue had tasks that could be stolen.
+	 **/
+	bool HasTasksToSteal() const
+	{
+		return !LocalQueue.IsEmpty();
+	}
+
 	/** 
 	 *Return true if this thread is processing tasks. This is only a "guess" if you ask for a thread other than yourself because that can change before the function returns.
 	 *@param QueueIndex, Queue to request quit from
@@ -547,6 +591,8 @@ public:
 	virtual bool Init()
 	{
 		InitializeForCurrentThread();
+		// Worker threads allocate small blocks constantly, let them use the allocator's lock free per-thread caches.
+		FMemory::SetupTLSCachesOnCurrentThread();
 		return true;
 	}
 
@@ -575,6 +621,7 @@ public:
 	 */
 	virtual void Exit()
 	{
+		FMemory::ClearAndDisableTLSCachesOnCurrentThread();
 	}
 
 	/**
@@ -643,7 +690,7 @@ private:
 			if (FPlatformProcess::SupportsMultithreading())
 			{
 				Queue(QueueIndex).StallRestartEvent->Reset();
-				FPlatformMisc::MemoryBarrier();
+				TaskGraphFullMemoryBarrier();
 				if (Queue(QueueIndex).IncomingQueue.CloseIfEmpty())
 				{
 					FScopeCycleCounter Scope( StallStatId );
@@ -652,7 +699,17 @@ private:
 					NotifyStalling();
 					checkThreadGraph(NewValue == 1); // there should be no concurrent calls to Stall!
 					TestRandomizedThreads();
-					Queue(QueueIndex).StallRestartEvent->Wait(MAX_uint32, bCountAsStall);
+					// Workers only wake up idle threads when they push to their work stealing queue, so check those again now that
+					// we are on the stalled list. Either we see their task here or they see us on the list.
+					TaskGraphFullMemoryBarrier();
+					if (bStealsFromOthers && IsWorkAvailable())
+					{
+						Queue(QueueIndex).IncomingQueue.ReopenIfClosedAndPush(WakeUpBaseGraphTask);
+					}
+					else
+					{
+						Queue(QueueIndex).StallRestartEvent->Wait(MAX_uint32, bCountAsStall);
+					}
 					TestRandomizedThreads();
 					NewValue = IsStalled.Decrement();
 					checkThreadGraph(NewValue == 0); // there should be no concurrent calls to Stall!
@@ -678,6 +735,12 @@ private:
 	 */
 	void NotifyStalling();
 
+	/**
+	 *	Internal function to check if other workers have tasks that can be stolen. Called from this thread.
+	 *	@return true if a work stealing queue of another worker is not empty.
+	 */
+	bool IsWorkAvailable();
+
 	FORCEINLINE FThreadTaskQueue& Queue(int32 QueueIndex)
 	{
 		checkThreadGraph(QueueIndex >= 0 && QueueIndex < ENamedThreads::NumQueues && (!bAllowsStealsFromMe || !QueueIndex)); // range check, unnamed threads cannot use an alternate queue
@@ -692,6 +755,12 @@ private:
 	/** Array of queues, only the first one is used for unnamed threads. **/
 	FThreadTaskQueue Queues[ENamedThreads::NumQueues];
 
+	/** 
+	 *	For unnamed threads, the AnyThread tasks spawned by this thread. The owner pushes and pops at one end without contention,
+	 *	other workers steal from the other end when they run out of work.
+	**/
+	TWorkStealingQueue<FBaseGraphTask>					LocalQueue;
+
 	/** Id / Index of this thread. **/
 	ENamedThreads::Type									ThreadId;
 	/** TLS SLot that we store the FTaskThread* this pointer in. **/
@@ -854,6 +923,18 @@ public:
 		{
 			if (FPlatformProcess::SupportsMultithreading())
 			{
+				if (CurrentThreadIfKnown >= NumNamedThreads && Thread(CurrentThreadIfKnown).EnqueueLocalFromThisThread(Task))
+				{
+					// This worker will get to the task itself unless somebody steals it first, so only wake up a thread that is already idle.
+					// Pairs with the check stalling workers do after adding themselves to the stalled list.
+					TaskGraphFullMemoryBarrier();
+					FTaskThread* TempTarget = StalledUnnamedThreads.Pop();
+					if (TempTarget)
+					{
+						TempTarget->EnqueueFromOtherThread(0, WakeUpBaseGraphTask);
+					}
+					return;
+				}
 				IncomingAnyThreadTasks.Push(Task);
 				FTaskThread* TempTarget = StalledUnnamedThreads.Pop(); //@todo it is possible that a thread is in the process of stalling and we just missed it, non-fatal, but we could lose a whole task of potential parallelism.
 				if (TempTarget)
@@ -1056,6 +1137,17 @@ public:
 				}
 			}
 		} while (!IncomingAnyThreadTasks.IsEmpty() || !SortedAnyThreadTasks.IsEmpty());
+		// steal from the work stealing queues of the other workers, starting with the next one so that thieves spread out
+		const int32 NumUnnamedThreads = NumThreads - NumNamedThreads;
+		for (int32 Offset = 1; Offset < NumUnnamedThreads; Offset++)
+		{
+			const int32 Victim = NumNamedThreads + (ThreadInNeed - NumNamedThreads + Offset) % NumUnnamedThreads;
+			FBaseGraphTask* Task = Thread(Victim).StealFromLocalQueue();
+			if (Task)
+			{
+				return Task;
+			}
+		}
 		// this can be called before my constructor is finished
 		for (int32 Pass = 0; Pass < 2; Pass++)
 		{
@@ -1085,6 +1177,23 @@ public:
 		return NULL;
 	}
 
+	/** 
+	 *	Check if any worker other than the given one has tasks in its work stealing queue.
+	 *	@param	ThreadInNeed; Id of the thread asking.
+	 *	@return true if there was work to steal. This is only a hint, the work can be gone before it returns.
+	**/
+	bool IsWorkAvailable(ENamedThreads::Type ThreadInNeed)
+	{
+		for (int32 Test = NumNamedThreads; Test < NumThreads; Test++)
+		{
+			if (Test != ThreadInNeed && Thread(Test).HasTasksToSteal())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	/** 
 	 *	Hint from a worker thread that it is stalling.
 	 *	@param	StallingThread; Id of the thread that is stalling.
@@ -1179,6 +1288,11 @@ void FTaskThread::NotifyStalling()
 	return FTaskGraphImplementation::Get().NotifyStalling(ThreadId);
 }
 
+bool FTaskThread::IsWorkAvailable()
+{
+	return FTaskGraphImplementation::Get().IsWorkAvailable(ThreadId);
+}
+
 
 
 // Statics in FTaskGraphInterface
@@ -1201,6 +1315,11 @@ FTaskGraphInterface& FTaskGraphInterface::Get()
 	return *TaskGraphImplementationSingleton;
 }
 
+bool FTaskGraphInterface::IsRunning()
+{
+	return TaskGraphImplementationSingleton != NULL;
+}
+
 
 // Statics and some implementations from FBaseGraphTask and FGraphEvent
 
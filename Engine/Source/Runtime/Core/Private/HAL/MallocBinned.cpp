@@ -19,6 +19,10 @@ DEFINE_STAT(STAT_Binned_UsedPeak);
 DEFINE_STAT(STAT_Binned_CurrentAllocs);
 DEFINE_STAT(STAT_Binned_TotalAllocs);
 DEFINE_STAT(STAT_Binned_SlackCurrent);
+DEFINE_STAT(STAT_Binned_ThreadCacheCurrent);
+DEFINE_STAT(STAT_Binned_ThreadCacheHits);
+DEFINE_STAT(STAT_Binned_ThreadCacheMisses);
+DEFINE_STAT(STAT_Binned_ThreadCacheHitRate);
 
 void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 {
@@ -34,6 +38,9 @@ void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 	SIZE_T	LocalCurrentAllocs = 0;
 	SIZE_T	LocalTotalAllocs = 0;
 	SIZE_T	LocalSlackCurrent = 0;
+	SIZE_T	LocalThreadCacheCurrent = 0;
+	uint64	LocalThreadCacheHits = 0;
+	uint64	LocalThreadCacheMisses = 0;
 
 	{
 #ifdef USE_INTERNAL_LOCKS
@@ -41,6 +48,9 @@ void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 #endif
 
 		UpdateSlackStat();
+#ifdef USE_THREAD_CACHES
+		GatherThreadCacheStats( LocalThreadCacheCurrent, LocalThreadCacheHits, LocalThreadCacheMisses );
+#endif
 
 		// Copy memory stats.
 		LocalOsCurrent = OsCurrent;
@@ -64,6 +74,9 @@ void FMallocBinned::GetAllocatorStats( FGenericMemoryStats& out_Stats )
 	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_CurrentAllocs ), LocalCurrentAllocs );
 	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_TotalAllocs ), LocalTotalAllocs );
 	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_SlackCurrent ), LocalSlackCurrent );
+	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_ThreadCacheCurrent ), LocalThreadCacheCurrent );
+	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_ThreadCacheHits ), (SIZE_T)LocalThreadCacheHits );
+	out_Stats.Add( GET_STATDESCRIPTION( STAT_Binned_ThreadCacheMisses ), (SIZE_T)LocalThreadCacheMisses );
 #endif // STATS
 }
 
@@ -82,4 +95,8 @@ void FMallocBinned::InitializeStatsMetadata()
 	GET_STATFNAME(STAT_Binned_CurrentAllocs);
 	GET_STATFNAME(STAT_Binned_TotalAllocs);
 	GET_STATFNAME(STAT_Binned_SlackCurrent);
+	GET_STATFNAME(STAT_Binned_ThreadCacheCurrent);
+	GET_STATFNAME(STAT_Binned_ThreadCacheHits);
+	GET_STATFNAME(STAT_Binned_ThreadCacheMisses);
+	GET_STATFNAME(STAT_Binned_ThreadCacheHitRate);
 }
@@ -29,6 +29,9 @@ uint32 FRunnableThreadPThread::Run()
 		ThreadInitSyncEvent->Trigger();
 	}
 
+	// Give back the command list pages this thread cached
+	FPageAllocator::ClearTLSCachesOnCurrentThread();
+
 #if STATS
 	FThreadStats::Shutdown();
 #endif
@@ -3,6 +3,7 @@
 #include "CorePrivatePCH.h"
 #include <sys/file.h>	// flock()
 #include <sys/stat.h>   // mkdirp()
+#include <sys/mman.h>   // mmap()
 
 DEFINE_LOG_CATEGORY_STATIC(LogLinuxPlatformFile, Log, All);
 
@@ -766,6 +767,107 @@ IFileHandle* FLinuxPlatformFile::OpenRead(const TCHAR* Filename)
 	return nullptr;
 }
 
+#if PLATFORM_64BITS
+/**
+ * Linux memory mapped file. The whole file is mapped read-only when it is opened and regions are views into that
+ * mapping, so mapping a region doesn't need a syscall and pages are only read from disk when first touched. Only
+ * used on 64-bit where mapping large files doesn't run out of address space.
+ */
+class FMappedFileHandleLinux : public IMappedFileHandle
+{
+	/** View into the mapping of the owning handle */
+	class FMappedFileRegionLinux : public IMappedFileRegion
+	{
+	public:
+		FMappedFileRegionLinux(FMappedFileHandleLinux& InOwner, const uint8* InMappedPtr, int64 InMappedSize)
+			: IMappedFileRegion(InMappedPtr, InMappedSize)
+			, Owner(InOwner)
+		{
+			Owner.NumOutstandingRegions.Increment();
+		}
+
+		virtual ~FMappedFileRegionLinux()
+		{
+			Owner.NumOutstandingRegions.Decrement();
+		}
+
+	private:
+		FMappedFileHandleLinux& Owner;
+	};
+
+public:
+	FMappedFileHandleLinux(const uint8* InMappedPtr, int64 InFileSize)
+		: IMappedFileHandle(InFileSize)
+		, MappedPtr(InMappedPtr)
+	{
+	}
+
+	virtual ~FMappedFileHandleLinux()
+	{
+		checkf(NumOutstandingRegions.GetValue() == 0, TEXT("Mapped file closed with %d regions still open"), NumOutstandingRegions.GetValue());
+		if (MappedPtr)
+		{
+			munmap(const_cast<uint8*>(MappedPtr), GetFileSize());
+		}
+	}
+
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap) override
+	{
+		if (Offset < 0 || Offset > GetFileSize() || BytesToMap < 0)
+		{
+			return nullptr;
+		}
+		BytesToMap = FMath::Min(BytesToMap, GetFileSize() - Offset);
+		return new FMappedFileRegionLinux(*this, MappedPtr + Offset, BytesToMap);
+	}
+
+private:
+	/** Start of the mapping, nullptr for empty files which can't be mapped */
+	const uint8* MappedPtr;
+	/** Number of regions that still point into the mapping */
+	FThreadSafeCounter NumOutstandingRegions;
+};
+#endif // PLATFORM_64BITS
+
+IMappedFileHandle* FLinuxPlatformFile::OpenMapped(const TCHAR* Filename)
+{
+#if PLATFORM_64BITS
+	FString MappedToName;
+	int32 Handle = GCaseInsensMapper.OpenCaseInsensitiveRead(TCHAR_TO_UTF8(*NormalizeFilename(Filename)), MappedToName);
+	if (Handle == -1)
+	{
+		return nullptr;
+	}
+
+	struct stat FileInfo;
+	if (fstat(Handle, &FileInfo) == -1)
+	{
+		close(Handle);
+		return nullptr;
+	}
+
+	void* MappedPtr = nullptr;
+	if (FileInfo.st_size > 0)
+	{
+		MappedPtr = mmap(nullptr, FileInfo.st_size, PROT_READ, MAP_PRIVATE, Handle, 0);
+		if (MappedPtr == MAP_FAILED)
+		{
+			int ErrNo = errno;
+			UE_LOG(LogLinuxPlatformFile, Warning, TEXT("mmap() of '%s' (%lld bytes) failed with errno = %d (%s)"), *MappedToName, (int64)FileInfo.st_size, ErrNo,
+				ANSI_TO_TCHAR(strerror(ErrNo)));
+			close(Handle);
+			return nullptr;
+		}
+	}
+
+	// The mapping stays valid after the descriptor is closed, so it doesn't count against the open file limit.
+	close(Handle);
+	return new FMappedFileHandleLinux((const uint8*)MappedPtr, FileInfo.st_size);
+#else
+	return nullptr;
+#endif // PLATFORM_64BITS
+}
+
 IFileHandle* FLinuxPlatformFile::OpenWrite(const TCHAR* Filename, bool bAppend, bool bAllowRead)
 {
 	int Flags = O_CREAT | O_CLOEXEC;	// prevent children from inheriting this
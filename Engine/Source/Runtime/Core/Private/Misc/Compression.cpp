@@ -61,6 +61,395 @@ bool appUncompressMemoryZLIB( void* UncompressedBuffer, int32 UncompressedSize,
 	return bOperationSucceeded;
 }
 
+/*-----------------------------------------------------------------------------
+	LZ4.
+-----------------------------------------------------------------------------*/
+
+/**
+ * Native implementation of the LZ4 block format (http://lz4.github.io/lz4/). A block is a series of sequences, each
+ * made of a token, literal bytes and a back reference into already decompressed data. The format is byte aligned and
+ * only needs copies to decode, which is why it decompresses several times faster than ZLIB.
+ */
+namespace LZ4
+{
+	/** Minimum length of a match. */
+	enum { MinMatch = 4 };
+	/** The last bytes of a block are always literals. */
+	enum { LastLiterals = 5 };
+	/** The last match needs to start at least this many bytes before the end of the block. */
+	enum { MatchFindLimit = 12 };
+	/** Largest offset that can be encoded in a sequence. */
+	enum { MaxOffset = 65535 };
+	/** Size of the match finder hash table (log2). 4K entries keeps the table on the stack and in L1. */
+	enum { HashLog = 12 };
+
+	static FORCEINLINE uint32 Read32( const uint8* Ptr )
+	{
+		uint32 Value;
+		FMemory::Memcpy( &Value, Ptr, sizeof(Value) );
+		return Value;
+	}
+
+	static FORCEINLINE uint32 Hash( uint32 Sequence )
+	{
+		return (Sequence * 2654435761U) >> (32 - HashLog);
+	}
+
+	/** Writes the extra bytes of a literal or match length that didn't fit in the token. */
+	static FORCEINLINE bool WriteLength( uint8*& Dst, const uint8* DstEnd, int32 Length )
+	{
+		for( Length -= 15; Length >= 255; Length -= 255 )
+		{
+			if( Dst >= DstEnd )
+			{
+				return false;
+			}
+			*Dst++ = 255;
+		}
+		if( Dst >= DstEnd )
+		{
+			return false;
+		}
+		*Dst++ = (uint8)Length;
+		return true;
+	}
+
+	/** Reads the extra bytes of a literal or match length, adding them to Length. */
+	static FORCEINLINE bool ReadLength( const uint8*& Src, const uint8* SrcEnd, int32& Length )
+	{
+		uint8 Byte;
+		do
+		{
+			if( Src >= SrcEnd )
+			{
+				return false;
+			}
+			Byte = *Src++;
+			Length += Byte;
+		}
+		while( Byte == 255 );
+		return true;
+	}
+
+	/** Writes a sequence. A zero MatchOffset writes the final, literal only sequence. */
+	static bool WriteSequence( uint8*& Dst, const uint8* DstEnd, const uint8* Literals, int32 LiteralLength, int32 MatchOffset, int32 MatchLength )
+	{
+		if( Dst >= DstEnd )
+		{
+			return false;
+		}
+		uint8* Token = Dst++;
+		*Token = (uint8)(FMath::Min(LiteralLength, 15) << 4);
+		if( LiteralLength >= 15 && !WriteLength( Dst, DstEnd, LiteralLength ) )
+		{
+			return false;
+		}
+		if( DstEnd - Dst < LiteralLength )
+		{
+			return false;
+		}
+		FMemory::Memcpy( Dst, Literals, LiteralLength );
+		Dst += LiteralLength;
+
+		if( MatchOffset )
+		{
+			if( DstEnd - Dst < 2 )
+			{
+				return false;
+			}
+			*Dst++ = (uint8)(MatchOffset & 0xFF);
+			*Dst++ = (uint8)(MatchOffset >> 8);
+
+			MatchLength -= MinMatch;
+			*Token |= (uint8)FMath::Min(MatchLength, 15);
+			if( MatchLength >= 15 && !WriteLength( Dst, DstEnd, MatchLength ) )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** @return The maximum possible bytes needed for compression of data buffer of size UncompressedSize */
+	static int32 CompressBound( int32 UncompressedSize )
+	{
+		return UncompressedSize + UncompressedSize / 255 + 16;
+	}
+}
+
+DECLARE_CYCLE_STAT(TEXT("Compress Memory LZ4"),Stat_appCompressMemoryLZ4,STATGROUP_Engine);
+
+/**
+ * Thread-safe LZ4 compression routine. Greedy single probe match finder, which favors speed over ratio.
+ *
+ * @param	CompressedBuffer			Buffer compressed data is going to be written to
+ * @param	CompressedSize	[in/out]	Size of CompressedBuffer, at exit will be size of compressed data
+ * @param	UncompressedBuffer			Buffer containing uncompressed data
+ * @param	UncompressedSize			Size of uncompressed data in bytes
+ * @return true if compression succeeds, false if it fails because CompressedBuffer was too small
+ */
+static bool appCompressMemoryLZ4( void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize )
+{
+	SCOPE_CYCLE_COUNTER( Stat_appCompressMemoryLZ4 );
+
+	const uint8* Src		= (const uint8*)UncompressedBuffer;
+	const uint8* SrcEnd		= Src + UncompressedSize;
+	uint8* DstStart			= (uint8*)CompressedBuffer;
+	uint8* Dst				= DstStart;
+	const uint8* DstEnd		= Dst + CompressedSize;
+	// Start of the literals not yet written out.
+	const uint8* Anchor		= Src;
+
+	if( UncompressedSize > LZ4::MatchFindLimit )
+	{
+		// Offsets into the source buffer, INDEX_NONE for empty slots.
+		int32 HashTable[1 << LZ4::HashLog];
+		FMemory::Memset( HashTable, 0xFF, sizeof(HashTable) );
+
+		const uint8* MatchLimit		= SrcEnd - LZ4::LastLiterals;
+		const uint8* SearchLimit	= SrcEnd - LZ4::MatchFindLimit;
+		const uint8* Current		= Src;
+
+		while( Current <= SearchLimit )
+		{
+			const uint32 Sequence	= LZ4::Read32( Current );
+			const uint32 HashIndex	= LZ4::Hash( Sequence );
+			const int32 Candidate	= HashTable[HashIndex];
+			HashTable[HashIndex]	= (int32)(Current - Src);
+
+			if( Candidate == INDEX_NONE || (Current - Src) - Candidate > LZ4::MaxOffset || LZ4::Read32( Src + Candidate ) != Sequence )
+			{
+				Current++;
+				continue;
+			}
+
+			// Extend the match backwards into pending literals and forwards as far as allowed.
+			const uint8* Match = Src + Candidate;
+			while( Current > Anchor && Match > Src && Current[-1] == Match[-1] )
+			{
+				Current--;
+				Match--;
+			}
+			const uint8* MatchEnd = Current + LZ4::MinMatch;
+			const uint8* Reference = Match + LZ4::MinMatch;
+			while( MatchEnd < MatchLimit && *MatchEnd == *Reference )
+			{
+				MatchEnd++;
+				Reference++;
+			}
+
+			if( !LZ4::WriteSequence( Dst, DstEnd, Anchor, (int32)(Current - Anchor), (int32)(Current - Match), (int32)(MatchEnd - Current) ) )
+			{
+				return false;
+			}
+			Current = MatchEnd;
+			Anchor = Current;
+		}
+	}
+
+	// Last literals.
+	if( !LZ4::WriteSequence( Dst, DstEnd, Anchor, (int32)(SrcEnd - Anchor), 0, 0 ) )
+	{
+		return false;
+	}
+
+	CompressedSize = (int32)(Dst - DstStart);
+	return true;
+}
+
+DECLARE_CYCLE_STAT(TEXT("Uncompress Memory LZ4"),Stat_appUncompressMemoryLZ4,STATGROUP_Engine);
+
+/**
+ * Thread-safe LZ4 decompression routine. All reads and writes are bounds checked so corrupt data fails instead of
+ * overrunning the buffers.
+ *
+ * @param	UncompressedBuffer			Buffer uncompressed data is going to be written to
+ * @param	UncompressedSize			Exact size of the data after decompression in bytes
+ * @param	CompressedBuffer			Buffer compressed data is going to be read from
+ * @param	CompressedSize				Size of CompressedBuffer data in bytes
+ * @return true if decompression succeeds, false if the data is corrupt or doesn't match UncompressedSize
+ */
+static bool appUncompressMemoryLZ4( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize )
+{
+	SCOPE_CYCLE_COUNTER( Stat_appUncompressMemoryLZ4 );
+
+	const uint8* Src		= (const uint8*)CompressedBuffer;
+	const uint8* SrcEnd		= Src + CompressedSize;
+	uint8* DstStart			= (uint8*)UncompressedBuffer;
+	uint8* Dst				= DstStart;
+	uint8* DstEnd			= Dst + UncompressedSize;
+
+	while( Src < SrcEnd )
+	{
+		const uint8 Token = *Src++;
+
+		int32 LiteralLength = Token >> 4;
+		if( LiteralLength == 15 && !LZ4::ReadLength( Src, SrcEnd, LiteralLength ) )
+		{
+			return false;
+		}
+		if( LiteralLength > SrcEnd - Src || LiteralLength > DstEnd - Dst )
+		{
+			return false;
+		}
+		FMemory::Memcpy( Dst, Src, LiteralLength );
+		Dst += LiteralLength;
+		Src += LiteralLength;
+
+		// The last sequence only has literals.
+		if( Src == SrcEnd )
+		{
+			break;
+		}
+
+		if( SrcEnd - Src < 2 )
+		{
+			return false;
+		}
+		const int32 MatchOffset = Src[0] | (Src[1] << 8);
+		Src += 2;
+		if( MatchOffset == 0 || MatchOffset > Dst - DstStart )
+		{
+			return false;
+		}
+
+		int32 MatchLength = Token & 15;
+		if( MatchLength == 15 && !LZ4::ReadLength( Src, SrcEnd, MatchLength ) )
+		{
+			return false;
+		}
+		MatchLength += LZ4::MinMatch;
+		if( MatchLength > DstEnd - Dst )
+		{
+			return false;
+		}
+
+		const uint8* Match = Dst - MatchOffset;
+		if( MatchOffset >= MatchLength )
+		{
+			FMemory::Memcpy( Dst, Match, MatchLength );
+			Dst += MatchLength;
+		}
+		else
+		{
+			// Overlapping match, e.g. a run of a repeated pattern, needs to be copied front to back.
+			for( const uint8* MatchEnd = Match + MatchLength; Match < MatchEnd; )
+			{
+				*Dst++ = *Match++;
+			}
+		}
+	}
+
+	return Dst == DstEnd;
+}
+
+/*-----------------------------------------------------------------------------
+	Codec registry.
+-----------------------------------------------------------------------------*/
+
+/** ZLIB codec, the default format. */
+class FCompressionCodecZLIB : public ICompressionCodec
+{
+public:
+	virtual const TCHAR* GetName() const override
+	{
+		return TEXT("ZLIB");
+	}
+	virtual int32 CompressMemoryBound( int32 UncompressedSize ) const override
+	{
+		return compressBound( UncompressedSize );
+	}
+	virtual bool CompressMemory( ECompressionFlags Flags, void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize ) override
+	{
+		return appCompressMemoryZLIB( CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize );
+	}
+	virtual bool UncompressMemory( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize ) override
+	{
+		return appUncompressMemoryZLIB( UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize );
+	}
+};
+
+/** LZ4 codec, for data that is decompressed often, e.g. pak files loaded at runtime. */
+class FCompressionCodecLZ4 : public ICompressionCodec
+{
+public:
+	virtual const TCHAR* GetName() const override
+	{
+		return TEXT("LZ4");
+	}
+	virtual int32 CompressMemoryBound( int32 UncompressedSize ) const override
+	{
+		return LZ4::CompressBound( UncompressedSize );
+	}
+	virtual bool CompressMemory( ECompressionFlags Flags, void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize ) override
+	{
+		return appCompressMemoryLZ4( CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize );
+	}
+	virtual bool UncompressMemory( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize ) override
+	{
+		return appUncompressMemoryLZ4( UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize );
+	}
+};
+
+/** Codecs indexed by compression type. */
+struct FCompressionCodecRegistry
+{
+	FCompressionCodecZLIB	ZLIBCodec;
+	FCompressionCodecLZ4	LZ4Codec;
+	ICompressionCodec*		Codecs[COMPRESSION_FLAGS_TYPE_MASK + 1];
+
+	FCompressionCodecRegistry()
+	{
+		FMemory::Memzero( Codecs, sizeof(Codecs) );
+		Codecs[COMPRESS_ZLIB]	= &ZLIBCodec;
+		Codecs[COMPRESS_LZ4]	= &LZ4Codec;
+	}
+
+	static FCompressionCodecRegistry& Get()
+	{
+		static FCompressionCodecRegistry Registry;
+		return Registry;
+	}
+
+	FORCEINLINE ICompressionCodec* FindCodec( ECompressionFlags Flags ) const
+	{
+		return Codecs[Flags & COMPRESSION_FLAGS_TYPE_MASK];
+	}
+};
+
+/** Makes sure the registry is constructed during static initialization, before any worker threads are around. */
+static FCompressionCodecRegistry& GCompressionCodecRegistry = FCompressionCodecRegistry::Get();
+
+void FCompression::RegisterCodec( ECompressionFlags Format, ICompressionCodec* Codec )
+{
+	check( (Format & COMPRESSION_FLAGS_TYPE_MASK) != COMPRESS_None && (Format & COMPRESSION_FLAGS_OPTIONS_MASK) == 0 );
+	FCompressionCodecRegistry::Get().Codecs[Format] = Codec;
+}
+
+bool FCompression::IsFormatAvailable( ECompressionFlags Flags )
+{
+	return FCompressionCodecRegistry::Get().FindCodec( Flags ) != nullptr;
+}
+
+ECompressionFlags FCompression::GetFormatFromName( const TCHAR* Name )
+{
+	const FCompressionCodecRegistry& Registry = FCompressionCodecRegistry::Get();
+	for( int32 FormatIndex = 0; FormatIndex < ARRAY_COUNT(Registry.Codecs); FormatIndex++ )
+	{
+		if( Registry.Codecs[FormatIndex] && FCString::Stricmp( Registry.Codecs[FormatIndex]->GetName(), Name ) == 0 )
+		{
+			return (ECompressionFlags)FormatIndex;
+		}
+	}
+	return COMPRESS_None;
+}
+
+const TCHAR* FCompression::GetFormatName( ECompressionFlags Flags )
+{
+	ICompressionCodec* Codec = FCompressionCodecRegistry::Get().FindCodec( Flags );
+	return Codec ? Codec->GetName() : TEXT("None");
+}
+
 /** Time spent compressing data in seconds. */
 double FCompression::CompressorTime		= 0;
 /** Number of bytes before compression.		*/
@@ -105,17 +494,13 @@ int32 FCompression::CompressMemoryBound( ECompressionFlags Flags, int32 Uncompre
 {
 	int32 CompressionBound = UncompressedSize;
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
+	check(Flags & COMPRESSION_FLAGS_TYPE_MASK);
 
 	Flags = CheckGlobalCompressionFlags(Flags);
 
-	switch(Flags & COMPRESSION_FLAGS_TYPE_MASK)
+	if (ICompressionCodec* Codec = FCompressionCodecRegistry::Get().FindCodec(Flags))
 	{
-	case COMPRESS_ZLIB:
-		CompressionBound = compressBound(UncompressedSize);
-		break;
-	default:
-		break;
+		CompressionBound = Codec->CompressMemoryBound(UncompressedSize);
 	}
 
 	return CompressionBound;
@@ -137,20 +522,20 @@ bool FCompression::CompressMemory( ECompressionFlags Flags, void* CompressedBuff
 	double CompressorStartTime = FPlatformTime::Seconds();
 
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
+	check(Flags & COMPRESSION_FLAGS_TYPE_MASK);
 
 	bool bCompressSucceeded = false;
 
 	Flags = CheckGlobalCompressionFlags(Flags);
 
-	switch(Flags & COMPRESSION_FLAGS_TYPE_MASK)
+	if (ICompressionCodec* Codec = FCompressionCodecRegistry::Get().FindCodec(Flags))
 	{
-		case COMPRESS_ZLIB:
-			bCompressSucceeded = appCompressMemoryZLIB(CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize);
-			break;
-		default:
-			UE_LOG(LogCompression, Warning, TEXT("appCompressMemory - This compression type not supported"));
-			bCompressSucceeded =  false;
+		bCompressSucceeded = Codec->CompressMemory(Flags, CompressedBuffer, CompressedSize, UncompressedBuffer, UncompressedSize);
+	}
+	else
+	{
+		UE_LOG(LogCompression, Warning, TEXT("appCompressMemory - This compression type not supported"));
+		bCompressSucceeded =  false;
 	}
 
 	// Keep track of compression time and stats.
@@ -184,18 +569,18 @@ bool FCompression::UncompressMemory( ECompressionFlags Flags, void* Uncompressed
 	STAT(double UncompressorStartTime = FPlatformTime::Seconds();)
 	
 	// make sure a valid compression scheme was provided
-	check(Flags & COMPRESS_ZLIB);
+	check(Flags & COMPRESSION_FLAGS_TYPE_MASK);
 
 	bool bUncompressSucceeded = false;
 
-	switch(Flags & COMPRESSION_FLAGS_TYPE_MASK)
+	if (ICompressionCodec* Codec = FCompressionCodecRegistry::Get().FindCodec(Flags))
 	{
-		case COMPRESS_ZLIB:
-			bUncompressSucceeded = appUncompressMemoryZLIB(UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize);
-			break;
-		default:
-			UE_LOG(LogCompression, Warning, TEXT("FCompression::UncompressMemory - This compression type not supported"));
-			bUncompressSucceeded = false;
+		bUncompressSucceeded = Codec->UncompressMemory(UncompressedBuffer, UncompressedSize, CompressedBuffer, CompressedSize);
+	}
+	else
+	{
+		UE_LOG(LogCompression, Warning, TEXT("FCompression::UncompressMemory - This compression type not supported"));
+		bUncompressSucceeded = false;
 	}
 	STAT(if (FThreadStats::IsThreadingReady()) { INC_FLOAT_STAT_BY(STAT_UncompressorTime,(float)(FPlatformTime::Seconds()-UncompressorStartTime))} );
 	
@@ -259,10 +644,8 @@ int32 FCompressedGrowableBuffer::Append( void* Data, int32 Size )
 	if( MaxPendingBufferSize - PendingCompressionBuffer.Num() < Size )
 	{
 		// Allocate temporary buffer to hold compressed data. It is bigger than the uncompressed size as
-		// compression is not guaranteed to create smaller data and we don't want to handle that case so 
-		// we simply assert if it doesn't fit. For all practical purposes this works out fine and is what
-		// other code in the engine does as well.
-		int32 CompressedSize = MaxPendingBufferSize * 4 / 3;
+		// compression is not guaranteed to create smaller data. The bound depends on the codec used.
+		int32 CompressedSize = FCompression::CompressMemoryBound( CompressionFlags, PendingCompressionBuffer.Num() );
 		void* TempBuffer = FMemory::Malloc( CompressedSize );
 
 		// Compress the memory. CompressedSize is [in/out]
@@ -9,8 +9,8 @@ DECLARE_MEMORY_STAT(TEXT("MemStack Large Block"), STAT_MemStackLargeBLock,STATGR
 DECLARE_MEMORY_STAT(TEXT("PageAllocator Free"), STAT_PageAllocatorFree, STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("PageAllocator Used"), STAT_PageAllocatorUsed, STATGROUP_Memory);
 
-TLockFreeFixedSizeAllocator<FPageAllocator::PageSize, FThreadSafeCounter> FPageAllocator::TheAllocator;
-TLockFreeFixedSizeAllocator<FPageAllocator::SmallPageSize, FThreadSafeCounter> FPageAllocator::TheSmallAllocator;
+TLockFreeFixedSizeAllocator_TLSCache<FPageAllocator::PageSize, FPageAllocator::PagesPerBundle, FThreadSafeCounter> FPageAllocator::TheAllocator(FPageAllocator::MaxCachedFullBundles);
+TLockFreeFixedSizeAllocator_TLSCache<FPageAllocator::SmallPageSize, FPageAllocator::SmallPagesPerBundle, FThreadSafeCounter> FPageAllocator::TheSmallAllocator(FPageAllocator::MaxCachedFullBundles);
 
 #if STATS
 void FPageAllocator::UpdateStats()
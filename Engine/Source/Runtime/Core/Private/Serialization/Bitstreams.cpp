@@ -134,6 +134,23 @@ FBitWriter::FBitWriter(void) : Num(0), Max(0), AllowResize(false)
 {
 }
 
+/**
+ * Copies another bit writer, reusing this writer's buffer if it is large enough
+ */
+FBitWriter& FBitWriter::operator=( const FBitWriter& Other )
+{
+	if ( this != &Other )
+	{
+		FArchive::operator=( Other );
+		Buffer.Reset( Other.Buffer.Num() );
+		Buffer.Append( Other.Buffer );
+		Num = Other.Num;
+		Max = Other.Max;
+		AllowResize = Other.AllowResize;
+	}
+	return *this;
+}
+
 /**
  * Resets the bit writer back to its initial state
  */
@@ -146,6 +163,21 @@ void FBitWriter::Reset(void)
 	ArNetVer |= 0x80000000;
 }
 
+/**
+ * Resets the bit writer as if it had just been constructed with the given size, reusing its buffer if it is large enough
+ */
+void FBitWriter::Reinit( int64 InMaxBits, bool InAllowResize /*=false*/ )
+{
+	FArchive::Reset();
+	Num = 0;
+	Max = InMaxBits;
+	AllowResize = InAllowResize;
+	Buffer.Reset( (InMaxBits+7)>>3 );
+	Buffer.AddZeroed( (InMaxBits+7)>>3 );
+	ArIsPersistent = ArIsSaving = 1;
+	ArNetVer |= 0x80000000;
+}
+
 void FBitWriter::SerializeBits( void* Src, int64 LengthBits )
 {
 	if( AllowAppend(LengthBits) )
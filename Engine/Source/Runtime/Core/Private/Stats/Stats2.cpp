@@ -24,6 +24,9 @@ static struct FForceInitAtBootFStats2 : public TForceInitAtBoot<FStats2Globals>
 
 DECLARE_FLOAT_COUNTER_STAT( TEXT("Seconds Per Cycle"), STAT_SecondsPerCycle, STATGROUP_Engine );
 DECLARE_DWORD_COUNTER_STAT( TEXT("Frame Packets Received"),STAT_StatFramePacketsRecv,STATGROUP_StatSystem);
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT("Dropped Messages"),STAT_StatDroppedMessages,STATGROUP_StatSystem);
+DECLARE_DWORD_ACCUMULATOR_STAT( TEXT("Dropped Packets"),STAT_StatDroppedPackets,STATGROUP_StatSystem);
+DECLARE_MEMORY_STAT( TEXT("Pending Packets"), STAT_StatPendingPacketsMemory, STATGROUP_StatSystem );
 
 DECLARE_CYCLE_STAT(TEXT("WaitForStats"),STAT_WaitForStats,STATGROUP_Engine);
 DECLARE_CYCLE_STAT(TEXT("StatsNew Tick"),STAT_StatsNewTick,STATGROUP_StatSystem);
@@ -629,6 +632,201 @@ FName FStatNameAndInfo::GetGroupCategoryFrom(FName InLongName)
 	return NAME_None;
 }
 
+/*-----------------------------------------------------------------------------
+	FStatPacket
+-----------------------------------------------------------------------------*/
+
+/**
+ * Compact packet format, per message:
+ *	varint name index, if it equals the number of names seen so far it is followed by the raw 8 byte FStatNameAndInfo
+ *	(a name can be sent again under a new index, the reader doesn't care)
+ *	int64 payloads as zigzag varints, cycle counts as deltas to the previous cycle count in the packet
+ *	other payloads as the raw 8 bytes
+ */
+namespace StatPacketCompaction
+{
+	static_assert(sizeof(FStatNameAndInfo) == sizeof(uint64), "FStatNameAndInfo is stored as a raw uint64.");
+	static_assert(FStatMessage::DATA_SIZE == sizeof(uint64), "Stat payloads are stored as a raw uint64.");
+
+	FORCEINLINE void WriteVarInt(TArray<uint8>& Out, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Out.Add(uint8(Value) | 0x80);
+			Value >>= 7;
+		}
+		Out.Add(uint8(Value));
+	}
+
+	FORCEINLINE uint64 ReadVarInt(const uint8*& Data)
+	{
+		uint64 Value = 0;
+		for (int32 Shift = 0; ; Shift += 7)
+		{
+			const uint8 Byte = *Data++;
+			Value |= uint64(Byte & 0x7f) << Shift;
+			if (!(Byte & 0x80))
+			{
+				return Value;
+			}
+		}
+	}
+
+	FORCEINLINE void WriteRaw(TArray<uint8>& Out, const void* Value)
+	{
+		FMemory::Memcpy(&Out[Out.AddUninitialized(sizeof(uint64))], Value, sizeof(uint64));
+	}
+
+	FORCEINLINE void ReadRaw(const uint8*& Data, void* Value)
+	{
+		FMemory::Memcpy(Value, Data, sizeof(uint64));
+		Data += sizeof(uint64);
+	}
+
+	FORCEINLINE uint64 ZigZag(int64 Value)
+	{
+		return (uint64(Value) << 1) ^ uint64(Value >> 63);
+	}
+
+	FORCEINLINE int64 UnZigZag(uint64 Value)
+	{
+		return int64(Value >> 1) ^ -int64(Value & 1);
+	}
+
+	FORCEINLINE bool IsVarIntPayload(const FStatNameAndInfo& NameAndInfo)
+	{
+		return NameAndInfo.GetField<EStatDataType>() == EStatDataType::ST_int64;
+	}
+
+	FORCEINLINE bool IsCycleDeltaPayload(const FStatNameAndInfo& NameAndInfo)
+	{
+		return NameAndInfo.GetFlag(EStatMetaFlags::IsCycle) && !NameAndInfo.GetFlag(EStatMetaFlags::IsPackedCCAndDuration);
+	}
+
+	/**
+	 * Direct mapped cache of the names already written to a packet, lives on the stack of the sending thread so compacting doesn't allocate.
+	 * A name evicted by another one is just written again under a new index.
+	 */
+	struct FNameCache
+	{
+		enum { NUM_SLOTS = 256 };
+
+		uint64 Names[NUM_SLOTS];
+		int32 Indices[NUM_SLOTS];
+
+		FNameCache()
+		{
+			FMemory::Memset(Indices, 0xff, sizeof(Indices));
+		}
+
+		FORCEINLINE uint32 GetSlot(uint64 RawName) const
+		{
+			// Fibonacci hashing, the low bits of the name are mostly flags
+			return uint32((RawName * 0x9E3779B97F4A7C15ull) >> 56);
+		}
+	};
+	static_assert(FNameCache::NUM_SLOTS == 256, "GetSlot keeps the top 8 bits of the hash.");
+}
+
+void FStatPacket::Compact()
+{
+	using namespace StatPacketCompaction;
+
+	const int32 NumMessages = StatMessages.Num();
+	if (!NumMessages)
+	{
+		return;
+	}
+
+	FNameCache NameCache;
+	int32 NumNames = 0;
+	int64 LastCycles = 0;
+	CompactMessages.Reserve(CompactMessages.Num() + NumMessages * 4);
+	for (int32 Index = 0; Index < NumMessages; ++Index)
+	{
+		const FStatMessage& Message = StatMessages[Index];
+
+		uint64 RawName;
+		FMemory::Memcpy(&RawName, &Message.NameAndInfo, sizeof(uint64));
+		const uint32 Slot = NameCache.GetSlot(RawName);
+		if (NameCache.Indices[Slot] != INDEX_NONE && NameCache.Names[Slot] == RawName)
+		{
+			WriteVarInt(CompactMessages, NameCache.Indices[Slot]);
+		}
+		else
+		{
+			NameCache.Names[Slot] = RawName;
+			NameCache.Indices[Slot] = NumNames;
+			WriteVarInt(CompactMessages, NumNames++);
+			WriteRaw(CompactMessages, &RawName);
+		}
+
+		if (IsVarIntPayload(Message.NameAndInfo))
+		{
+			int64 Value = Message.GetValue_int64();
+			if (IsCycleDeltaPayload(Message.NameAndInfo))
+			{
+				const int64 Delta = Value - LastCycles;
+				LastCycles = Value;
+				Value = Delta;
+			}
+			WriteVarInt(CompactMessages, ZigZag(Value));
+		}
+		else
+		{
+			WriteRaw(CompactMessages, &Message.StatData);
+		}
+	}
+
+	NumCompactMessages += NumMessages;
+	StatMessages.Empty();
+}
+
+void FStatPacket::Uncompact()
+{
+	using namespace StatPacketCompaction;
+
+	if (!NumCompactMessages)
+	{
+		return;
+	}
+
+	TArray<uint64> Names;
+	int64 LastCycles = 0;
+	const uint8* Data = CompactMessages.GetData();
+	StatMessages.Reserve(StatMessages.Num() + NumCompactMessages);
+	for (int32 Index = 0; Index < NumCompactMessages; ++Index)
+	{
+		FStatMessage& Message = *new(StatMessages) FStatMessage();
+
+		const int32 NameIndex = (int32)ReadVarInt(Data);
+		if (NameIndex == Names.Num())
+		{
+			ReadRaw(Data, &Names[Names.AddUninitialized()]);
+		}
+		FMemory::Memcpy(&Message.NameAndInfo, &Names[NameIndex], sizeof(uint64));
+
+		if (IsVarIntPayload(Message.NameAndInfo))
+		{
+			int64 Value = UnZigZag(ReadVarInt(Data));
+			if (IsCycleDeltaPayload(Message.NameAndInfo))
+			{
+				Value += LastCycles;
+				LastCycles = Value;
+			}
+			Message.GetValue_int64() = Value;
+		}
+		else
+		{
+			ReadRaw(Data, &Message.StatData);
+		}
+	}
+	check(Data == CompactMessages.GetData() + CompactMessages.Num());
+
+	NumCompactMessages = 0;
+	CompactMessages.Empty();
+}
+
 /*-----------------------------------------------------------------------------
 	FStatsThread
 -----------------------------------------------------------------------------*/
@@ -688,7 +886,7 @@ public:
 			int32 IncomingDataMessages = 0;
 			for( int32 Index = 0; Index < IncomingData.Packets.Num(); ++Index )
 			{
-				IncomingDataMessages += IncomingData.Packets[Index]->StatMessages.Num();
+				IncomingDataMessages += IncomingData.Packets[Index]->GetNumMessages();
 			}
 
 			bShouldProcess = IncomingDataMessages > MaxIncomingMessages || IncomingData.Packets.Num() > MaxIncomingPackets;
@@ -710,6 +908,16 @@ public:
 			FStatPacketArray NowData; 
 			Exchange(NowData.Packets, IncomingData.Packets);
 			INC_DWORD_STAT_BY(STAT_StatFramePacketsRecv, NowData.Packets.Num());
+			SET_MEMORY_STAT(STAT_StatPendingPacketsMemory, FThreadStats::PendingPacketsSize.GetValue());
+			SET_DWORD_STAT(STAT_StatDroppedMessages, FThreadStats::NumDroppedMessages.GetValue());
+			SET_DWORD_STAT(STAT_StatDroppedPackets, FThreadStats::NumDroppedPackets.GetValue());
+			for (int32 Index = 0; Index < NowData.Packets.Num(); ++Index)
+			{
+				// packets are only expanded once we actually get to them
+				FStatPacket* Packet = NowData.Packets[Index];
+				FThreadStats::PendingPacketsSize.Subtract(Packet->GetMessagesSize());
+				Packet->Uncompact();
+			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_StatsNewParseMeta);
 				TArray<FStatMessage> MetaMessages;
@@ -757,12 +965,12 @@ public:
 	{
 		if (CVarDumpStatPackets.GetValueOnAnyThread())
 		{
-			UE_LOG(LogStats, Log, TEXT("Packet from %x with %d messages"), Packet->ThreadId, Packet->StatMessages.Num());
+			UE_LOG(LogStats, Log, TEXT("Packet from %x with %d messages"), Packet->ThreadId, Packet->GetNumMessages());
 		}
 
 		bReadyToProcess = Packet->ThreadType != EThreadType::Other;
 		IncomingData.Packets.Add(Packet);
-		State.NumStatMessages.Add(Packet->StatMessages.Num());
+		State.NumStatMessages.Add(Packet->GetNumMessages());
 
 		Tick();
 	}
@@ -843,10 +1051,40 @@ FThreadSafeCounter FThreadStats::MasterDisableChangeTagLock;
 bool FThreadStats::bMasterEnable = false;
 bool FThreadStats::bMasterDisableForever = false;
 bool FThreadStats::bIsRawStatsActive = false;
+int32 FThreadStats::MaxMessagesPerThread = 1024*1024;
+FThreadSafeCounter FThreadStats::NumDroppedMessages;
+FThreadSafeCounter FThreadStats::NumDroppedPackets;
+FThreadSafeCounter FThreadStats::PendingPacketsSize;
+
+static FAutoConsoleVariableRef CVarStatsMaxMessagesPerThread(
+	TEXT("stats.MaxMessagesPerThread"),
+	FThreadStats::MaxMessagesPerThread,
+	TEXT("Maximum number of stat messages a thread can collect between two flushes, 16 bytes each.\n")
+	TEXT("Messages over the limit are dropped (whole cycle scopes at a time) and counted in STAT_StatDroppedMessages."),
+	ECVF_Default
+	);
+
+static int32 GStatsMaxPendingPacketsMB = 256;
+static FAutoConsoleVariableRef CVarStatsMaxPendingPacketsMB(
+	TEXT("stats.MaxPendingPacketsMB"),
+	GStatsMaxPendingPacketsMB,
+	TEXT("Maximum memory in MB used by stat packets waiting for the stats thread, 0 for no limit.\n")
+	TEXT("When the stats thread falls further behind, packets from threads other than the game and render thread are dropped."),
+	ECVF_Default
+	);
+
+static int32 GStatsCompactPackets = 1;
+static FAutoConsoleVariableRef CVarStatsCompactPackets(
+	TEXT("stats.CompactPackets"),
+	GStatsCompactPackets,
+	TEXT("If true, stat packets are stored in a compact format until the stats thread processes them."),
+	ECVF_Default
+	);
 
 FThreadStats::FThreadStats():
 	CurrentGameFrame(FStats::GameThreadStatsFrame),
 	ScopeCount(0), 
+	DroppedScopeCount(0),
 	bWaitForExplicitFlush(0),
 	MemoryMessageScope(0),
 	bReentranceGuard(false),
@@ -861,6 +1099,7 @@ FThreadStats::FThreadStats():
 FThreadStats::FThreadStats( EConstructor ):
 	CurrentGameFrame(-1),
 	ScopeCount(0), 
+	DroppedScopeCount(0),
 	bWaitForExplicitFlush(0),
 	MemoryMessageScope(0),
 	bReentranceGuard(false),
@@ -949,11 +1188,37 @@ void FThreadStats::FlushRegularStats( bool bHasBrokenCallstacks, bool bForceFlus
 			Packet.StatMessages.Empty(MaxPresize);
 		}
 
-		TGraphTask<FStatMessagesTask>::CreateTask().ConstructAndDispatchWhenReady(ToSend);
+		SendPacket(ToSend);
 		UpdateExplicitFlush();
 	}
 }
 
+void FThreadStats::SendPacket( FStatPacket* ToSend )
+{
+	if (GStatsCompactPackets)
+	{
+		ToSend->Compact();
+	}
+
+	const int32 PacketSize = ToSend->GetMessagesSize();
+	const int32 MaxPendingSize = GStatsMaxPendingPacketsMB * 1024 * 1024;
+	// Game and render thread packets advance the stats frames, so they can't be dropped. There is only one of each per frame anyway.
+	// Raw stats packets are flushed in the middle of cycle scopes, dropping one would break the callstacks of the next ones.
+	if (MaxPendingSize > 0 && ToSend->ThreadType == EThreadType::Other && !bIsRawStatsActive && PendingPacketsSize.GetValue() + PacketSize > MaxPendingSize)
+	{
+		if (NumDroppedPackets.Increment() == 1)
+		{
+			UE_LOG(LogStats, Warning, TEXT("The stats thread is more than %d MB behind, dropping stat packets. See stats.MaxPendingPacketsMB."), GStatsMaxPendingPacketsMB);
+		}
+		NumDroppedMessages.Add(ToSend->GetNumMessages());
+		delete ToSend;
+		return;
+	}
+
+	PendingPacketsSize.Add(PacketSize);
+	TGraphTask<FStatMessagesTask>::CreateTask().ConstructAndDispatchWhenReady(ToSend);
+}
+
 void FThreadStats::FlushRawStats( bool bHasBrokenCallstacks /*= false*/, bool bForceFlush /*= false*/ )
 {
 	if( bReentranceGuard )
@@ -985,7 +1250,7 @@ void FThreadStats::FlushRawStats( bool bHasBrokenCallstacks /*= false*/, bool bF
 
 		check(!Packet.StatMessages.Num());
 
-		TGraphTask<FStatMessagesTask>::CreateTask().ConstructAndDispatchWhenReady(ToSend);
+		SendPacket(ToSend);
 		UpdateExplicitFlush();
 
 		const float NumMessagesAsMB = NumMessages*sizeof(FStatMessage) / 1024.0f / 1024.0f;
@@ -462,7 +462,7 @@ void FStatPacketArray::Empty()
 
 	for (int32 Index = 0; Index < Packets.Num(); Index++)
 	{
-		State.NumStatMessages.Subtract(Packets[Index]->StatMessages.Num());
+		State.NumStatMessages.Subtract(Packets[Index]->GetNumMessages());
 		delete Packets[Index];
 	}
 	Packets.Empty();
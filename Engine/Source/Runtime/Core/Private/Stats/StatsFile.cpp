@@ -36,11 +36,16 @@ public:
 	/** Data for the file. Moved via Exchange. */
 	TArray<uint8> Data;
 
+	/** Frame range of the data. */
+	FStatsChunkInfo Chunk;
+
 	/** Constructor. */
 	FAsyncStatsWrite( IStatsWriteFile* InStatsWriteFile )
 		: Outer( InStatsWriteFile )
+		, Chunk( InStatsWriteFile->OutDataChunk )
 	{
 		Exchange( Data, InStatsWriteFile->OutData );
+		InStatsWriteFile->OutDataChunk = FStatsChunkInfo();
 	}
 
 	/** Write compressed data to the file. */
@@ -54,8 +59,16 @@ public:
 		const int64 FrameFileOffset = Ar.Tell();
 
 		FCompressedStatsData CompressedData( Data, Outer->CompressedData );
+		if( Outer->Header.HasChunkedData() )
+		{
+			CompressedData.SetChunkFrames( Chunk.FirstFrame, Chunk.LastFrame );
+		}
 		Ar << CompressedData;
 
+		if( CompressedData.IsChunk() )
+		{
+			Outer->ChunksInfo.Add( CompressedData.GetChunkInfo() );
+		}
 		Outer->FinalizeSavingData(FrameFileOffset);
 	}
 
@@ -139,11 +152,15 @@ FStatsThreadState::FStatsThreadState( FString const& Filename )
 			FMemoryReader MemoryReader( DestData, true );
 			FArchive& Archive = bHasCompressedData ? MemoryReader : *FileReader;
 
-			FStatPacket StatPacket;
-			Stream.ReadStatPacket( MemoryReader, StatPacket );
-			// Process the raw stat messages.
-			NumReadStatPackets++;
+			// Chunked data may contain more than one packet.
+			while( MemoryReader.Tell() < MemoryReader.TotalSize() )
+			{
+				FStatPacket StatPacket;
+				Stream.ReadStatPacket( MemoryReader, StatPacket );
+				// Process the raw stat messages.
+				NumReadStatPackets++;
 			}
+		}
 	
 		UE_LOG( LogStats, Log, TEXT( "File: %s has %i stat packets" ), *Filename, NumReadStatPackets );
 	}
@@ -320,13 +337,22 @@ void IStatsWriteFile::WriteHeader()
 	Ar << Magic;
 
 	// Serialize dummy header, overwritten in Finalize.
-	Header.Version = EStatMagicWithHeader::VERSION_5;
+	Header.Version = EStatMagicWithHeader::VERSION_6;
 	Header.PlatformName = FPlatformProperties::PlatformName();
 	//Header.bRawStatsFile = bIsRawStatsFile;
 	Ar << Header;
 
 	// Serialize metadata.
 	WriteMetadata( Ar );
+
+	if( File )
+	{
+		// Store where the chunks start, so the data can be read even if the file never gets finalized.
+		Header.DataOffset = Ar.Tell();
+		Ar.Seek( sizeof(uint32) );
+		Ar << Header;
+		Ar.Seek( Header.DataOffset );
+	}
 	Ar.Flush();
 }
 
@@ -354,6 +380,10 @@ void IStatsWriteFile::Finalize()
 	// This is ok to access the frames info, the async write thread is dead.
 	Ar << FramesInfo;
 
+	// Write out chunk table.
+	Header.ChunkTableOffset = Ar.Tell();
+	Ar << ChunksInfo;
+
 	const FStatsThreadState& Stats = FStatsThreadState::GetLocalState();
 
 	// Add FNames from the stats metadata.
@@ -502,9 +532,13 @@ void FRawStatsWriteFile::WriteRawStatPacket( const FStatPacket* StatPacket )
 {
 	FMemoryWriter Ar( OutData, false, true );
 
-	// Write stat packet.
+	// Write stat packet, packets are batched into chunks.
+	OutDataChunk.AddFrame( StatPacket->Frame );
 	WriteStatPacket( Ar, (FStatPacket&)*StatPacket );
-	SendTask();
+	if( OutData.Num() >= EStatsFileConstants::TARGET_CHUNK_SIZE )
+	{
+		SendTask();
+	}
 }
 
 void FRawStatsWriteFile::WriteStatPacket( FArchive& Ar, FStatPacket& StatPacket )
@@ -524,6 +558,261 @@ void FRawStatsWriteFile::WriteStatPacket( FArchive& Ar, FStatPacket& StatPacket
 	}
 }
 
+/*-----------------------------------------------------------------------------
+	FStatsReadFile
+-----------------------------------------------------------------------------*/
+
+bool FStatsReadFile::Open( const FString& Filename )
+{
+	Close();
+
+	FileReader = IFileManager::Get().CreateFileReader( *Filename );
+	if( !FileReader )
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not open: %s" ), *Filename );
+		return false;
+	}
+
+	if( !Stream.ReadHeader( *FileReader ) )
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not open, bad magic: %s" ), *Filename );
+		Close();
+		return false;
+	}
+
+	if( !Stream.Header.HasChunkedData() || !Stream.Header.DataOffset )
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not open, no chunked data: %s (version %u)" ), *Filename, Stream.Header.Version );
+		Close();
+		return false;
+	}
+
+	if( Stream.Header.IsFinalized() && Stream.Header.ChunkTableOffset > 0 )
+	{
+		Stream.ReadFNamesAndMetadataMessages( *FileReader, MetadataMessages );
+
+		FileReader->Seek( Stream.Header.ChunkTableOffset );
+		*FileReader << Chunks;
+
+		// The FName table has the FNames of all chunks.
+		NumChunksWithFNames = Chunks.Num();
+	}
+	else
+	{
+		// Only the metadata written with the header is available, it ends where the data starts.
+		while( FileReader->Tell() < (int64)Stream.Header.DataOffset )
+		{
+			new(MetadataMessages) FStatMessage( Stream.ReadMessage( *FileReader, false ) );
+		}
+
+		ScanChunks();
+		UE_LOG( LogStats, Warning, TEXT( "Stats file was not finalized, recovered %i chunks: %s" ), Chunks.Num(), *Filename );
+	}
+
+	if( FileReader->IsError() )
+	{
+		UE_LOG( LogStats, Error, TEXT( "Could not read: %s" ), *Filename );
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void FStatsReadFile::Close()
+{
+	delete FileReader;
+	FileReader = nullptr;
+
+	Stream = FStatsReadStream();
+	MetadataMessages.Empty();
+	Chunks.Empty();
+	NumChunksWithFNames = 0;
+}
+
+void FStatsReadFile::ScanChunks()
+{
+	const int64 FileSize = FileReader->TotalSize();
+	const int64 ChunkHeaderSize = sizeof(int32) + sizeof(int64) * 2 + sizeof(int32) * 3;
+
+	FileReader->Seek( Stream.Header.DataOffset );
+	while( FileReader->Tell() + ChunkHeaderSize <= FileSize )
+	{
+		FStatsChunkInfo Chunk;
+		Chunk.FileOffset = FileReader->Tell();
+
+		int32 Marker = 0;
+		*FileReader << Marker;
+		if( Marker != EStatsFileConstants::CHUNK_MARKER )
+		{
+			// End of the data.
+			break;
+		}
+
+		Chunk.SerializeHeader( *FileReader );
+		*FileReader << Chunk.CompressedSize << Chunk.UncompressedSize;
+		if( Chunk.CompressedSize < 0 || FileReader->Tell() + Chunk.CompressedSize > FileSize )
+		{
+			// Truncated chunk.
+			break;
+		}
+
+		Chunks.Add( Chunk );
+		FileReader->Seek( FileReader->Tell() + Chunk.CompressedSize );
+	}
+}
+
+int64 FStatsReadFile::GetFirstFrame() const
+{
+	int64 FirstFrame = -1;
+	for( const FStatsChunkInfo& Chunk : Chunks )
+	{
+		FirstFrame = FirstFrame < 0 ? Chunk.FirstFrame : FMath::Min( FirstFrame, Chunk.FirstFrame );
+	}
+	return FirstFrame;
+}
+
+int64 FStatsReadFile::GetLastFrame() const
+{
+	int64 LastFrame = -1;
+	for( const FStatsChunkInfo& Chunk : Chunks )
+	{
+		LastFrame = FMath::Max( LastFrame, Chunk.LastFrame );
+	}
+	return LastFrame;
+}
+
+void FStatsReadFile::FindChunks( int64 FirstFrame, int64 LastFrame, TArray<int32>& out_ChunkIndices ) const
+{
+	for( int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ChunkIndex++ )
+	{
+		if( Chunks[ChunkIndex].Overlaps( FirstFrame, LastFrame ) )
+		{
+			out_ChunkIndices.Add( ChunkIndex );
+		}
+	}
+}
+
+bool FStatsReadFile::ReadChunk( int32 ChunkIndex, TArray<uint8>& out_Data )
+{
+	check( FileReader && Chunks.IsValidIndex( ChunkIndex ) );
+	const FStatsChunkInfo& Chunk = Chunks[ChunkIndex];
+
+	// Verify the chunk header, it has to match the chunk table.
+	FStatsChunkInfo ChunkHeader;
+	int32 Marker = 0;
+	FileReader->Seek( Chunk.FileOffset );
+	*FileReader << Marker;
+	ChunkHeader.SerializeHeader( *FileReader );
+	*FileReader << ChunkHeader.CompressedSize << ChunkHeader.UncompressedSize;
+	if( Marker != EStatsFileConstants::CHUNK_MARKER || ChunkHeader.CompressedSize != Chunk.CompressedSize || ChunkHeader.UncompressedSize != Chunk.UncompressedSize )
+	{
+		UE_LOG( LogStats, Warning, TEXT( "Corrupted stats chunk at offset %lld" ), Chunk.FileOffset );
+		return false;
+	}
+
+	if( !FCompressedStatsData::ReadChunkData( *FileReader, Chunk, CompressedData, out_Data ) )
+	{
+		UE_LOG( LogStats, Warning, TEXT( "Could not read stats chunk at offset %lld" ), Chunk.FileOffset );
+		return false;
+	}
+	return true;
+}
+
+bool FStatsReadFile::ReadFNamesBeforeChunk( int32 ChunkIndex )
+{
+	// Each FName is only sent with the first message using it, read the chunks in order until all FNames are known.
+	bool bResult = true;
+	for( ; NumChunksWithFNames < ChunkIndex; NumChunksWithFNames++ )
+	{
+		if( !ReadChunk( NumChunksWithFNames, UncompressedData ) )
+		{
+			bResult = false;
+			continue;
+		}
+
+		FMemoryReader MemoryReader( UncompressedData, true );
+		while( MemoryReader.Tell() < MemoryReader.TotalSize() )
+		{
+			if( Stream.Header.bRawStatsFile )
+			{
+				FStatPacket StatPacket;
+				Stream.ReadStatPacket( MemoryReader, StatPacket, false );
+			}
+			else
+			{
+				Stream.ReadMessage( MemoryReader, false );
+			}
+		}
+	}
+	return bResult;
+}
+
+bool FStatsReadFile::ReadStatPackets( int64 FirstFrame, int64 LastFrame, FStatPacketArray& out_Packets )
+{
+	check( Stream.Header.bRawStatsFile );
+
+	TArray<int32> ChunkIndices;
+	FindChunks( FirstFrame, LastFrame, ChunkIndices );
+
+	bool bResult = true;
+	for( const int32 ChunkIndex : ChunkIndices )
+	{
+		bResult &= ReadFNamesBeforeChunk( ChunkIndex );
+		if( !ReadChunk( ChunkIndex, UncompressedData ) )
+		{
+			bResult = false;
+			continue;
+		}
+
+		// Reading the chunk data adds the FNames sent in this chunk.
+		NumChunksWithFNames = FMath::Max( NumChunksWithFNames, ChunkIndex + 1 );
+		FMemoryReader MemoryReader( UncompressedData, true );
+		while( MemoryReader.Tell() < MemoryReader.TotalSize() )
+		{
+			FStatPacket* StatPacket = new FStatPacket();
+			Stream.ReadStatPacket( MemoryReader, *StatPacket, false );
+			if( StatPacket->Frame >= FirstFrame && StatPacket->Frame <= LastFrame )
+			{
+				out_Packets.Packets.Add( StatPacket );
+			}
+			else
+			{
+				delete StatPacket;
+			}
+		}
+	}
+	return bResult;
+}
+
+bool FStatsReadFile::ReadMessages( int64 FirstFrame, int64 LastFrame, TArray<FStatMessage>& out_Messages )
+{
+	check( !Stream.Header.bRawStatsFile );
+
+	TArray<int32> ChunkIndices;
+	FindChunks( FirstFrame, LastFrame, ChunkIndices );
+
+	bool bResult = true;
+	for( const int32 ChunkIndex : ChunkIndices )
+	{
+		bResult &= ReadFNamesBeforeChunk( ChunkIndex );
+		if( !ReadChunk( ChunkIndex, UncompressedData ) )
+		{
+			bResult = false;
+			continue;
+		}
+
+		// Each chunk of the regular stats holds the messages of one frame, reading it adds the FNames sent in it.
+		NumChunksWithFNames = FMath::Max( NumChunksWithFNames, ChunkIndex + 1 );
+		FMemoryReader MemoryReader( UncompressedData, true );
+		while( MemoryReader.Tell() < MemoryReader.TotalSize() )
+		{
+			new(out_Messages) FStatMessage( Stream.ReadMessage( MemoryReader, false ) );
+		}
+	}
+	return bResult;
+}
+
 /*-----------------------------------------------------------------------------
 	Commands functionality
 -----------------------------------------------------------------------------*/;
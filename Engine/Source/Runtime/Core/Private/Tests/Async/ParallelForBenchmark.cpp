@@ -0,0 +1,85 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "ParallelFor.h"
+#include "TaskGraphInterfaces.h"
+#include "AutomationTest.h"
+
+
+/**
+ * Compares ParallelFor against a plain loop, for loops of different lengths with the same total amount of work, and for
+ * loops where the cost of an index grows with the index, which a fixed split over the threads would balance poorly.
+ */
+namespace ParallelForBenchmark
+{
+	/** Total number of work units of every loop. */
+	const int32 NumUnits = 1 << 22;
+
+	/** Number of times each loop is run, the fastest run counts. */
+	const int32 NumRuns = 5;
+
+	/** Does a number of units of work that the compiler can't remove. */
+	FORCEINLINE float DoWork(int32 Index, int32 Units)
+	{
+		float Value = (float)Index;
+		for (int32 Unit = 0; Unit < Units; Unit++)
+		{
+			Value = Value * 0.999f + 1.f;
+		}
+		return Value;
+	}
+
+	/** Work units for Index, out of Num indices. */
+	FORCEINLINE int32 GetUnits(int32 Index, int32 Num, bool bUneven)
+	{
+		const int32 AverageUnits = NumUnits / Num;
+		// grows linearly from 0 to twice the average, so the last threads of a fixed split would get most of the work
+		return bUneven ? (2 * AverageUnits * Index) / Num : AverageUnits;
+	}
+
+	/** Returns the time of the fastest of NumRuns runs, in milliseconds. */
+	double Run(int32 Num, bool bUneven, bool bParallel, TArray<float>& Results)
+	{
+		double BestSeconds = MAX_dbl;
+		for (int32 RunIndex = 0; RunIndex < NumRuns; RunIndex++)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			ParallelFor(Num, [&Results, Num, bUneven](int32 Index)
+			{
+				Results[Index] = DoWork(Index, GetUnits(Index, Num, bUneven));
+			}, !bParallel);
+			BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+		}
+		return BestSeconds * 1000.0;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelForBenchmark, "Core.Async.ParallelForBenchmark", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FParallelForBenchmark::RunTest(const FString& Parameters)
+{
+	if (!FPlatformProcess::SupportsMultithreading() || !FTaskGraphInterface::IsRunning())
+	{
+		return true;
+	}
+
+	AddLogItem(FString::Printf(TEXT("%d work units per loop, %d task graph workers, %d cores. Times are the best of %d runs."),
+		ParallelForBenchmark::NumUnits, FTaskGraphInterface::Get().GetNumWorkerThreads(), FPlatformMisc::NumberOfCores(), ParallelForBenchmark::NumRuns));
+
+	TArray<float> Results;
+	for (int32 Num = 16; Num <= ParallelForBenchmark::NumUnits / 4; Num *= 16)
+	{
+		Results.SetNumUninitialized(Num);
+		for (int32 Pass = 0; Pass < 2; Pass++)
+		{
+			const bool bUneven = Pass == 1;
+			const double SerialMs = ParallelForBenchmark::Run(Num, bUneven, false, Results);
+			const double ParallelMs = ParallelForBenchmark::Run(Num, bUneven, true, Results);
+			AddLogItem(FString::Printf(TEXT("%8d indices, %-7s: serial %8.2fms, ParallelFor %8.2fms, %5.2fx"),
+				Num, bUneven ? TEXT("uneven") : TEXT("even"), SerialMs, ParallelMs, SerialMs / FMath::Max(ParallelMs, 0.001)));
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,150 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "ParallelFor.h"
+#include "TaskGraphInterfaces.h"
+#include "AutomationTest.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParallelForTest, "Core.Async.ParallelFor", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+
+bool FParallelForTest::RunTest(const FString& Parameters)
+{
+	// every index must be run exactly once
+	{
+		const int32 Nums[] = { 0, 1, 2, 3, 17, 1000, 100000 };
+
+		for (int32 NumIndex = 0; NumIndex < ARRAY_COUNT(Nums); ++NumIndex)
+		{
+			const int32 Num = Nums[NumIndex];
+			TArray<int32> RunCounts;
+			RunCounts.AddZeroed(Num);
+
+			ParallelFor(Num, [&RunCounts](int32 Index)
+			{
+				RunCounts[Index]++;
+			});
+
+			int32 NumWrong = 0;
+			for (int32 Index = 0; Index < Num; ++Index)
+			{
+				if (RunCounts[Index] != 1)
+				{
+					++NumWrong;
+				}
+			}
+			TestEqual(*FString::Printf(TEXT("Every one of %d indices must be run exactly once"), Num), NumWrong, 0);
+		}
+	}
+
+	// single threaded loops run in order on the calling thread
+	{
+		const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+		TArray<int32> Order;
+		bool bSameThread = true;
+
+		ParallelFor(100, [&](int32 Index)
+		{
+			Order.Add(Index);
+			bSameThread = bSameThread && FPlatformTLS::GetCurrentThreadId() == ThreadId;
+		}, true);
+
+		bool bInOrder = Order.Num() == 100;
+		for (int32 Index = 0; bInOrder && Index < Order.Num(); ++Index)
+		{
+			bInOrder = Order[Index] == Index;
+		}
+		TestTrue(TEXT("Single threaded loops must run in order"), bInOrder);
+		TestTrue(TEXT("Single threaded loops must run on the calling thread"), bSameThread);
+	}
+
+	// the pre work runs once, on the calling thread
+	{
+		const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+		int32 NumPreWorkRuns = 0;
+		bool bPreWorkOnCallingThread = false;
+		FThreadSafeCounter NumRun;
+
+		ParallelForWithPreWork(1000, [&NumRun](int32 Index)
+		{
+			NumRun.Increment();
+		},
+		[&]()
+		{
+			NumPreWorkRuns++;
+			bPreWorkOnCallingThread = FPlatformTLS::GetCurrentThreadId() == ThreadId;
+		});
+
+		TestEqual(TEXT("The pre work must run once"), NumPreWorkRuns, 1);
+		TestTrue(TEXT("The pre work must run on the calling thread"), bPreWorkOnCallingThread);
+		TestEqual(TEXT("The loop must run every index with pre work"), NumRun.GetValue(), 1000);
+	}
+
+	// nested loops
+	{
+		const int32 NumOuter = 64;
+		const int32 NumInner = 256;
+		TArray<int32> Sums;
+		Sums.AddZeroed(NumOuter);
+
+		ParallelFor(NumOuter, [&Sums](int32 OuterIndex)
+		{
+			FThreadSafeCounter Sum;
+			ParallelFor(NumInner, [&Sum](int32 InnerIndex)
+			{
+				Sum.Add(InnerIndex);
+			});
+			Sums[OuterIndex] = Sum.GetValue();
+		});
+
+		int32 NumWrong = 0;
+		for (int32 OuterIndex = 0; OuterIndex < NumOuter; ++OuterIndex)
+		{
+			if (Sums[OuterIndex] != NumInner * (NumInner - 1) / 2)
+			{
+				++NumWrong;
+			}
+		}
+		TestEqual(TEXT("Nested loops must run every inner index"), NumWrong, 0);
+	}
+
+	// loops from tasks, with more tasks than workers so that every worker is busy while they wait
+	if (FTaskGraphInterface::IsRunning())
+	{
+		DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.ParallelForTest"), STAT_FSimpleDelegateGraphTask_ParallelForTest, STATGROUP_TaskGraphTasks);
+
+		const int32 NumTasks = FTaskGraphInterface::Get().GetNumWorkerThreads() * 2 + 1;
+		const int32 Num = 10000;
+		TArray<FThreadSafeCounter> NumRun;
+		NumRun.AddDefaulted(NumTasks);
+
+		FGraphEventArray Tasks;
+		for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+		{
+			FThreadSafeCounter* TaskNumRun = &NumRun[TaskIndex];
+			Tasks.Add(FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+				FSimpleDelegateGraphTask::FDelegate::CreateLambda([TaskNumRun, Num]()
+				{
+					ParallelFor(Num, [TaskNumRun](int32 Index)
+					{
+						TaskNumRun->Increment();
+					});
+				}),
+				GET_STATID(STAT_FSimpleDelegateGraphTask_ParallelForTest), nullptr, ENamedThreads::AnyThread));
+		}
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks, ENamedThreads::GameThread);
+
+		int32 NumWrong = 0;
+		for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+		{
+			if (NumRun[TaskIndex].GetValue() != Num)
+			{
+				++NumWrong;
+			}
+		}
+		TestEqual(TEXT("Loops run from tasks must run every index"), NumWrong, 0);
+	}
+
+	return true;
+}
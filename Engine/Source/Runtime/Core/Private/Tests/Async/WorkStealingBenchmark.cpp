@@ -0,0 +1,237 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "Containers/WorkStealingQueue.h"
+#include "Misc/AutomationTest.h"
+
+
+/**
+ * Compares the task throughput and scheduling latency of one shared lock free queue against per-worker
+ * work stealing queues, which is the change made to the task graph's AnyThread tasks. The task graph
+ * itself can't be restarted with a different number of workers, so this runs its own workers with the
+ * same queue types on a fan-out workload: every task does a little work and spawns a few children,
+ * like animation, physics or particle tasks do.
+ */
+namespace WorkStealingBenchmark
+{
+	/** Number of root tasks, queued from outside of the workers like the game thread does. */
+	const int32 NumRootTasks = 16;
+	/** Children spawned by each task above the last level. */
+	const int32 FanOut = 4;
+	/** Number of levels below the root tasks. */
+	const int32 Depth = 6;
+
+	struct FTask
+	{
+		/** Level of this task, tasks at Depth don't spawn children. */
+		int32 Level;
+		/** Time the task was queued, for the latency. */
+		uint32 QueuedCycles;
+	};
+
+	/** State shared by all workers of one run. */
+	struct FSchedulerState
+	{
+		/** Whether to use the per-worker work stealing queues, otherwise all tasks go to SharedQueue. */
+		bool bWorkStealing;
+		/** Queue for tasks from outside of the workers, and for everything if bWorkStealing is false. */
+		TLockFreePointerList<FTask> SharedQueue;
+		/** Per-worker work stealing queues. */
+		TArray<TWorkStealingQueue<FTask>*> LocalQueues;
+		/** Preallocated tasks so that the allocator doesn't show up in the results. */
+		TArray<FTask> Tasks;
+		/** Next free entry in Tasks. */
+		FThreadSafeCounter NextTask;
+		/** Number of tasks that still have to execute. */
+		FThreadSafeCounter NumRemaining;
+		/** Set when all workers have started. */
+		FThreadSafeCounter Go;
+	};
+
+	/** Total number of tasks of the workload. */
+	int32 GetNumTasks()
+	{
+		int32 TasksPerRoot = 0;
+		for (int32 Level = 0, LevelSize = 1; Level <= Depth; Level++, LevelSize *= FanOut)
+		{
+			TasksPerRoot += LevelSize;
+		}
+		return NumRootTasks * TasksPerRoot;
+	}
+
+	class FWorker
+		: public FRunnable
+	{
+	public:
+
+		FWorker(FSchedulerState& InState, int32 InWorkerIndex)
+			: State(InState)
+			, WorkerIndex(InWorkerIndex)
+			, Sink(0)
+		{
+			Latencies.Reserve(State.Tasks.Num());
+		}
+
+		virtual uint32 Run() override
+		{
+			while (!State.Go.GetValue())
+			{
+				FPlatformProcess::Sleep(0.0f);
+			}
+			while (State.NumRemaining.GetValue() > 0)
+			{
+				FTask* Task = FindTask();
+				if (Task)
+				{
+					Latencies.Add(FPlatformTime::Cycles() - Task->QueuedCycles);
+					Execute(*Task);
+					State.NumRemaining.Decrement();
+				}
+				else
+				{
+					FPlatformProcess::Sleep(0.0f);
+				}
+			}
+			return 0;
+		}
+
+		/** Scheduling latency of every task this worker executed, in cycles. */
+		TArray<uint32> Latencies;
+
+	private:
+
+		FTask* FindTask()
+		{
+			if (!State.bWorkStealing)
+			{
+				return State.SharedQueue.Pop();
+			}
+			FTask* Task = State.LocalQueues[WorkerIndex]->Pop();
+			if (!Task)
+			{
+				Task = State.SharedQueue.Pop();
+			}
+			for (int32 Offset = 1; !Task && Offset < State.LocalQueues.Num(); Offset++)
+			{
+				Task = State.LocalQueues[(WorkerIndex + Offset) % State.LocalQueues.Num()]->Steal();
+			}
+			return Task;
+		}
+
+		void Execute(const FTask& Task)
+		{
+			// a few hundred cycles of work
+			for (int32 Index = 0; Index < 256; Index++)
+			{
+				Sink = Sink * 1664525u + 1013904223u;
+			}
+			if (Task.Level < Depth)
+			{
+				for (int32 Child = 0; Child < FanOut; Child++)
+				{
+					FTask* NewTask = &State.Tasks[State.NextTask.Increment() - 1];
+					NewTask->Level = Task.Level + 1;
+					NewTask->QueuedCycles = FPlatformTime::Cycles();
+					if (!State.bWorkStealing || !State.LocalQueues[WorkerIndex]->Push(NewTask))
+					{
+						State.SharedQueue.Push(NewTask);
+					}
+				}
+			}
+		}
+
+		FSchedulerState& State;
+		int32 WorkerIndex;
+		/** Result of the fake work, kept so that it isn't optimized away. */
+		volatile uint32 Sink;
+	};
+
+	/** Results of one run. */
+	struct FResult
+	{
+		double TasksPerSecond;
+		double MedianLatencyUs;
+		double P99LatencyUs;
+		double MaxLatencyUs;
+	};
+
+	FResult Run(int32 NumWorkers, bool bWorkStealing)
+	{
+		FSchedulerState State;
+		State.bWorkStealing = bWorkStealing;
+		State.Tasks.AddUninitialized(GetNumTasks());
+		State.NumRemaining.Set(State.Tasks.Num());
+
+		TArray<FWorker*> Workers;
+		TArray<FRunnableThread*> Threads;
+		for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+		{
+			State.LocalQueues.Add(new TWorkStealingQueue<FTask>());
+		}
+		for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+		{
+			Workers.Add(new FWorker(State, WorkerIndex));
+			Threads.Add(FRunnableThread::Create(Workers.Last(), *FString::Printf(TEXT("WorkStealingBenchmark %d"), WorkerIndex)));
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		State.Go.Set(1);
+		for (int32 Root = 0; Root < NumRootTasks; Root++)
+		{
+			FTask* Task = &State.Tasks[State.NextTask.Increment() - 1];
+			Task->Level = 0;
+			Task->QueuedCycles = FPlatformTime::Cycles();
+			State.SharedQueue.Push(Task);
+		}
+		for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+		{
+			Threads[WorkerIndex]->WaitForCompletion();
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		TArray<uint32> Latencies;
+		for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+		{
+			Latencies.Append(Workers[WorkerIndex]->Latencies);
+			delete Threads[WorkerIndex];
+			delete Workers[WorkerIndex];
+			delete State.LocalQueues[WorkerIndex];
+		}
+		check(Latencies.Num() == State.Tasks.Num());
+		Latencies.Sort();
+
+		const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+		FResult Result;
+		Result.TasksPerSecond = State.Tasks.Num() / FMath::Max(Seconds, 0.000001);
+		Result.MedianLatencyUs = Latencies[Latencies.Num() / 2] * MicrosecondsPerCycle;
+		Result.P99LatencyUs = Latencies[(Latencies.Num() * 99) / 100] * MicrosecondsPerCycle;
+		Result.MaxLatencyUs = Latencies.Last() * MicrosecondsPerCycle;
+		return Result;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWorkStealingBenchmark, "Core.Async.WorkStealingBenchmark", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FWorkStealingBenchmark::RunTest(const FString& Parameters)
+{
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		return true;
+	}
+
+	AddLogItem(FString::Printf(TEXT("%d tasks, %d cores. Latency is the time from queuing a task to a worker picking it up."), WorkStealingBenchmark::GetNumTasks(), FPlatformMisc::NumberOfCores()));
+	for (int32 NumWorkers = 1; NumWorkers <= 64; NumWorkers *= 2)
+	{
+		for (int32 Pass = 0; Pass < 2; Pass++)
+		{
+			const bool bWorkStealing = Pass == 1;
+			const WorkStealingBenchmark::FResult Result = WorkStealingBenchmark::Run(NumWorkers, bWorkStealing);
+			AddLogItem(FString::Printf(TEXT("%2d workers, %-13s: %10.0f tasks/s, latency median %8.1fus, p99 %8.1fus, max %8.1fus"),
+				NumWorkers, bWorkStealing ? TEXT("work stealing") : TEXT("shared queue"),
+				Result.TasksPerSecond, Result.MedianLatencyUs, Result.P99LatencyUs, Result.MaxLatencyUs));
+		}
+	}
+
+	return true;
+}
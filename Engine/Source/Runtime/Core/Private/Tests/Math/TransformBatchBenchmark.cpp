@@ -0,0 +1,127 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+
+
+/**
+ * Compares the single transform functions of FTransform against the FTransformBatch versions, on
+ * arrays of transforms (FTransform layout) and on data that is kept in the structure-of-arrays layout.
+ * The arrays are the size of the bone arrays of a crowd, so they don't fit in the first level cache
+ * but stay in the second, like bone transforms do while a frame of animation is evaluated.
+ */
+namespace TransformBatchBenchmark
+{
+	/** Number of transforms, 200 characters with 64 bones each. */
+	const int32 NumTransforms = 200 * 64;
+	/** Number of times every operation runs over the arrays. */
+	const int32 NumPasses = 50;
+
+	enum class EOperation
+	{
+		Multiply,
+		Inverse,
+		Blend,
+	};
+
+	enum class EPath
+	{
+		Scalar,
+		Batch,
+		SoA,
+	};
+
+	/** Returns the nanoseconds per transform of one operation. */
+	double Run(EOperation Operation, EPath Path, const TArray<FTransform>& A, const TArray<FTransform>& B, TArray<FTransform>& Out)
+	{
+#if ENABLE_VECTORIZED_TRANSFORM
+		TArray<FTransformSoA> SoA, SoB, SoOut;
+		FTransformBatch::ToSoA(SoA, A.GetData(), A.Num());
+		FTransformBatch::ToSoA(SoB, B.GetData(), B.Num());
+		SoOut.AddUninitialized(SoA.Num());
+#endif
+		const float Alpha = 0.3f;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			switch (Path)
+			{
+			case EPath::Scalar:
+				for (int32 Index = 0; Index < A.Num(); Index++)
+				{
+					switch (Operation)
+					{
+					case EOperation::Multiply:	FTransform::Multiply(&Out[Index], &A[Index], &B[Index]); break;
+					case EOperation::Inverse:	Out[Index] = A[Index].Inverse(); break;
+					case EOperation::Blend:		Out[Index].Blend(A[Index], B[Index], Alpha); break;
+					}
+				}
+				break;
+
+			case EPath::Batch:
+				switch (Operation)
+				{
+				case EOperation::Multiply:	FTransformBatch::Multiply(Out.GetData(), A.GetData(), B.GetData(), A.Num()); break;
+				case EOperation::Inverse:	FTransformBatch::Inverse(Out.GetData(), A.GetData(), A.Num()); break;
+				case EOperation::Blend:		FTransformBatch::Blend(Out.GetData(), A.GetData(), B.GetData(), Alpha, A.Num()); break;
+				}
+				break;
+
+			case EPath::SoA:
+#if ENABLE_VECTORIZED_TRANSFORM
+				switch (Operation)
+				{
+				case EOperation::Multiply:	FTransformBatch::Multiply(SoOut.GetData(), SoA.GetData(), SoB.GetData(), SoA.Num()); break;
+				case EOperation::Inverse:	FTransformBatch::Inverse(SoOut.GetData(), SoA.GetData(), SoA.Num()); break;
+				case EOperation::Blend:		FTransformBatch::Blend(SoOut.GetData(), SoA.GetData(), SoB.GetData(), Alpha, SoA.Num()); break;
+				}
+#endif
+				break;
+			}
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		return Seconds * 1000000000.0 / ((double)NumPasses * A.Num());
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTransformBatchBenchmark, "Core.Math.TransformBatchBenchmark", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FTransformBatchBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace TransformBatchBenchmark;
+
+	FRandomStream RandomStream(0x7b47);
+	TArray<FTransform> A, B, Out;
+	for (int32 Index = 0; Index < NumTransforms; Index++)
+	{
+		A.Add(FTransform(FQuat(RandomStream.GetUnitVector(), RandomStream.FRandRange(-PI, PI)), RandomStream.GetUnitVector() * 100.0f, FVector(RandomStream.FRandRange(0.5f, 2.0f))));
+		B.Add(FTransform(FQuat(RandomStream.GetUnitVector(), RandomStream.FRandRange(-PI, PI)), RandomStream.GetUnitVector() * 100.0f, FVector(RandomStream.FRandRange(0.5f, 2.0f))));
+	}
+	Out.AddUninitialized(NumTransforms);
+
+	const TCHAR* OperationNames[] = { TEXT("Multiply"), TEXT("Inverse"), TEXT("Blend") };
+	AddLogItem(FString::Printf(TEXT("%d transforms, %d passes. Times are per transform, the SoA times don't include converting the layout."), NumTransforms, NumPasses));
+	for (int32 OperationIndex = 0; OperationIndex < ARRAY_COUNT(OperationNames); OperationIndex++)
+	{
+		const EOperation Operation = (EOperation)OperationIndex;
+		// warm up the caches
+		Run(Operation, EPath::Scalar, A, B, Out);
+
+		const double ScalarNs = Run(Operation, EPath::Scalar, A, B, Out);
+		const double BatchNs = Run(Operation, EPath::Batch, A, B, Out);
+#if ENABLE_VECTORIZED_TRANSFORM
+		const double SoANs = Run(Operation, EPath::SoA, A, B, Out);
+#else
+		const double SoANs = 0.0;
+#endif
+		AddLogItem(FString::Printf(TEXT("%-8s: scalar %6.2fns, batch %6.2fns (%4.2fx), SoA %6.2fns (%4.2fx)"),
+			OperationNames[OperationIndex], ScalarNs,
+			BatchNs, ScalarNs / FMath::Max(BatchNs, 0.001),
+			SoANs, ScalarNs / FMath::Max(SoANs, 0.001)));
+	}
+
+	return true;
+}
@@ -0,0 +1,184 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+
+
+namespace TransformBatchTest
+{
+	/** Batch results are computed with a different order of operations, translations are within +-100. */
+	const float Tolerance = 0.001f;
+
+	FTransform RandomTransform(FRandomStream& RandomStream)
+	{
+		const FQuat Rotation = FQuat(RandomStream.GetUnitVector(), RandomStream.FRandRange(-PI, PI));
+		const FVector Translation = RandomStream.GetUnitVector() * RandomStream.FRandRange(0.0f, 100.0f);
+		const FVector Scale3D(RandomStream.FRandRange(0.5f, 2.0f), RandomStream.FRandRange(0.5f, 2.0f), RandomStream.FRandRange(0.5f, 2.0f));
+		return FTransform(Rotation, Translation, Scale3D);
+	}
+
+	/** Counts the entries of Actual that don't match Expected. */
+	int32 CountMismatches(const TArray<FTransform>& Expected, const TArray<FTransform>& Actual)
+	{
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Expected.Num(); Index++)
+		{
+			if (!Expected[Index].Equals(Actual[Index], Tolerance))
+			{
+				NumMismatches++;
+			}
+		}
+		return NumMismatches;
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTransformBatchTest, "Core.Math.TransformBatch", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FTransformBatchTest::RunTest( const FString& Parameters )
+{
+	using namespace TransformBatchTest;
+
+	// not a multiple of the batch width, so that the scalar tails are covered too
+	const int32 Num = 37;
+
+	FRandomStream RandomStream(0x7b47);
+	TArray<FTransform> A, B;
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		A.Add(RandomTransform(RandomStream));
+		B.Add(RandomTransform(RandomStream));
+	}
+	// zero scale must invert to the identity like FTransform::Inverse does
+	A[5].SetScale3D(FVector::ZeroVector);
+
+	TArray<FTransform> Expected, Actual;
+	Expected.AddUninitialized(Num);
+	Actual.AddUninitialized(Num);
+
+	// multiply
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		FTransform::Multiply(&Expected[Index], &A[Index], &B[Index]);
+	}
+	FTransformBatch::Multiply(Actual.GetData(), A.GetData(), B.GetData(), Num);
+	TestEqual(TEXT("Multiply must match the scalar path"), CountMismatches(Expected, Actual), 0);
+
+	// in place multiply
+	Actual = A;
+	FTransformBatch::Multiply(Actual.GetData(), Actual.GetData(), B.GetData(), Num);
+	TestEqual(TEXT("Multiply must work in place"), CountMismatches(Expected, Actual), 0);
+
+	// inverse
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		Expected[Index] = A[Index].Inverse();
+	}
+	FTransformBatch::Inverse(Actual.GetData(), A.GetData(), Num);
+	TestEqual(TEXT("Inverse must match the scalar path"), CountMismatches(Expected, Actual), 0);
+
+	// blend, including the alphas that copy
+	const float Alphas[] = { 0.0f, 0.3f, 1.0f };
+	for (const float Alpha : Alphas)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Expected[Index].Blend(A[Index], B[Index], Alpha);
+		}
+		FTransformBatch::Blend(Actual.GetData(), A.GetData(), B.GetData(), Alpha, Num);
+		TestEqual(*FString::Printf(TEXT("Blend with alpha %.1f must match the scalar path"), Alpha), CountMismatches(Expected, Actual), 0);
+	}
+
+	// bone hierarchy converted to component space one depth level at a time
+	{
+		TArray<int32> Parents;
+		Parents.Add(INDEX_NONE);
+		for (int32 Index = 1; Index < Num; Index++)
+		{
+			Parents.Add(RandomStream.RandHelper(Index));
+		}
+
+		Expected[0] = Actual[0] = A[0];
+		for (int32 Index = 1; Index < Num; Index++)
+		{
+			FTransform::Multiply(&Expected[Index], &A[Index], &Expected[Parents[Index]]);
+		}
+
+		TArray<int32> Depths;
+		Depths.Add(0);
+		int32 MaxDepth = 0;
+		for (int32 Index = 1; Index < Num; Index++)
+		{
+			Depths.Add(Depths[Parents[Index]] + 1);
+			MaxDepth = FMath::Max(MaxDepth, Depths.Last());
+		}
+		for (int32 Depth = 1; Depth <= MaxDepth; Depth++)
+		{
+			TArray<int32> Indices, ParentIndices;
+			for (int32 Index = 1; Index < Num; Index++)
+			{
+				if (Depths[Index] == Depth)
+				{
+					Indices.Add(Index);
+					ParentIndices.Add(Parents[Index]);
+				}
+			}
+			FTransformBatch::MultiplyIndexed(Actual.GetData(), A.GetData(), Indices.GetData(), ParentIndices.GetData(), Indices.Num());
+		}
+		// errors accumulate down the hierarchy, which isn't any different from the scalar path
+		int32 NumMismatches = 0;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			if (!Expected[Index].Equals(Actual[Index], Tolerance * (Depths[Index] + 1)))
+			{
+				NumMismatches++;
+			}
+		}
+		TestEqual(TEXT("MultiplyIndexed must match the scalar path"), NumMismatches, 0);
+	}
+
+#if ENABLE_VECTORIZED_TRANSFORM
+	// structure-of-arrays layout
+	{
+		TArray<FTransformSoA> SoA, SoB, SoOut;
+		FTransformBatch::ToSoA(SoA, A.GetData(), Num);
+		FTransformBatch::ToSoA(SoB, B.GetData(), Num);
+		TestEqual(TEXT("The last block must be padded"), SoA.Num(), (Num + FTransformBatch::Width - 1) / FTransformBatch::Width);
+
+		FTransformBatch::FromSoA(Actual.GetData(), SoA, Num);
+		bool bExact = true;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			bExact &= Actual[Index].GetRotation() == A[Index].GetRotation() && Actual[Index].GetTranslation() == A[Index].GetTranslation() && Actual[Index].GetScale3D() == A[Index].GetScale3D();
+		}
+		TestTrue(TEXT("Converting to the structure-of-arrays layout and back must be exact"), bExact);
+
+		SoOut.AddUninitialized(SoA.Num());
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			FTransform::Multiply(&Expected[Index], &A[Index], &B[Index]);
+		}
+		FTransformBatch::Multiply(SoOut.GetData(), SoA.GetData(), SoB.GetData(), SoA.Num());
+		FTransformBatch::FromSoA(Actual.GetData(), SoOut, Num);
+		TestEqual(TEXT("Structure-of-arrays Multiply must match the scalar path"), CountMismatches(Expected, Actual), 0);
+
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Expected[Index] = A[Index].Inverse();
+		}
+		FTransformBatch::Inverse(SoOut.GetData(), SoA.GetData(), SoA.Num());
+		FTransformBatch::FromSoA(Actual.GetData(), SoOut, Num);
+		TestEqual(TEXT("Structure-of-arrays Inverse must match the scalar path"), CountMismatches(Expected, Actual), 0);
+
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Expected[Index].Blend(A[Index], B[Index], 0.3f);
+		}
+		FTransformBatch::Blend(SoOut.GetData(), SoA.GetData(), SoB.GetData(), 0.3f, SoA.Num());
+		FTransformBatch::FromSoA(Actual.GetData(), SoOut, Num);
+		TestEqual(TEXT("Structure-of-arrays Blend must match the scalar path"), CountMismatches(Expected, Actual), 0);
+	}
+#endif // ENABLE_VECTORIZED_TRANSFORM
+
+	return true;
+}
@@ -0,0 +1,79 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCompressionTest, "Core.Misc.Compression", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FCompressionTest::RunTest( const FString& Parameters )
+{
+	// format registry
+	TestTrue(TEXT("ZLIB must be available"), FCompression::IsFormatAvailable(COMPRESS_ZLIB));
+	TestTrue(TEXT("LZ4 must be available"), FCompression::IsFormatAvailable(COMPRESS_LZ4));
+	TestEqual(TEXT("Formats must be found by name"), (int32)FCompression::GetFormatFromName(TEXT("lz4")), (int32)COMPRESS_LZ4);
+	TestEqual(TEXT("Unknown format names must return COMPRESS_None"), (int32)FCompression::GetFormatFromName(TEXT("Unknown")), (int32)COMPRESS_None);
+
+	// test data: incompressible, repetitive with overlapping matches, and mixed
+	TArray<TArray<uint8>> Buffers;
+	FRandomStream RandomStream(0x1234);
+	const int32 Sizes[] = { 0, 1, 12, 13, 4096, (int32)FCompression::MaxUncompressedSize };
+	Buffers.Reserve(ARRAY_COUNT(Sizes) * 3);
+	for (int32 SizeIndex = 0; SizeIndex < ARRAY_COUNT(Sizes); SizeIndex++)
+	{
+		const int32 Size = Sizes[SizeIndex];
+		TArray<uint8>& Random = Buffers[Buffers.AddDefaulted()];
+		TArray<uint8>& Repetitive = Buffers[Buffers.AddDefaulted()];
+		TArray<uint8>& Mixed = Buffers[Buffers.AddDefaulted()];
+		for (int32 Index = 0; Index < Size; Index++)
+		{
+			Random.Add((uint8)RandomStream.RandHelper(256));
+			Repetitive.Add((uint8)(Index % 3));
+			Mixed.Add((Index > 16 && RandomStream.RandHelper(8) != 0) ? Mixed[Index - 1 - RandomStream.RandHelper(16)] : (uint8)RandomStream.RandHelper(4));
+		}
+	}
+
+	const ECompressionFlags Formats[] = { COMPRESS_ZLIB, COMPRESS_LZ4 };
+	for (int32 FormatIndex = 0; FormatIndex < ARRAY_COUNT(Formats); FormatIndex++)
+	{
+		const ECompressionFlags Format = Formats[FormatIndex];
+		for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); BufferIndex++)
+		{
+			const TArray<uint8>& Source = Buffers[BufferIndex];
+			if (Source.Num() == 0 && Format == COMPRESS_ZLIB)
+			{
+				continue;
+			}
+
+			int32 CompressedSize = FCompression::CompressMemoryBound(Format, Source.Num());
+			TArray<uint8> Compressed;
+			Compressed.AddUninitialized(CompressedSize);
+			const bool bCompressed = FCompression::CompressMemory(Format, Compressed.GetData(), CompressedSize, Source.GetData(), Source.Num());
+			TestTrue(FString::Printf(TEXT("%s must compress %d bytes"), FCompression::GetFormatName(Format), Source.Num()), bCompressed);
+			if (!bCompressed)
+			{
+				continue;
+			}
+
+			TArray<uint8> Uncompressed;
+			Uncompressed.AddZeroed(Source.Num());
+			TestTrue(FString::Printf(TEXT("%s must uncompress %d bytes"), FCompression::GetFormatName(Format), Source.Num()), FCompression::UncompressMemory(Format, Uncompressed.GetData(), Uncompressed.Num(), Compressed.GetData(), CompressedSize));
+			TestTrue(FString::Printf(TEXT("%s must round trip %d bytes"), FCompression::GetFormatName(Format), Source.Num()), Uncompressed == Source);
+		}
+	}
+
+	// LZ4 must reject data that doesn't decompress to the expected size instead of overrunning the buffer
+	{
+		const TArray<uint8>& Source = Buffers[Buffers.Num() - 2];
+		int32 CompressedSize = FCompression::CompressMemoryBound(COMPRESS_LZ4, Source.Num());
+		TArray<uint8> Compressed;
+		Compressed.AddUninitialized(CompressedSize);
+		FCompression::CompressMemory(COMPRESS_LZ4, Compressed.GetData(), CompressedSize, Source.GetData(), Source.Num());
+
+		TArray<uint8> Uncompressed;
+		Uncompressed.AddZeroed(Source.Num() / 2);
+		TestFalse(TEXT("LZ4 must fail when the output buffer is too small"), FCompression::UncompressMemory(COMPRESS_LZ4, Uncompressed.GetData(), Uncompressed.Num(), Compressed.GetData(), CompressedSize));
+	}
+
+	return true;
+}
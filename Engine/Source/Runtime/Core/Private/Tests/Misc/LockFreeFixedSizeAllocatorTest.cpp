@@ -0,0 +1,118 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "LockFreeFixedSizeAllocator.h"
+#include "ParallelFor.h"
+#include "AutomationTest.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLockFreeFixedSizeAllocatorTLSCacheTest, "Core.Misc.LockFreeFixedSizeAllocatorTLSCache", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+
+bool FLockFreeFixedSizeAllocatorTLSCacheTest::RunTest(const FString& Parameters)
+{
+	const int32 BlockSize = 64;
+	const int32 NumPerBundle = 4;
+
+	// blocks are distinct while in use, and reused once freed
+	{
+		TLockFreeFixedSizeAllocator_TLSCache<BlockSize, NumPerBundle, FThreadSafeCounter> Allocator;
+
+		TArray<void*> Blocks;
+		for (int32 Index = 0; Index < NumPerBundle * 3 + 1; Index++)
+		{
+			Blocks.Add(Allocator.Allocate());
+		}
+		TSet<void*> UniqueBlocks;
+		UniqueBlocks.Append(Blocks);
+		TestEqual(TEXT("Blocks in use must be distinct"), UniqueBlocks.Num(), Blocks.Num());
+		TestEqual(TEXT("Threads take blocks by the bundle"), Allocator.GetNumUsed().GetValue(), NumPerBundle * 4);
+
+		for (int32 Index = 0; Index < Blocks.Num(); Index++)
+		{
+			Allocator.Free(Blocks[Index]);
+		}
+		TestEqual(TEXT("Threads give full bundles back beyond the two they cache"), Allocator.GetNumFree().GetValue(), NumPerBundle * 2);
+
+		bool bReused = true;
+		for (int32 Index = 0; Index < Blocks.Num(); Index++)
+		{
+			bReused = bReused && UniqueBlocks.Contains(Allocator.Allocate());
+		}
+		TestTrue(TEXT("Freed blocks must be reused"), bReused);
+	}
+
+	// spare bundles beyond the cap go back to the shared list, and a thread that flushes its cache gives back every block
+	{
+		TLockFreeFixedSizeAllocator_TLSCache<BlockSize, NumPerBundle, FThreadSafeCounter> Allocator(0);
+
+		TArray<void*> Blocks;
+		for (int32 Index = 0; Index < NumPerBundle * 2; Index++)
+		{
+			Blocks.Add(Allocator.Allocate());
+		}
+		for (int32 Index = 0; Index < Blocks.Num(); Index++)
+		{
+			Allocator.Free(Blocks[Index]);
+		}
+		TestEqual(TEXT("Threads must not keep spare bundles beyond the cap"), Allocator.GetNumFree().GetValue(), NumPerBundle);
+
+		Allocator.FlushThreadLocalCache();
+		TestEqual(TEXT("Flushed blocks must be back on the shared list"), Allocator.GetNumFree().GetValue(), NumPerBundle * 2);
+		TestEqual(TEXT("Flushed blocks must not be counted as used"), Allocator.GetNumUsed().GetValue(), 0);
+
+		Allocator.Free(Allocator.Allocate());
+		TestEqual(TEXT("The allocator must still work after a flush"), Allocator.GetNumUsed().GetValue(), NumPerBundle);
+	}
+
+	// blocks allocated on one thread and freed on others, as command list pages are, are never handed out twice at once
+	{
+		TLockFreeFixedSizeAllocator_TLSCache<BlockSize, NumPerBundle, FThreadSafeCounter> Allocator;
+		const int32 NumLoops = 256;
+		const int32 NumBlocksPerLoop = 37;
+		FThreadSafeCounter NumWrong;
+
+		for (int32 Pass = 0; Pass < 4; Pass++)
+		{
+			TArray<void*> Blocks;
+			for (int32 Index = 0; Index < NumLoops * NumBlocksPerLoop; Index++)
+			{
+				Blocks.Add(Allocator.Allocate());
+			}
+
+			ParallelFor(NumLoops, [&](int32 LoopIndex)
+			{
+				void* const* LoopBlocks = &Blocks[LoopIndex * NumBlocksPerLoop];
+				for (int32 Index = 0; Index < NumBlocksPerLoop; Index++)
+				{
+					FMemory::Memset(LoopBlocks[Index], uint8(LoopIndex), BlockSize);
+				}
+
+				// allocate more on this thread while the blocks are being checked and freed
+				void* Extra[NumBlocksPerLoop];
+				for (int32 Index = 0; Index < NumBlocksPerLoop; Index++)
+				{
+					Extra[Index] = Allocator.Allocate();
+					FMemory::Memset(Extra[Index], 0xff, BlockSize);
+				}
+
+				for (int32 Index = 0; Index < NumBlocksPerLoop; Index++)
+				{
+					const uint8* Block = (const uint8*)LoopBlocks[Index];
+					if (Block[0] != uint8(LoopIndex) || Block[BlockSize - 1] != uint8(LoopIndex))
+					{
+						NumWrong.Increment();
+					}
+					Allocator.Free(LoopBlocks[Index]);
+					Allocator.Free(Extra[Index]);
+				}
+			});
+		}
+
+		TestEqual(TEXT("No block must be handed out twice at once"), NumWrong.GetValue(), 0);
+		TestEqual(TEXT("Every block must be counted as used or free"),
+			(Allocator.GetNumUsed().GetValue() + Allocator.GetNumFree().GetValue()) % NumPerBundle, 0);
+	}
+
+	return true;
+}
@@ -0,0 +1,177 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "AutomationTest.h"
+
+#if STATS
+
+#include "StatsData.h"
+#include "StatsFile.h"
+
+
+/** Writes raw stat packets to memory, the way the raw stats capture adds them to its chunks. */
+struct FStatsFileTestWriter : public FRawStatsWriteFile
+{
+	void WritePacket( FStatPacket& StatPacket, TArray<uint8>& out_Data )
+	{
+		FMemoryWriter Ar( out_Data, false, true );
+		WriteStatPacket( Ar, StatPacket );
+	}
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStatsFileChunksTest, "Core.Misc.StatsFileChunks", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FStatsFileChunksTest::RunTest( const FString& Parameters )
+{
+	const FString Filename = FPaths::AutomationTransientDir() / TEXT("StatsFileChunksTest.ue4stats");
+
+	// chunk payloads, one incompressible and two compressible, with overlapping frame ranges like raw stats have
+	TArray<TArray<uint8>> Payloads;
+	Payloads.AddDefaulted(3);
+	FRandomStream RandomStream(0x5747);
+	for (int32 Index = 0; Index < 4096; Index++)
+	{
+		Payloads[0].Add((uint8)RandomStream.RandHelper(256));
+		Payloads[1].Add((uint8)(Index % 7));
+		Payloads[2].Add((uint8)(Index / 64));
+	}
+	const int64 FirstFrames[] = { 10, 12, 20 };
+	const int64 LastFrames[] = { 12, 19, 20 };
+
+	// write a capture that was never finalized and ends with a truncated chunk
+	{
+		TAutoPtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+		if (!Writer)
+		{
+			AddError(FString::Printf(TEXT("Could not create %s"), *Filename));
+			return false;
+		}
+
+		uint32 Magic = EStatMagicWithHeader::MAGIC;
+		FStatsStreamHeader Header;
+		Header.Version = EStatMagicWithHeader::VERSION_6;
+		Header.bRawStatsFile = true;
+		*Writer << Magic << Header;
+		Header.DataOffset = Writer->Tell();
+		Writer->Seek(sizeof(uint32));
+		*Writer << Header;
+		Writer->Seek(Header.DataOffset);
+
+		TArray<uint8> CompressedData;
+		for (int32 ChunkIndex = 0; ChunkIndex < Payloads.Num(); ChunkIndex++)
+		{
+			FCompressedStatsData Chunk(Payloads[ChunkIndex], CompressedData);
+			Chunk.SetChunkFrames(FirstFrames[ChunkIndex], LastFrames[ChunkIndex]);
+			*Writer << Chunk;
+		}
+
+		int32 Marker = EStatsFileConstants::CHUNK_MARKER;
+		int64 Frame = 30;
+		*Writer << Marker << Frame;
+	}
+
+	FStatsReadFile ReadFile;
+	if (!ReadFile.Open(Filename))
+	{
+		AddError(TEXT("Unfinalized chunked stats files must open"));
+		return false;
+	}
+
+	TestEqual(TEXT("Complete chunks must be recovered, truncated ones skipped"), ReadFile.GetChunks().Num(), Payloads.Num());
+	TestEqual(TEXT("First frame must come from the chunk headers"), ReadFile.GetFirstFrame(), (int64)10);
+	TestEqual(TEXT("Last frame must come from the chunk headers"), ReadFile.GetLastFrame(), (int64)20);
+
+	TArray<int32> ChunkIndices;
+	ReadFile.FindChunks(12, 12, ChunkIndices);
+	TestEqual(TEXT("Frames shared by chunks must find every chunk"), ChunkIndices.Num(), 2);
+	ChunkIndices.Reset();
+	ReadFile.FindChunks(20, 25, ChunkIndices);
+	TestTrue(TEXT("Frame ranges must find the overlapping chunks only"), ChunkIndices.Num() == 2 && ChunkIndices[0] == 1 && ChunkIndices[1] == 2);
+	ChunkIndices.Reset();
+	ReadFile.FindChunks(21, 100, ChunkIndices);
+	TestEqual(TEXT("Frame ranges past the data must find nothing"), ChunkIndices.Num(), 0);
+
+	// read in reverse to make sure chunks don't depend on each other
+	for (int32 ChunkIndex = ReadFile.GetChunks().Num() - 1; ChunkIndex >= 0; ChunkIndex--)
+	{
+		TArray<uint8> Data;
+		TestTrue(FString::Printf(TEXT("Chunk %d must be readable"), ChunkIndex), ReadFile.ReadChunk(ChunkIndex, Data));
+		TestTrue(FString::Printf(TEXT("Chunk %d must round trip"), ChunkIndex), Data == Payloads[ChunkIndex]);
+	}
+	TestEqual(TEXT("Incompressible chunks must be stored uncompressed"), ReadFile.GetChunks()[0].CompressionFlags, (int32)COMPRESS_None);
+	TestNotEqual(TEXT("Compressible chunks must be compressed"), ReadFile.GetChunks()[1].CompressionFlags, (int32)COMPRESS_None);
+
+	ReadFile.Close();
+
+	// FNames are sent once per stream, reading a later chunk of an unfinalized capture must still translate them
+	FStatNameAndInfo NameAndInfo(FName(TEXT("STAT_StatsFileTest")), "STATGROUP_StatsFileTest", "STATCAT_Advanced", TEXT("Stats file test"), EStatDataType::ST_int64, false, false);
+	{
+		FStatsFileTestWriter TestWriter;
+		TArray<TArray<uint8>> PacketPayloads;
+		PacketPayloads.AddDefaulted(2);
+		for (int32 ChunkIndex = 0; ChunkIndex < PacketPayloads.Num(); ChunkIndex++)
+		{
+			FStatPacket StatPacket;
+			StatPacket.Frame = 100 + ChunkIndex;
+			StatPacket.ThreadType = EThreadType::Game;
+			FStatMessage Message(NameAndInfo);
+			Message.NameAndInfo.SetField<EStatOperation>(EStatOperation::Set);
+			Message.GetValue_int64() = 42 + ChunkIndex;
+			StatPacket.StatMessages.Add(Message);
+			TestWriter.WritePacket(StatPacket, PacketPayloads[ChunkIndex]);
+		}
+		TestTrue(TEXT("FNames must not be resent in later chunks"), PacketPayloads[1].Num() < PacketPayloads[0].Num());
+
+		TAutoPtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+		if (!Writer)
+		{
+			AddError(FString::Printf(TEXT("Could not create %s"), *Filename));
+			return false;
+		}
+
+		uint32 Magic = EStatMagicWithHeader::MAGIC;
+		FStatsStreamHeader Header;
+		Header.Version = EStatMagicWithHeader::VERSION_6;
+		Header.bRawStatsFile = true;
+		*Writer << Magic << Header;
+		Header.DataOffset = Writer->Tell();
+		Writer->Seek(sizeof(uint32));
+		*Writer << Header;
+		Writer->Seek(Header.DataOffset);
+
+		TArray<uint8> CompressedData;
+		for (int32 ChunkIndex = 0; ChunkIndex < PacketPayloads.Num(); ChunkIndex++)
+		{
+			FCompressedStatsData Chunk(PacketPayloads[ChunkIndex], CompressedData);
+			Chunk.SetChunkFrames(100 + ChunkIndex, 100 + ChunkIndex);
+			*Writer << Chunk;
+		}
+	}
+
+	if (!ReadFile.Open(Filename))
+	{
+		AddError(TEXT("Unfinalized raw stats files must open"));
+		return false;
+	}
+
+	FStatPacketArray Packets;
+	TestTrue(TEXT("Later chunks must be readable on their own"), ReadFile.ReadStatPackets(101, 101, Packets));
+	TestEqual(TEXT("Only the packets of the frame range must be read"), Packets.Packets.Num(), 1);
+	if (Packets.Packets.Num() == 1 && Packets.Packets[0]->StatMessages.Num() == 1)
+	{
+		const FStatMessage& Message = Packets.Packets[0]->StatMessages[0];
+		TestTrue(TEXT("FNames sent in earlier chunks must be translated"), Message.NameAndInfo.GetRawName() == NameAndInfo.GetRawName());
+		TestEqual(TEXT("Messages must round trip"), Message.GetValue_int64(), (int64)43);
+	}
+	else
+	{
+		AddError(TEXT("The packet of the frame must round trip"));
+	}
+
+	ReadFile.Close();
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+#endif // STATS
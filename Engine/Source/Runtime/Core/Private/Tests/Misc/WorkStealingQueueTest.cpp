@@ -0,0 +1,223 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "CorePrivatePCH.h"
+#include "Containers/WorkStealingQueue.h"
+#include "Misc/AutomationTest.h"
+
+
+/**
+ * Thief thread for the work stealing queue test, counts how many times it took each item.
+ */
+class FWorkStealingQueueTestThief
+	: public FRunnable
+{
+public:
+
+	FWorkStealingQueueTestThief(TWorkStealingQueue<int32, 64>& InQueue, TArray<FThreadSafeCounter>& InTakenCounts, FThreadSafeCounter& InNumRemaining)
+		: Queue(InQueue)
+		, TakenCounts(InTakenCounts)
+		, NumRemaining(InNumRemaining)
+	{ }
+
+	virtual uint32 Run() override
+	{
+		while (NumRemaining.GetValue() > 0)
+		{
+			int32* Item = Queue.Steal();
+			if (Item)
+			{
+				TakenCounts[*Item].Increment();
+				NumRemaining.Decrement();
+			}
+		}
+		return 0;
+	}
+
+private:
+
+	TWorkStealingQueue<int32, 64>& Queue;
+	TArray<FThreadSafeCounter>& TakenCounts;
+	FThreadSafeCounter& NumRemaining;
+};
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWorkStealingQueueTest, "Core.Misc.WorkStealingQueue", EAutomationTestFlags::ATF_SmokeTest)
+
+bool FWorkStealingQueueTest::RunTest( const FString& Parameters )
+{
+	int32 Values[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+	// empty queue
+	{
+		TWorkStealingQueue<int32, 4> Queue;
+
+		TestTrue(TEXT("Newly created queues must be empty"), Queue.IsEmpty());
+		TestNull(TEXT("Popping from an empty queue must fail"), Queue.Pop());
+		TestNull(TEXT("Stealing from an empty queue must fail"), Queue.Steal());
+		TestTrue(TEXT("Failed pops must leave the queue empty"), Queue.IsEmpty());
+	}
+
+	// owner pops newest first, thieves steal oldest first
+	{
+		TWorkStealingQueue<int32, 4> Queue;
+
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			TestTrue(TEXT("Pushing to a non-full queue must succeed"), Queue.Push(&Values[Index]));
+		}
+		TestFalse(TEXT("Pushing to a full queue must fail"), Queue.Push(&Values[4]));
+		TestEqual(TEXT("Full queues must hold their capacity"), Queue.Num(), 4);
+
+		TestEqual(TEXT("Pop must return the newest item"), Queue.Pop(), &Values[3]);
+		TestEqual(TEXT("Steal must return the oldest item"), Queue.Steal(), &Values[0]);
+		TestEqual(TEXT("Steal must return the next oldest item"), Queue.Steal(), &Values[1]);
+		TestEqual(TEXT("Pop must return the last item"), Queue.Pop(), &Values[2]);
+		TestTrue(TEXT("Queues must be empty after taking all items"), Queue.IsEmpty());
+
+		// wrap around the end of the buffer
+		for (int32 Index = 4; Index < 8; ++Index)
+		{
+			TestTrue(TEXT("Pushing past the end of the buffer must succeed"), Queue.Push(&Values[Index]));
+		}
+		TestEqual(TEXT("Steal must return the oldest wrapped item"), Queue.Steal(), &Values[4]);
+		TestEqual(TEXT("Pop must return the newest wrapped item"), Queue.Pop(), &Values[7]);
+	}
+
+	// concurrent stealing, every item must be taken exactly once
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		const int32 NumItems = 100000;
+		const int32 NumThieves = 3;
+
+		TWorkStealingQueue<int32, 64> Queue;
+		TArray<int32> Items;
+		TArray<FThreadSafeCounter> TakenCounts;
+		FThreadSafeCounter NumRemaining(NumItems);
+
+		Items.AddUninitialized(NumItems);
+		TakenCounts.AddDefaulted(NumItems);
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			Items[Index] = Index;
+		}
+
+		TArray<FWorkStealingQueueTestThief*> Thieves;
+		TArray<FRunnableThread*> Threads;
+		for (int32 ThiefIndex = 0; ThiefIndex < NumThieves; ++ThiefIndex)
+		{
+			Thieves.Add(new FWorkStealingQueueTestThief(Queue, TakenCounts, NumRemaining));
+			Threads.Add(FRunnableThread::Create(Thieves.Last(), *FString::Printf(TEXT("WorkStealingQueueTestThief %d"), ThiefIndex)));
+		}
+
+		// the owner keeps pushing and occasionally pops, so it races the thieves for the last item
+		for (int32 Index = 0; Index < NumItems; )
+		{
+			if (Queue.Push(&Items[Index]))
+			{
+				++Index;
+			}
+			if ((Index % 3) == 0)
+			{
+				int32* Item = Queue.Pop();
+				if (Item)
+				{
+					TakenCounts[*Item].Increment();
+					NumRemaining.Decrement();
+				}
+			}
+		}
+		while (NumRemaining.GetValue() > 0)
+		{
+			int32* Item = Queue.Pop();
+			if (Item)
+			{
+				TakenCounts[*Item].Increment();
+				NumRemaining.Decrement();
+			}
+		}
+
+		for (int32 ThiefIndex = 0; ThiefIndex < NumThieves; ++ThiefIndex)
+		{
+			Threads[ThiefIndex]->WaitForCompletion();
+			delete Threads[ThiefIndex];
+			delete Thieves[ThiefIndex];
+		}
+
+		int32 NumWrong = 0;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			if (TakenCounts[Index].GetValue() != 1)
+			{
+				++NumWrong;
+			}
+		}
+		TestEqual(TEXT("Every item must be taken exactly once"), NumWrong, 0);
+		TestTrue(TEXT("Queues must be empty after taking all items"), Queue.IsEmpty());
+	}
+
+	// the owner pushes a single item and pops it right away, so every pop races the thieves for the last item
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		const int32 NumItems = 200000;
+		const int32 NumThieves = FMath::Clamp(FPlatformMisc::NumberOfCores() - 1, 2, 7);
+
+		TWorkStealingQueue<int32, 64> Queue;
+		TArray<int32> Items;
+		TArray<FThreadSafeCounter> TakenCounts;
+		FThreadSafeCounter NumRemaining(NumItems);
+
+		Items.AddUninitialized(NumItems);
+		TakenCounts.AddDefaulted(NumItems);
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			Items[Index] = Index;
+		}
+
+		TArray<FWorkStealingQueueTestThief*> Thieves;
+		TArray<FRunnableThread*> Threads;
+		for (int32 ThiefIndex = 0; ThiefIndex < NumThieves; ++ThiefIndex)
+		{
+			Thieves.Add(new FWorkStealingQueueTestThief(Queue, TakenCounts, NumRemaining));
+			Threads.Add(FRunnableThread::Create(Thieves.Last(), *FString::Printf(TEXT("WorkStealingQueueLastItemThief %d"), ThiefIndex)));
+		}
+
+		int32 NumPopped = 0;
+		int32 NumNotEmpty = 0;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			Queue.Push(&Items[Index]);
+			int32* Item = Queue.Pop();
+			if (Item)
+			{
+				TakenCounts[*Item].Increment();
+				NumRemaining.Decrement();
+				++NumPopped;
+			}
+			if (!Queue.IsEmpty())
+			{
+				++NumNotEmpty;
+			}
+		}
+		TestEqual(TEXT("Pop must leave the queue empty when racing for the last item"), NumNotEmpty, 0);
+
+		for (int32 ThiefIndex = 0; ThiefIndex < NumThieves; ++ThiefIndex)
+		{
+			Threads[ThiefIndex]->WaitForCompletion();
+			delete Threads[ThiefIndex];
+			delete Thieves[ThiefIndex];
+		}
+
+		int32 NumWrong = 0;
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			if (TakenCounts[Index].GetValue() != 1)
+			{
+				++NumWrong;
+			}
+		}
+		TestEqual(TEXT("The last item must be taken exactly once, by the owner or by one thief"), NumWrong, 0);
+		AddLogItem(FString::Printf(TEXT("Owner kept %d of %d last items against %d thieves."), NumPopped, NumItems, NumThieves));
+	}
+
+	return true;
+}
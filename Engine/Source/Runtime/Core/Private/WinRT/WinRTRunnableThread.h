@@ -121,6 +121,9 @@ class FRunnableThreadWinRT : public FRunnableThread
 			ThreadInitSyncEvent->Trigger();
 		}
 
+		// Give back the command list pages this thread cached
+		FPageAllocator::ClearTLSCachesOnCurrentThread();
+
 		return ExitCode;
 	}
 
@@ -78,5 +78,8 @@ uint32 FRunnableThreadWin::Run()
 		ThreadInitSyncEvent->Trigger();
 	}
 
+	// Give back the command list pages this thread cached
+	FPageAllocator::ClearTLSCachesOnCurrentThread();
+
 	return ExitCode;
 }
@@ -0,0 +1,46 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ParallelFor.h: Data parallel loops on the task graph's worker threads.
+=============================================================================*/
+
+#pragma once
+
+#include "Function.h"
+
+
+/**
+ * Calls Body once for every index in [0, Num), spread over the task graph's worker threads and the calling thread.
+ * Returns when every call has returned.
+ *
+ * The indices are handed out in ranges, large ones first and smaller ones toward the end, so that the threads run out of
+ * work at about the same time even when some indices are more expensive than others. The calling thread works on ranges
+ * too and only waits for the ranges other threads are in the middle of, so ParallelFor can be nested, or called from a
+ * task, without deadlocking when every worker thread is busy.
+ *
+ * Body is called concurrently, and in no particular order, so it must only write to what belongs to its index.
+ *
+ * Sample code:
+ *
+ *	ParallelFor(Particles.Num(), [&](int32 Index)
+ *	{
+ *		Particles[Index].Location += Particles[Index].Velocity * DeltaTime;
+ *	});
+ *
+ * @param Num Number of indices.
+ * @param Body Function to call for every index.
+ * @param bForceSingleThread Runs the loop on the calling thread, e.g. to debug Body or when Num is known to be small.
+ */
+CORE_API void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body, bool bForceSingleThread = false);
+
+/**
+ * ParallelFor which runs CurrentThreadWorkToDoBeforeHelping on the calling thread once the worker threads have started on
+ * the loop, then helps with the loop. For work that has to happen on the calling thread anyway, which would otherwise have to
+ * wait for the loop or keep the worker threads waiting.
+ *
+ * @param Num Number of indices.
+ * @param Body Function to call for every index.
+ * @param CurrentThreadWorkToDoBeforeHelping Function to call on the calling thread while the loop runs.
+ * @param bForceSingleThread Runs everything on the calling thread, CurrentThreadWorkToDoBeforeHelping first.
+ */
+CORE_API void ParallelForWithPreWork(int32 Num, TFunctionRef<void(int32)> Body, TFunctionRef<void()> CurrentThreadWorkToDoBeforeHelping, bool bForceSingleThread = false);
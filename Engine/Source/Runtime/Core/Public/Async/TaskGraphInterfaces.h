@@ -126,6 +126,10 @@ public:
 	 *	@return a reference to the task graph system
 	**/
 	static CORE_API FTaskGraphInterface& Get();
+	/** 
+	 *	@return true if the system has been started and not shut down, so Get can be called
+	**/
+	static CORE_API bool IsRunning();
 
 	/** Return the current thread type, if known. **/
 	virtual ENamedThreads::Type GetCurrentThreadIfKnown() = 0;
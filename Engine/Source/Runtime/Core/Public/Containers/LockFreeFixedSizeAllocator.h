@@ -95,6 +95,260 @@ private:
 };
 
 
+/**
+ * Thread safe pooling allocator of fixed size blocks, with a cache of free blocks per thread in front of a lock free list
+ * of bundles of blocks. A thread only goes to the shared list once per NumPerBundle allocations or frees, so threads that
+ * allocate at the same time don't contend on it, and most allocations and frees are a few plain loads and stores.
+ *
+ * Every thread caches up to one bundle it allocates from and frees to, and the threads together cache at most
+ * MaxCachedFullBundles more full bundles to fall back on. Threads give their cached blocks back with
+ * FlushThreadLocalCache before they exit.
+ *
+ * Never returns free space, not even at program shutdown. Blocks are moved in and out of threads by the bundle, so the
+ * blocks threads have cached are counted as used.
+ */
+template<int32 SIZE, int32 NumPerBundle, typename TTrackingCounter = FNoopCounter>
+class TLockFreeFixedSizeAllocator_TLSCache	// alignment isn't handled, assumes FMemory::Malloc will work
+{
+	static_assert(SIZE >= sizeof(void*) && SIZE % sizeof(void*) == 0, "Blocks must be able to hold a pointer.");
+	static_assert(NumPerBundle > 0, "Bundles must hold at least one block.");
+
+	/** A free block, linked to the next free block of its bundle. */
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	/** A thread's free blocks, a bundle it allocates from and frees to, and a full bundle to fall back on. */
+	struct FThreadLocalCache
+	{
+		FFreeBlock* PartialBundle;
+		int32 NumPartial;
+		FFreeBlock* FullBundle;
+
+		FThreadLocalCache()
+			: PartialBundle(nullptr)
+			, NumPartial(0)
+			, FullBundle(nullptr)
+		{
+		}
+	};
+
+public:
+
+	/** @param InMaxCachedFullBundles Number of full bundles all threads together keep cached beyond the ones they allocate from. */
+	explicit TLockFreeFixedSizeAllocator_TLSCache(int32 InMaxCachedFullBundles = 16)
+		: TlsSlot(FPlatformTLS::AllocTlsSlot())
+		, MaxCachedFullBundles(InMaxCachedFullBundles)
+		, OrphanBlocks(nullptr)
+		, NumOrphanBlocks(0)
+	{
+	}
+
+	~TLockFreeFixedSizeAllocator_TLSCache()
+	{
+		FPlatformTLS::FreeTlsSlot(TlsSlot);
+	}
+
+	/**
+	 * Allocates a memory block of size SIZE.
+	 *
+	 * @return Pointer to the allocated memory.
+	 * @see Free
+	 */
+	FORCEINLINE void* Allocate()
+	{
+		FThreadLocalCache& Cache = GetThreadLocalCache();
+		if (!Cache.PartialBundle)
+		{
+			if (Cache.FullBundle)
+			{
+				Cache.PartialBundle = Cache.FullBundle;
+				Cache.FullBundle = nullptr;
+				NumCachedFullBundles.Decrement();
+			}
+			else
+			{
+				Cache.PartialBundle = GlobalFreeListBundles.Pop();
+				if (Cache.PartialBundle)
+				{
+					NumFree.Subtract(NumPerBundle);
+				}
+				else
+				{
+					Cache.PartialBundle = AllocateBundle();
+				}
+				NumUsed.Add(NumPerBundle);
+			}
+			Cache.NumPartial = NumPerBundle;
+		}
+
+		FFreeBlock* Result = Cache.PartialBundle;
+		Cache.PartialBundle = Result->Next;
+		Cache.NumPartial--;
+		checkSlow(Cache.NumPartial >= 0 && (Cache.NumPartial == 0) == (Cache.PartialBundle == nullptr));
+		return Result;
+	}
+
+	/**
+	 * Puts a memory block previously obtained from Allocate() back in the calling thread's cache, which need not be the
+	 * thread that allocated it.
+	 *
+	 * @param Item The item to free.
+	 * @see Allocate
+	 */
+	FORCEINLINE void Free(void *Item)
+	{
+		FThreadLocalCache& Cache = GetThreadLocalCache();
+		if (Cache.NumPartial >= NumPerBundle)
+		{
+			if (Cache.FullBundle)
+			{
+				// Keep the newer bundle, its blocks are more likely to be in the cache
+				PushBundle(Cache.FullBundle);
+				Cache.FullBundle = Cache.PartialBundle;
+			}
+			else if (NumCachedFullBundles.Increment() <= MaxCachedFullBundles)
+			{
+				Cache.FullBundle = Cache.PartialBundle;
+			}
+			else
+			{
+				NumCachedFullBundles.Decrement();
+				PushBundle(Cache.PartialBundle);
+			}
+			Cache.PartialBundle = nullptr;
+			Cache.NumPartial = 0;
+		}
+
+		FFreeBlock* Block = (FFreeBlock*)Item;
+		Block->Next = Cache.PartialBundle;
+		Cache.PartialBundle = Block;
+		Cache.NumPartial++;
+	}
+
+	/**
+	 * Gives the blocks cached by the calling thread back to the shared free list and deletes its cache. Threads call this
+	 * before they exit, the allocator can still be used afterwards.
+	 */
+	void FlushThreadLocalCache()
+	{
+		FThreadLocalCache* Cache = (FThreadLocalCache*)FPlatformTLS::GetTlsValue(TlsSlot);
+		if (!Cache)
+		{
+			return;
+		}
+		FPlatformTLS::SetTlsValue(TlsSlot, nullptr);
+
+		if (Cache->FullBundle)
+		{
+			NumCachedFullBundles.Decrement();
+			PushBundle(Cache->FullBundle);
+		}
+
+		if (Cache->NumPartial)
+		{
+			// A partial bundle can't go on the shared list, gather the blocks of exiting threads until they make a bundle
+			FScopeLock Lock(&OrphanBlocksCritical);
+			FFreeBlock* Block = Cache->PartialBundle;
+			while (Block)
+			{
+				FFreeBlock* Next = Block->Next;
+				Block->Next = OrphanBlocks;
+				OrphanBlocks = Block;
+				if (++NumOrphanBlocks == NumPerBundle)
+				{
+					PushBundle(OrphanBlocks);
+					OrphanBlocks = nullptr;
+					NumOrphanBlocks = 0;
+				}
+				Block = Next;
+			}
+		}
+
+		delete Cache;
+	}
+
+	/**
+	 * Gets the number of allocated memory blocks that are in use, or cached by a thread.
+	 *
+	 * @return Number of used memory blocks.
+	 * @see GetNumFree
+	 */
+	const TTrackingCounter& GetNumUsed() const
+	{
+		return NumUsed;
+	}
+
+	/**
+	 * Gets the number of allocated memory blocks in bundles on the shared free list.
+	 *
+	 * @return Number of unused memory blocks.
+	 * @see GetNumUsed
+	 */
+	const TTrackingCounter& GetNumFree() const
+	{
+		return NumFree;
+	}
+
+private:
+
+	/** Returns the calling thread's cache, creating it on the thread's first use of the allocator. */
+	FORCEINLINE FThreadLocalCache& GetThreadLocalCache()
+	{
+		FThreadLocalCache* Cache = (FThreadLocalCache*)FPlatformTLS::GetTlsValue(TlsSlot);
+		if (!Cache)
+		{
+			Cache = new FThreadLocalCache();
+			FPlatformTLS::SetTlsValue(TlsSlot, Cache);
+		}
+		return *Cache;
+	}
+
+	/** Puts a full bundle a thread held on the shared free list. */
+	void PushBundle(FFreeBlock* Bundle)
+	{
+		GlobalFreeListBundles.Push(Bundle);
+		NumUsed.Subtract(NumPerBundle);
+		NumFree.Add(NumPerBundle);
+	}
+
+	/** Allocates a new bundle of blocks in one allocation, linked to each other. */
+	FFreeBlock* AllocateBundle()
+	{
+		uint8* Blocks = (uint8*)FMemory::Malloc(SIZE * NumPerBundle);
+		for (int32 Index = 0; Index < NumPerBundle; Index++)
+		{
+			((FFreeBlock*)(Blocks + Index * SIZE))->Next = Index + 1 < NumPerBundle ? (FFreeBlock*)(Blocks + (Index + 1) * SIZE) : nullptr;
+		}
+		return (FFreeBlock*)Blocks;
+	}
+
+	/** TLS slot of the threads' caches. */
+	uint32 TlsSlot;
+
+	/** Lock free list of full bundles of free blocks, each linked through its blocks. */
+	TLockFreePointerList<FFreeBlock> GlobalFreeListBundles;
+
+	/** Number of full bundles threads may keep cached to fall back on. */
+	const int32 MaxCachedFullBundles;
+
+	/** Number of full bundles threads keep cached to fall back on. */
+	FThreadSafeCounter NumCachedFullBundles;
+
+	/** Free blocks of exited threads, not enough to make a bundle yet. Counted as used. */
+	FFreeBlock* OrphanBlocks;
+	int32 NumOrphanBlocks;
+	FCriticalSection OrphanBlocksCritical;
+
+	/** Number of blocks in bundles held by threads, either in use or cached. */
+	TTrackingCounter NumUsed;
+
+	/** Number of blocks in bundles on the shared free list. */
+	TTrackingCounter NumFree;
+};
+
+
 /**
  * Thread safe, lock free pooling allocator of memory for instances of T.
  *
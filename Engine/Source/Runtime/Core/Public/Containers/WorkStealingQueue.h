@@ -0,0 +1,166 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+
+/**
+ * Implements a lock-free, fixed capacity work stealing deque (Chase-Lev).
+ *
+ * One thread owns the queue and is the only one allowed to call Push and Pop, which work on
+ * the bottom end of the queue in last-in first-out order. Any number of other threads can call
+ * Steal concurrently, which takes items from the top end in first-in first-out order. The owner
+ * only synchronizes with thieves when the queue is down to its last item.
+ *
+ * The capacity is fixed so that items never move, which is what makes reading an item before
+ * claiming it safe for thieves. Push fails when the queue is full and the caller is expected to
+ * hand the item to some other (shared) queue instead.
+ *
+ * Top and bottom are 32 bit, so they are read and written atomically on every target, and wrap around. They are only ever
+ * compared through their distance, which stays correct across the wrap because the queue holds far fewer than 2^31 items.
+ *
+ * @param ElementType The type of the pointers held in the queue.
+ * @param Capacity The maximum number of items in the queue, must be a power of two.
+ */
+template<typename ElementType, int32 Capacity = 1024>
+class TWorkStealingQueue
+	: FNoncopyable
+{
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+public:
+
+	/** Default constructor. */
+	TWorkStealingQueue()
+		: Top(0)
+		, Bottom(0)
+	{
+		FMemory::Memzero((void*)Items, sizeof(Items));
+	}
+
+public:
+
+	/**
+	 * Adds an item to the bottom of the queue. Must only be called by the owning thread.
+	 *
+	 * @param Item The item to add.
+	 * @return true if the item was added, false if the queue is full.
+	 */
+	bool Push(ElementType* Item)
+	{
+		const int32 LocalBottom = Bottom;
+		// A stale Top only makes the queue look fuller than it is.
+		if (Distance(Top, LocalBottom) >= Capacity)
+		{
+			return false;
+		}
+		Items[LocalBottom & (Capacity - 1)] = Item;
+		// The item must be visible before thieves can see the new bottom, and the new bottom must be visible before the
+		// owner looks for idle threads to wake. Interlocked arithmetic is a full fence on every platform, unlike
+		// FPlatformMisc::MemoryBarrier, which does nothing on some. Only the owner writes bottom, so this stores LocalBottom + 1.
+		FPlatformAtomics::InterlockedIncrement(&Bottom);
+		return true;
+	}
+
+	/**
+	 * Removes the most recently pushed item from the bottom of the queue. Must only be called by the owning thread.
+	 *
+	 * @return The item, or nullptr if the queue is empty or the last item was stolen.
+	 */
+	ElementType* Pop()
+	{
+		// Thieves must see the reserved bottom before we read top, otherwise both of us could take the last item.
+		// The interlocked add is a full fence, so the read of top below can't move before it.
+		const int32 LocalBottom = Offset(FPlatformAtomics::InterlockedAdd(&Bottom, -1), -1);
+		const int32 LocalTop = Top;
+
+		if (Distance(LocalTop, LocalBottom) < 0)
+		{
+			// Empty, restore the canonical empty state.
+			Bottom = LocalTop;
+			return nullptr;
+		}
+
+		ElementType* Item = Items[LocalBottom & (Capacity - 1)];
+		if (LocalTop == LocalBottom)
+		{
+			// Last item, race the thieves for it.
+			if (FPlatformAtomics::InterlockedCompareExchange(&Top, Offset(LocalTop, 1), LocalTop) != LocalTop)
+			{
+				Item = nullptr;
+			}
+			Bottom = Offset(LocalTop, 1);
+		}
+		return Item;
+	}
+
+	/**
+	 * Removes the oldest item from the top of the queue. Can be called from any thread.
+	 *
+	 * @return The item, or nullptr if the queue is empty or another thread claimed the item first.
+	 */
+	ElementType* Steal()
+	{
+		// Read top with a full fence, so that bottom is read after it, pairing with the fence in Pop.
+		const int32 LocalTop = FPlatformAtomics::InterlockedAdd(&Top, 0);
+		const int32 LocalBottom = Bottom;
+
+		if (Distance(LocalTop, LocalBottom) <= 0)
+		{
+			return nullptr;
+		}
+
+		// The slot can't be reused by Push before Top moves past it, in which case the exchange below fails.
+		ElementType* Item = Items[LocalTop & (Capacity - 1)];
+		if (FPlatformAtomics::InterlockedCompareExchange(&Top, Offset(LocalTop, 1), LocalTop) != LocalTop)
+		{
+			return nullptr;
+		}
+		return Item;
+	}
+
+	/**
+	 * Checks whether the queue is empty. The result is only a hint if called from a thread other than the owner.
+	 *
+	 * @return true if the queue is empty.
+	 */
+	bool IsEmpty() const
+	{
+		return Distance(Top, Bottom) <= 0;
+	}
+
+	/**
+	 * Gets the number of items in the queue. The result is only a hint if called from a thread other than the owner.
+	 *
+	 * @return Number of queued items.
+	 */
+	int32 Num() const
+	{
+		return FMath::Max(Distance(Top, Bottom), 0);
+	}
+
+private:
+
+	/** Gets the signed number of items from index From to index To, across the wrap around. */
+	static FORCEINLINE int32 Distance(int32 From, int32 To)
+	{
+		return (int32)((uint32)To - (uint32)From);
+	}
+
+	/** Moves an index by Amount, wrapping around instead of overflowing. */
+	static FORCEINLINE int32 Offset(int32 Index, int32 Amount)
+	{
+		return (int32)((uint32)Index + (uint32)Amount);
+	}
+
+	/** Index of the oldest item, only ever incremented (by thieves, or by the owner when taking the last item). */
+	volatile int32 Top;
+
+	/** Keeps Bottom off Top's cache line so that pushes don't disturb thieves. */
+	uint8 PadToAvoidContention[CACHE_LINE_SIZE - sizeof(int32)];
+
+	/** Index one past the newest item, only written by the owner. */
+	volatile int32 Bottom;
+
+	/** Circular item storage. */
+	ElementType* volatile Items[Capacity];
+};
@@ -92,6 +92,7 @@
 #include "WildcardString.h"
 #include "CircularBuffer.h"
 #include "CircularQueue.h"
+#include "WorkStealingQueue.h"
 #include "Queue.h"
 #include "Ticker.h"						// Efficient scheduled delegate manager
 #include "RocketSupport.h"				// Core support for launching in "Rocket" mode
@@ -63,6 +63,76 @@ public:
 };
 
 
+/**
+ * Read-only view of a range of a memory mapped file. Close the region by delete'ing it. Regions have to be closed
+ * before the IMappedFileHandle they were mapped from.
+**/
+class CORE_API IMappedFileRegion
+{
+public:
+	IMappedFileRegion(const uint8* InMappedPtr, int64 InMappedSize)
+		: MappedPtr(InMappedPtr)
+		, MappedSize(InMappedSize)
+	{
+	}
+
+	/** Destructor, also the only way to close the region **/
+	virtual ~IMappedFileRegion()
+	{
+	}
+
+	/** Return the first byte of the region. Pages are read from disk on first access. **/
+	FORCEINLINE const uint8* GetMappedPtr() const
+	{
+		return MappedPtr;
+	}
+
+	/** Return the size of the region in bytes. **/
+	FORCEINLINE int64 GetMappedSize() const
+	{
+		return MappedSize;
+	}
+
+private:
+	const uint8* MappedPtr;
+	int64 MappedSize;
+};
+
+/**
+ * Memory mapped file interface. Close the file by delete'ing the handle after all regions mapped from it are closed.
+**/
+class CORE_API IMappedFileHandle
+{
+public:
+	IMappedFileHandle(int64 InFileSize)
+		: FileSize(InFileSize)
+	{
+	}
+
+	/** Destructor, also the only way to close the file handle **/
+	virtual ~IMappedFileHandle()
+	{
+	}
+
+	/** Return the size of the file. **/
+	FORCEINLINE int64 GetFileSize() const
+	{
+		return FileSize;
+	}
+
+	/**
+	 * Map a range of the file into memory.
+	 * @param Offset		Offset of the range in the file.
+	 * @param BytesToMap	Number of bytes to map, clamped to the end of the file.
+	 * @return				The mapped region or nullptr if the range is invalid. Close the region by delete'ing it.
+	**/
+	virtual IMappedFileRegion* MapRegion(int64 Offset = 0, int64 BytesToMap = MAX_int64) = 0;
+
+private:
+	int64 FileSize;
+};
+
+
 /**
 * File I/O Interface
 **/
@@ -151,6 +221,14 @@ public:
 	virtual IFileHandle*	OpenRead(const TCHAR* Filename) = 0;
 	/** Attempt to open a file for writing. If successful will return a non-nullptr pointer. Close the file by delete'ing the handle. **/
 	virtual IFileHandle*	OpenWrite(const TCHAR* Filename, bool bAppend = 0, bool bAllowRead = 0) = 0;
+	/**
+	 * Attempt to open a file for memory mapped reading. Returns nullptr if the file doesn't exist or the platform file
+	 * doesn't support mapping it, callers need to fall back to OpenRead. Close the file by delete'ing the handle.
+	**/
+	virtual IMappedFileHandle*	OpenMapped(const TCHAR* Filename)
+	{
+		return nullptr;
+	}
 
 	/** Return true if the directory exists. **/
 	virtual bool		DirectoryExists(const TCHAR* Directory) = 0;
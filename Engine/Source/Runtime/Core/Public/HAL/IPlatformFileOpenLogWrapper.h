@@ -156,6 +156,10 @@ public:
 	{
 		return LowerLevel->OpenWrite(Filename, bAppend, bAllowRead);
 	}
+	virtual IMappedFileHandle*	OpenMapped(const TCHAR* Filename) override
+	{
+		return LowerLevel->OpenMapped(Filename);
+	}
 	virtual bool		DirectoryExists(const TCHAR* Directory) override
 	{
 		return LowerLevel->DirectoryExists(Directory);
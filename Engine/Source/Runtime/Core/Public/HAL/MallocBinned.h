@@ -27,6 +27,17 @@
 #	define USE_FINE_GRAIN_LOCKS
 #endif
 
+// Per-thread free lists for the small block pools. Threads opt in with FMemory::SetupTLSCachesOnCurrentThread().
+#if defined USE_FINE_GRAIN_LOCKS && !defined USE_LOCKFREE_DELETE
+#	define USE_THREAD_CACHES
+#endif
+
+#if defined USE_THREAD_CACHES
+	// Upper bound on the bytes a single thread may hold for one pool before a batch is returned to the global pool.
+#	define THREAD_CACHE_MAX_BYTES_PER_POOL (32*1024)
+#	define THREAD_CACHE_MAX_BLOCKS_PER_POOL (256)
+#endif
+
 #include "LockFreeList.h"
 #include "Array.h"
 
@@ -40,6 +51,10 @@ DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Used Peak"),		STAT_Binned_UsedPeak,STATG
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Binned Current Allocs"),	STAT_Binned_CurrentAllocs,STATGROUP_MemoryAllocator, CORE_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Binned Total Allocs"),		STAT_Binned_TotalAllocs,STATGROUP_MemoryAllocator, CORE_API);
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Slack Current"),	STAT_Binned_SlackCurrent,STATGROUP_MemoryAllocator, CORE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Binned Thread Cache Current"),		STAT_Binned_ThreadCacheCurrent,STATGROUP_MemoryAllocator, CORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Binned Thread Cache Hits"),		STAT_Binned_ThreadCacheHits,STATGROUP_MemoryAllocator, CORE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Binned Thread Cache Misses"),	STAT_Binned_ThreadCacheMisses,STATGROUP_MemoryAllocator, CORE_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Binned Thread Cache Hit Rate"),	STAT_Binned_ThreadCacheHitRate,STATGROUP_MemoryAllocator, CORE_API);
 
 
 //
@@ -213,6 +228,29 @@ private:
 		}
 	};
 
+#ifdef USE_THREAD_CACHES
+	/**
+	 * Free lists for the small block pools owned by a single thread. Blocks held here are still
+	 * counted as taken by their pool, so the pool can never be released while a thread caches one of its blocks.
+	 * Only the owning thread modifies a cache; other threads read the counters for stats only.
+	 */
+	struct FThreadCache
+	{
+		/** Cached free blocks for each entry of PoolTable[], linked through FFreeMem::Next. */
+		FFreeMem*		FreeList[POOL_COUNT];
+		/** Number of blocks in each free list */
+		uint32			NumFree[POOL_COUNT];
+		/** Next cache in ActiveThreadCaches or ThreadCacheFreeList */
+		FThreadCache*	Next;
+		/** Total size of all cached blocks in bytes */
+		SIZE_T			CachedBytes;
+		/** Number of allocations served directly from the free lists */
+		uint64			Hits;
+		/** Number of allocations that had to refill from the global pools */
+		uint64			Misses;
+	};
+#endif
+
 	/** Hash table struct for retrieving allocation book keeping information */
 	struct PoolHashBucket
 	{
@@ -300,6 +338,18 @@ private:
 	uint32			CachedTotal;
 #endif
 
+#ifdef USE_THREAD_CACHES
+	/** TLS slot holding the FThreadCache of the current thread, or null if the thread has not opted in. */
+	uint32			ThreadCacheTlsSlot;
+	/** All thread caches currently in use. Protected by AccessGuard. */
+	FThreadCache*	ActiveThreadCaches;
+	/** Released thread caches, ready for reuse. Protected by AccessGuard. */
+	FThreadCache*	ThreadCacheFreeList;
+	/** Hit and miss counts of thread caches that have been released. Protected by AccessGuard. */
+	uint64			RetiredThreadCacheHits;
+	uint64			RetiredThreadCacheMisses;
+#endif
+
 #if STATS
 	SIZE_T		OsCurrent;
 	SIZE_T		OsPeak;
@@ -593,38 +643,7 @@ private:
 #ifdef USE_FINE_GRAIN_LOCKS
 			FScopeLock TableLock(&Table->CriticalSection);
 #endif
-#if STATS
-			Table->ActiveRequests--;
-#endif
-			// If this pool was exhausted, move to available list.
-			if( !Pool->FirstMem )
-			{
-				Pool->Unlink();
-				Pool->Link( Table->FirstPool );
-			}
-
-			// Free a pooled allocation.
-			FFreeMem* Free		= (FFreeMem*)Ptr;
-			Free->NumFreeBlocks	= 1;
-			Free->Next			= Pool->FirstMem;
-			Pool->FirstMem		= Free;
-			STAT(UsedCurrent -= Table->BlockSize);
-
-			// Free this pool.
-			checkSlow(Pool->Taken >= 1);
-			if( --Pool->Taken == 0 )
-			{
-#if STATS
-				Table->NumActivePools--;
-#endif
-				// Free the OS memory.
-				SIZE_T OsBytes = Pool->GetOsBytes(PageSize, BinnedOSTableIndex);
-				STAT(OsCurrent -= OsBytes);
-				STAT(WasteCurrent -= OsBytes - Pool->GetBytes());
-				Pool->Unlink();
-				Pool->SetAllocationSizes(0, 0, 0, BinnedOSTableIndex);
-				OSFree((void*)BasePtr, OsBytes);
-			}
+			FreeBlockToPool(Table, Pool, Ptr, BasePtr);
 		}
 		else
 		{
@@ -640,6 +659,185 @@ private:
 		MEM_TIME(MemTime += FPlatformTime::Seconds());
 	}
 
+	/**
+	* Returns a pooled block to its pool, releasing the pool to the OS once it is empty. The caller
+	* must hold the table lock.
+	*/
+	void FreeBlockToPool( FPoolTable* Table, FPoolInfo* Pool, void* Ptr, UPTRINT BasePtr )
+	{
+#if STATS
+		Table->ActiveRequests--;
+#endif
+		// If this pool was exhausted, move to available list.
+		if( !Pool->FirstMem )
+		{
+			Pool->Unlink();
+			Pool->Link( Table->FirstPool );
+		}
+
+		// Free a pooled allocation.
+		FFreeMem* Free		= (FFreeMem*)Ptr;
+		Free->NumFreeBlocks	= 1;
+		Free->Next			= Pool->FirstMem;
+		Pool->FirstMem		= Free;
+		STAT(UsedCurrent -= Table->BlockSize);
+
+		// Free this pool.
+		checkSlow(Pool->Taken >= 1);
+		if( --Pool->Taken == 0 )
+		{
+#if STATS
+			Table->NumActivePools--;
+#endif
+			// Free the OS memory.
+			SIZE_T OsBytes = Pool->GetOsBytes(PageSize, BinnedOSTableIndex);
+			STAT(OsCurrent -= OsBytes);
+			STAT(WasteCurrent -= OsBytes - Pool->GetBytes());
+			Pool->Unlink();
+			Pool->SetAllocationSizes(0, 0, 0, BinnedOSTableIndex);
+			OSFree((void*)BasePtr, OsBytes);
+		}
+	}
+
+#ifdef USE_THREAD_CACHES
+	FORCEINLINE FThreadCache* GetThreadCache() const
+	{
+		return (FThreadCache*)FPlatformTLS::GetTlsValue(ThreadCacheTlsSlot);
+	}
+
+	/** Maximum number of blocks a thread cache may hold for the given table. */
+	FORCEINLINE uint32 GetThreadCacheMaxBlocks( const FPoolTable* Table ) const
+	{
+		return FMath::Clamp<uint32>(THREAD_CACHE_MAX_BYTES_PER_POOL / Table->BlockSize, 1, THREAD_CACHE_MAX_BLOCKS_PER_POOL);
+	}
+
+	/** Number of blocks moved between a thread cache and the global pool in one locked operation. */
+	FORCEINLINE uint32 GetThreadCacheBatchSize( const FPoolTable* Table ) const
+	{
+		return FMath::Max<uint32>(GetThreadCacheMaxBlocks(Table) / 2, 1);
+	}
+
+	/** Pops a block from the thread cache, refilling the cache from the global pool when it is empty. */
+	FORCEINLINE FFreeMem* AllocateFromThreadCache( FThreadCache* Cache, FPoolTable* Table, SIZE_T Size )
+	{
+		const uint32 CacheIndex = (uint32)(Table - PoolTable);
+		checkSlow(CacheIndex < POOL_COUNT);
+
+		FFreeMem* Free = Cache->FreeList[CacheIndex];
+		if( Free )
+		{
+			Cache->FreeList[CacheIndex] = Free->Next;
+			Cache->NumFree[CacheIndex]--;
+			Cache->CachedBytes -= Table->BlockSize;
+			Cache->Hits++;
+			return Free;
+		}
+
+		Cache->Misses++;
+		return RefillThreadCache(Cache, Table, Size);
+	}
+
+	/** Takes a batch of blocks from the global pool under a single lock. Returns one of them, the rest go to the thread cache. */
+	FFreeMem* RefillThreadCache( FThreadCache* Cache, FPoolTable* Table, SIZE_T Size )
+	{
+		const uint32 CacheIndex = (uint32)(Table - PoolTable);
+		const uint32 BatchSize = GetThreadCacheBatchSize(Table);
+
+		FScopeLock TableLock(&Table->CriticalSection);
+		checkSlow(Size <= Table->BlockSize);
+
+		TrackStats(Table, Size);
+
+		FPoolInfo* Pool = Table->FirstPool;
+		if( !Pool )
+		{
+			Pool = AllocatePoolMemory(Table, BINNED_ALLOC_POOL_SIZE, Size);
+		}
+		FFreeMem* Result = AllocateBlockFromPool(Table, Pool);
+
+		// Only top up from pools that already exist, never allocate OS memory just to fill the cache.
+		for( uint32 i = 1; i < BatchSize && Table->FirstPool; ++i )
+		{
+			FFreeMem* Free = AllocateBlockFromPool(Table, Table->FirstPool);
+#if STATS
+			Table->ActiveRequests++;
+			Table->MaxActiveRequests = FMath::Max(Table->MaxActiveRequests, Table->ActiveRequests);
+#endif
+			Free->Next = Cache->FreeList[CacheIndex];
+			Cache->FreeList[CacheIndex] = Free;
+			Cache->NumFree[CacheIndex]++;
+			Cache->CachedBytes += Table->BlockSize;
+		}
+
+		return Result;
+	}
+
+	/**
+	* Pushes a small pooled block onto the thread cache.
+	* @return false if the block does not belong to a cacheable pool and must be freed normally
+	*/
+	FORCEINLINE bool FreeToThreadCache( FThreadCache* Cache, void* Ptr )
+	{
+		UPTRINT BasePtr;
+		FPoolInfo* Pool = FindPoolInfo((UPTRINT)Ptr, BasePtr);
+		checkSlow(Pool);
+		if( !Pool || Pool->TableIndex >= BinnedSizeLimit )
+		{
+			return false;
+		}
+
+		FPoolTable* Table = MemSizeToPoolTable[Pool->TableIndex];
+		const uint32 CacheIndex = (uint32)(Table - PoolTable);
+		checkSlow(CacheIndex < POOL_COUNT);
+
+		STAT(CurrentAllocs--);
+
+		FFreeMem* Free = (FFreeMem*)Ptr;
+		Free->Next = Cache->FreeList[CacheIndex];
+		Cache->FreeList[CacheIndex] = Free;
+		Cache->CachedBytes += Table->BlockSize;
+		if( ++Cache->NumFree[CacheIndex] > GetThreadCacheMaxBlocks(Table) )
+		{
+			ReleaseThreadCacheBlocks(Cache, CacheIndex, GetThreadCacheBatchSize(Table));
+		}
+		return true;
+	}
+
+	/** Returns up to Count blocks from the thread cache to their pools under a single lock. */
+	void ReleaseThreadCacheBlocks( FThreadCache* Cache, uint32 CacheIndex, uint32 Count )
+	{
+		FPoolTable* Table = &PoolTable[CacheIndex];
+		FScopeLock TableLock(&Table->CriticalSection);
+
+		for( ; Count && Cache->FreeList[CacheIndex]; --Count )
+		{
+			FFreeMem* Free = Cache->FreeList[CacheIndex];
+			Cache->FreeList[CacheIndex] = Free->Next;
+			Cache->NumFree[CacheIndex]--;
+			Cache->CachedBytes -= Table->BlockSize;
+
+			UPTRINT BasePtr;
+			FPoolInfo* Pool = FindPoolInfo((UPTRINT)Free, BasePtr);
+			checkSlow(Pool && MemSizeToPoolTable[Pool->TableIndex] == Table);
+			FreeBlockToPool(Table, Pool, Free, BasePtr);
+		}
+	}
+
+	/** Sums the counters of all live and released thread caches. The caller must hold AccessGuard. */
+	void GatherThreadCacheStats( SIZE_T& OutCachedBytes, uint64& OutHits, uint64& OutMisses ) const
+	{
+		OutCachedBytes = 0;
+		OutHits = RetiredThreadCacheHits;
+		OutMisses = RetiredThreadCacheMisses;
+		for( FThreadCache* Cache = ActiveThreadCaches; Cache; Cache = Cache->Next )
+		{
+			OutCachedBytes += Cache->CachedBytes;
+			OutHits += Cache->Hits;
+			OutMisses += Cache->Misses;
+		}
+	}
+#endif
+
 	void PushFreeLockless(void* Ptr)
 	{
 #ifdef USE_LOCKFREE_DELETE
@@ -785,6 +983,13 @@ public:
 		,	FreedPageBlocksNum(0)
 		,	CachedTotal(0)
 #endif
+#ifdef USE_THREAD_CACHES
+		,	ThreadCacheTlsSlot(FPlatformTLS::AllocTlsSlot())
+		,	ActiveThreadCaches(nullptr)
+		,	ThreadCacheFreeList(nullptr)
+		,	RetiredThreadCacheHits(0)
+		,	RetiredThreadCacheMisses(0)
+#endif
 #if STATS
 		,	OsCurrent		( 0 )
 		,	OsPeak			( 0 )
@@ -922,20 +1127,30 @@ public:
 		{
 			// Allocate from pool.
 			FPoolTable* Table = MemSizeToPoolTable[Size];
+#ifdef USE_THREAD_CACHES
+			FThreadCache* Cache = GetThreadCache();
+			if( Cache )
+			{
+				Free = AllocateFromThreadCache(Cache, Table, Size);
+			}
+			else
+#endif
+			{
 #ifdef USE_FINE_GRAIN_LOCKS
-			FScopeLock TableLock(&Table->CriticalSection);
+				FScopeLock TableLock(&Table->CriticalSection);
 #endif
-			checkSlow(Size <= Table->BlockSize);
+				checkSlow(Size <= Table->BlockSize);
 
-			TrackStats(Table, Size);
+				TrackStats(Table, Size);
 
-			FPoolInfo* Pool = Table->FirstPool;
-			if( !Pool )
-			{
-				Pool = AllocatePoolMemory(Table, BINNED_ALLOC_POOL_SIZE/*PageSize*/, Size);
-			}
+				FPoolInfo* Pool = Table->FirstPool;
+				if( !Pool )
+				{
+					Pool = AllocatePoolMemory(Table, BINNED_ALLOC_POOL_SIZE/*PageSize*/, Size);
+				}
 
-			Free = AllocateBlockFromPool(Table, Pool);
+				Free = AllocateBlockFromPool(Table, Pool);
+			}
 		}
 		else if ( ((Size >= BinnedSizeLimit && Size <= PagePoolTable[0].BlockSize) ||
 				  (Size > PageSize && Size <= PagePoolTable[1].BlockSize))
@@ -1070,9 +1285,91 @@ public:
 			return;
 		}
 
+#ifdef USE_THREAD_CACHES
+		FThreadCache* Cache = GetThreadCache();
+		if( Cache && FreeToThreadCache(Cache, Ptr) )
+		{
+			return;
+		}
+#endif
+
 		PushFreeLockless(Ptr);
 	}
 
+	/**
+	 * Gives the calling thread its own free lists for the small block pools, so that most small
+	 * allocations and frees on this thread no longer take a lock.
+	 */
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+#ifdef USE_THREAD_CACHES
+		if( GetThreadCache() )
+		{
+			return;
+		}
+
+		FThreadCache* Cache;
+		{
+			FScopeLock ScopedLock( &AccessGuard );
+			if( !ThreadCacheFreeList )
+			{
+				ThreadCacheFreeList = (FThreadCache*)FPlatformMemory::BinnedAllocFromOS(PageSize);
+				if( !ThreadCacheFreeList )
+				{
+					OutOfMemory(PageSize);
+				}
+				STAT(OsPeak = FMath::Max(OsPeak, OsCurrent += PageSize));
+				STAT(WastePeak = FMath::Max(WastePeak, WasteCurrent += PageSize));
+				const uint32 NumCaches = PageSize / sizeof(FThreadCache);
+				for( uint32 i = 0; i < NumCaches; ++i )
+				{
+					ThreadCacheFreeList[i].Next = i + 1 < NumCaches ? &ThreadCacheFreeList[i + 1] : nullptr;
+				}
+			}
+			Cache = ThreadCacheFreeList;
+			ThreadCacheFreeList = Cache->Next;
+
+			FMemory::Memzero(Cache, sizeof(FThreadCache));
+			Cache->Next = ActiveThreadCaches;
+			ActiveThreadCaches = Cache;
+		}
+		FPlatformTLS::SetTlsValue(ThreadCacheTlsSlot, Cache);
+#endif
+	}
+
+	/** Returns all blocks cached by the calling thread to the global pools and stops caching on this thread. */
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+#ifdef USE_THREAD_CACHES
+		FThreadCache* Cache = GetThreadCache();
+		if( !Cache )
+		{
+			return;
+		}
+		FPlatformTLS::SetTlsValue(ThreadCacheTlsSlot, nullptr);
+
+		for( uint32 CacheIndex = 0; CacheIndex < POOL_COUNT; ++CacheIndex )
+		{
+			ReleaseThreadCacheBlocks(Cache, CacheIndex, Cache->NumFree[CacheIndex]);
+		}
+		checkSlow(Cache->CachedBytes == 0);
+
+		FScopeLock ScopedLock( &AccessGuard );
+		for( FThreadCache** CachePtr = &ActiveThreadCaches; *CachePtr; CachePtr = &(*CachePtr)->Next )
+		{
+			if( *CachePtr == Cache )
+			{
+				*CachePtr = Cache->Next;
+				break;
+			}
+		}
+		RetiredThreadCacheHits += Cache->Hits;
+		RetiredThreadCacheMisses += Cache->Misses;
+		Cache->Next = ThreadCacheFreeList;
+		ThreadCacheFreeList = Cache;
+#endif
+	}
+
 	/**
 	 * If possible determine the size of the memory allocated at the given address
 	 *
@@ -1142,12 +1439,18 @@ public:
 		SIZE_T	LocalCurrentAllocs = 0;
 		SIZE_T	LocalTotalAllocs = 0;
 		SIZE_T	LocalSlackCurrent = 0;
+		SIZE_T	LocalThreadCacheCurrent = 0;
+		uint64	LocalThreadCacheHits = 0;
+		uint64	LocalThreadCacheMisses = 0;
 
 		{
 #ifdef USE_INTERNAL_LOCKS
 			FScopeLock ScopedLock( &AccessGuard );
 #endif
 			UpdateSlackStat();
+#ifdef USE_THREAD_CACHES
+			GatherThreadCacheStats(LocalThreadCacheCurrent, LocalThreadCacheHits, LocalThreadCacheMisses);
+#endif
 
 			// Copy memory stats.
 			LocalOsCurrent = OsCurrent;
@@ -1170,6 +1473,10 @@ public:
 		SET_DWORD_STAT( STAT_Binned_CurrentAllocs, LocalCurrentAllocs );
 		SET_DWORD_STAT( STAT_Binned_TotalAllocs, LocalTotalAllocs );
 		SET_MEMORY_STAT( STAT_Binned_SlackCurrent, LocalSlackCurrent );
+		SET_MEMORY_STAT( STAT_Binned_ThreadCacheCurrent, LocalThreadCacheCurrent );
+		SET_DWORD_STAT( STAT_Binned_ThreadCacheHits, LocalThreadCacheHits );
+		SET_DWORD_STAT( STAT_Binned_ThreadCacheMisses, LocalThreadCacheMisses );
+		SET_FLOAT_STAT( STAT_Binned_ThreadCacheHitRate, LocalThreadCacheHits + LocalThreadCacheMisses ? 100.0f * LocalThreadCacheHits / (LocalThreadCacheHits + LocalThreadCacheMisses) : 0.0f );
 #endif
 	}
 
@@ -1204,6 +1511,17 @@ public:
 			BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Current Slack %.2f MB" ), SlackCurrent / (1024.0f * 1024.0f) );
 
 			BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Allocs      % 6i Current / % 6i Total" ), CurrentAllocs, TotalAllocs );
+#ifdef USE_THREAD_CACHES
+			{
+				FScopeLock ScopedLock( &AccessGuard );
+				SIZE_T ThreadCacheBytes;
+				uint64 ThreadCacheHits;
+				uint64 ThreadCacheMisses;
+				GatherThreadCacheStats(ThreadCacheBytes, ThreadCacheHits, ThreadCacheMisses);
+				const uint64 ThreadCacheRequests = ThreadCacheHits + ThreadCacheMisses;
+				BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Thread caches %.2f MB held, %llu hits / %llu misses (%.2f%% hit rate)" ), ThreadCacheBytes / (1024.0f * 1024.0f), ThreadCacheHits, ThreadCacheMisses, ThreadCacheRequests ? 100.0 * ThreadCacheHits / ThreadCacheRequests : 0.0 );
+			}
+#endif
 			MEM_TIME( BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "Seconds     % 5.3f" ), MemTime ) );
 			MEM_TIME( BufferedOutput.CategorizedLogf( LogMemory.GetCategoryName(), ELogVerbosity::Log, TEXT( "MSec/Allc   % 5.5f" ), 1000.0 * MemTime / MemAllocs ) );
 
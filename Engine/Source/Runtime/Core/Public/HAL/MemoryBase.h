@@ -95,6 +95,19 @@ public:
 	 * Free
 	 */
 	virtual void Free( void* Original ) = 0;
+
+	/**
+	 * Lets the allocator keep thread local caches for the calling thread. Must be paired with
+	 * ClearAndDisableTLSCachesOnCurrentThread before the thread exits.
+	 */
+	virtual void SetupTLSCachesOnCurrentThread()
+	{
+	}
+
+	/** Flushes any thread local caches of the calling thread back to the allocator and stops using them. */
+	virtual void ClearAndDisableTLSCachesOnCurrentThread()
+	{
+	}
 		
 	/** 
 	 * Handles any commands passed in on the command line
@@ -131,6 +131,12 @@ struct CORE_API FMemory
 
 	static SIZE_T GetAllocSize( void* Original );
 
+	/** Enables the allocator's thread local caches for the calling thread, see FMalloc::SetupTLSCachesOnCurrentThread. */
+	static void SetupTLSCachesOnCurrentThread();
+
+	/** Flushes and disables the allocator's thread local caches for the calling thread. */
+	static void ClearAndDisableTLSCachesOnCurrentThread();
+
 	/**
 	 * A helper function that will perform a series of random heap allocations to test
 	 * the internal validity of the heap. Note, this function will "leak" memory, but another call
@@ -251,5 +251,7 @@ FORCEINLINE ScalarRegister ScalarReciprocal(const ScalarRegister& A)
 #include "Transform.h"
 #endif
 
+#include "TransformBatch.h"
+
 #include "UnrealMatrix.h"
 
@@ -0,0 +1,465 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+
+#if ENABLE_VECTORIZED_TRANSFORM
+
+/**
+ * Four transforms in structure-of-arrays layout, every register holds one component of all four transforms.
+ *
+ * The single transform functions of FTransform spend most of their time shuffling the components
+ * of a quaternion around. In this layout every component is already in its own register, so batch
+ * operations are plain multiplies and adds, four transforms at a time.
+ */
+struct FTransformSoA
+{
+	/** X, Y, Z and W of the rotations. */
+	VectorRegister Rotation[4];
+	/** X, Y and Z of the translations. */
+	VectorRegister Translation[3];
+	/** X, Y and Z of the scales. */
+	VectorRegister Scale3D[3];
+} GCC_ALIGN(16);
+
+template <> struct TIsPODType<FTransformSoA> { enum { Value = true }; };
+
+
+/**
+ * Batch versions of the FTransform operations which are used on large arrays of transforms,
+ * e.g. when building component space bone transforms or blending poses.
+ *
+ * Results match the single transform functions up to float rounding.
+ */
+struct FTransformBatch
+{
+	/** Number of transforms processed together. */
+	static const int32 Width = 4;
+
+	/**
+	 * Computes OutTransforms[i] = A[i] * B[i], like FTransform::Multiply.
+	 * OutTransforms may be the same array as A or B.
+	 */
+	static void Multiply(FTransform* OutTransforms, const FTransform* A, const FTransform* B, int32 Num)
+	{
+		int32 Index = 0;
+		for (; Index + Width <= Num; Index += Width)
+		{
+			FTransformSoA SoA, SoB, SoOut;
+			Load(SoA, A + Index);
+			Load(SoB, B + Index);
+			Multiply(SoOut, SoA, SoB);
+			Store(SoOut, OutTransforms + Index);
+		}
+		for (; Index < Num; Index++)
+		{
+			FTransform::Multiply(OutTransforms + Index, A + Index, B + Index);
+		}
+	}
+
+	/**
+	 * Computes Transforms[Indices[i]] = A[Indices[i]] * Transforms[BIndices[i]], which is how a level of
+	 * a bone hierarchy is converted to component space. None of the transforms read through BIndices
+	 * may be written by the same call.
+	 */
+	static void MultiplyIndexed(FTransform* Transforms, const FTransform* A, const int32* Indices, const int32* BIndices, int32 Num)
+	{
+		int32 Index = 0;
+		for (; Index + Width <= Num; Index += Width)
+		{
+			FTransformSoA SoA, SoB, SoOut;
+			Gather(SoA, A, Indices + Index);
+			Gather(SoB, Transforms, BIndices + Index);
+			Multiply(SoOut, SoA, SoB);
+			Scatter(SoOut, Transforms, Indices + Index);
+		}
+		for (; Index < Num; Index++)
+		{
+			FTransform::Multiply(Transforms + Indices[Index], A + Indices[Index], Transforms + BIndices[Index]);
+		}
+	}
+
+	/**
+	 * Computes OutTransforms[i] = Transforms[i].Inverse().
+	 * OutTransforms may be the same array as Transforms.
+	 */
+	static void Inverse(FTransform* OutTransforms, const FTransform* Transforms, int32 Num)
+	{
+		int32 Index = 0;
+		for (; Index + Width <= Num; Index += Width)
+		{
+			FTransformSoA SoIn, SoOut;
+			Load(SoIn, Transforms + Index);
+			Inverse(SoOut, SoIn);
+			Store(SoOut, OutTransforms + Index);
+		}
+		for (; Index < Num; Index++)
+		{
+			OutTransforms[Index] = Transforms[Index].Inverse();
+		}
+	}
+
+	/**
+	 * Computes OutTransforms[i].Blend(A[i], B[i], Alpha).
+	 * OutTransforms may be the same array as A or B.
+	 *
+	 * A blend is too cheap to pay for converting to and from the structure-of-arrays layout, so this
+	 * only hoists the copy shortcuts out of the loop. Use the FTransformSoA version for data kept in that layout.
+	 */
+	static void Blend(FTransform* OutTransforms, const FTransform* A, const FTransform* B, float Alpha, int32 Num)
+	{
+		// Same shortcuts as FTransform::Blend, the copies are exact.
+		if (FMath::Abs(Alpha) <= ZERO_ANIMWEIGHT_THRESH || FMath::Abs(Alpha - 1.0f) <= ZERO_ANIMWEIGHT_THRESH)
+		{
+			const FTransform* Source = FMath::Abs(Alpha) <= ZERO_ANIMWEIGHT_THRESH ? A : B;
+			if (OutTransforms != Source)
+			{
+				FMemory::Memmove(OutTransforms, Source, Num * sizeof(FTransform));
+			}
+			return;
+		}
+
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			OutTransforms[Index].Blend(A[Index], B[Index], Alpha);
+		}
+	}
+
+public:
+
+	/**
+	 * Converts transforms to the structure-of-arrays layout. The last block is padded with identity transforms.
+	 *
+	 * @param OutSoA Receives (Num + 3) / 4 blocks.
+	 */
+	static void ToSoA(TArray<FTransformSoA>& OutSoA, const FTransform* Transforms, int32 Num)
+	{
+		const int32 NumBlocks = (Num + Width - 1) / Width;
+		OutSoA.Reset(NumBlocks);
+		OutSoA.AddUninitialized(NumBlocks);
+		for (int32 Block = 0; Block < NumBlocks; Block++)
+		{
+			const int32 First = Block * Width;
+			if (First + Width <= Num)
+			{
+				Load(OutSoA[Block], Transforms + First);
+			}
+			else
+			{
+				const FTransform Padded[Width] =
+				{
+					Transforms[First],
+					First + 1 < Num ? Transforms[First + 1] : FTransform::Identity,
+					First + 2 < Num ? Transforms[First + 2] : FTransform::Identity,
+					FTransform::Identity,
+				};
+				Load(OutSoA[Block], Padded);
+			}
+		}
+	}
+
+	/** Converts the first Num transforms of a structure-of-arrays layout back to transforms. */
+	static void FromSoA(FTransform* OutTransforms, const TArray<FTransformSoA>& SoA, int32 Num)
+	{
+		check(Num <= SoA.Num() * Width);
+		int32 Block = 0;
+		for (; (Block + 1) * Width <= Num; Block++)
+		{
+			Store(SoA[Block], OutTransforms + Block * Width);
+		}
+		if (Block * Width < Num)
+		{
+			FTransform Padded[Width];
+			Store(SoA[Block], Padded);
+			for (int32 Index = Block * Width; Index < Num; Index++)
+			{
+				OutTransforms[Index] = Padded[Index - Block * Width];
+			}
+		}
+	}
+
+	/** Structure-of-arrays version of Multiply, for data that is kept in that layout. */
+	static void Multiply(FTransformSoA* Out, const FTransformSoA* A, const FTransformSoA* B, int32 NumBlocks)
+	{
+		for (int32 Block = 0; Block < NumBlocks; Block++)
+		{
+			Multiply(Out[Block], A[Block], B[Block]);
+		}
+	}
+
+	/** Structure-of-arrays version of Inverse, for data that is kept in that layout. */
+	static void Inverse(FTransformSoA* Out, const FTransformSoA* Transforms, int32 NumBlocks)
+	{
+		for (int32 Block = 0; Block < NumBlocks; Block++)
+		{
+			Inverse(Out[Block], Transforms[Block]);
+		}
+	}
+
+	/** Structure-of-arrays version of Blend, for data that is kept in that layout. Doesn't take the copy shortcuts. */
+	static void Blend(FTransformSoA* Out, const FTransformSoA* A, const FTransformSoA* B, float Alpha, int32 NumBlocks)
+	{
+		const VectorRegister VAlpha = VectorLoadFloat1(&Alpha);
+		for (int32 Block = 0; Block < NumBlocks; Block++)
+		{
+			Blend(Out[Block], A[Block], B[Block], VAlpha);
+		}
+	}
+
+private:
+
+	/** Transposes four registers, rows become columns. */
+	static FORCEINLINE void Transpose(VectorRegister& R0, VectorRegister& R1, VectorRegister& R2, VectorRegister& R3)
+	{
+		const VectorRegister T0 = VectorShuffle(R0, R1, 0, 1, 0, 1);
+		const VectorRegister T1 = VectorShuffle(R0, R1, 2, 3, 2, 3);
+		const VectorRegister T2 = VectorShuffle(R2, R3, 0, 1, 0, 1);
+		const VectorRegister T3 = VectorShuffle(R2, R3, 2, 3, 2, 3);
+		R0 = VectorShuffle(T0, T2, 0, 2, 0, 2);
+		R1 = VectorShuffle(T0, T2, 1, 3, 1, 3);
+		R2 = VectorShuffle(T1, T3, 0, 2, 0, 2);
+		R3 = VectorShuffle(T1, T3, 1, 3, 1, 3);
+	}
+
+	/** Transposes four registers into three, dropping W. */
+	static FORCEINLINE void Transpose3(const VectorRegister& R0, const VectorRegister& R1, const VectorRegister& R2, const VectorRegister& R3, VectorRegister* Out)
+	{
+		const VectorRegister T0 = VectorShuffle(R0, R1, 0, 1, 0, 1);
+		const VectorRegister T1 = VectorShuffle(R0, R1, 2, 3, 2, 3);
+		const VectorRegister T2 = VectorShuffle(R2, R3, 0, 1, 0, 1);
+		const VectorRegister T3 = VectorShuffle(R2, R3, 2, 3, 2, 3);
+		Out[0] = VectorShuffle(T0, T2, 0, 2, 0, 2);
+		Out[1] = VectorShuffle(T0, T2, 1, 3, 1, 3);
+		Out[2] = VectorShuffle(T1, T3, 0, 2, 0, 2);
+	}
+
+	/** Transposes three registers back into four, W is set to 0. */
+	static FORCEINLINE void Untranspose3(const VectorRegister* In, VectorRegister& R0, VectorRegister& R1, VectorRegister& R2, VectorRegister& R3)
+	{
+		const VectorRegister Zero = VectorZero();
+		const VectorRegister T0 = VectorShuffle(In[0], In[1], 0, 1, 0, 1);
+		const VectorRegister T1 = VectorShuffle(In[0], In[1], 2, 3, 2, 3);
+		const VectorRegister T2 = VectorShuffle(In[2], Zero, 0, 1, 0, 1);
+		const VectorRegister T3 = VectorShuffle(In[2], Zero, 2, 3, 2, 3);
+		R0 = VectorShuffle(T0, T2, 0, 2, 0, 2);
+		R1 = VectorShuffle(T0, T2, 1, 3, 1, 3);
+		R2 = VectorShuffle(T1, T3, 0, 2, 0, 2);
+		R3 = VectorShuffle(T1, T3, 1, 3, 1, 3);
+	}
+
+	static FORCEINLINE void Load(FTransformSoA& Out, const FTransform* T0, const FTransform* T1, const FTransform* T2, const FTransform* T3)
+	{
+		Out.Rotation[0] = T0->Rotation;
+		Out.Rotation[1] = T1->Rotation;
+		Out.Rotation[2] = T2->Rotation;
+		Out.Rotation[3] = T3->Rotation;
+		Transpose(Out.Rotation[0], Out.Rotation[1], Out.Rotation[2], Out.Rotation[3]);
+		Transpose3(T0->Translation, T1->Translation, T2->Translation, T3->Translation, Out.Translation);
+		Transpose3(T0->Scale3D, T1->Scale3D, T2->Scale3D, T3->Scale3D, Out.Scale3D);
+	}
+
+	static FORCEINLINE void Store(const FTransformSoA& In, FTransform* T0, FTransform* T1, FTransform* T2, FTransform* T3)
+	{
+		VectorRegister R0 = In.Rotation[0];
+		VectorRegister R1 = In.Rotation[1];
+		VectorRegister R2 = In.Rotation[2];
+		VectorRegister R3 = In.Rotation[3];
+		Transpose(R0, R1, R2, R3);
+		T0->Rotation = R0;
+		T1->Rotation = R1;
+		T2->Rotation = R2;
+		T3->Rotation = R3;
+		Untranspose3(In.Translation, T0->Translation, T1->Translation, T2->Translation, T3->Translation);
+		Untranspose3(In.Scale3D, T0->Scale3D, T1->Scale3D, T2->Scale3D, T3->Scale3D);
+	}
+
+	static FORCEINLINE void Load(FTransformSoA& Out, const FTransform* Transforms)
+	{
+		Load(Out, Transforms, Transforms + 1, Transforms + 2, Transforms + 3);
+	}
+
+	static FORCEINLINE void Store(const FTransformSoA& In, FTransform* Transforms)
+	{
+		Store(In, Transforms, Transforms + 1, Transforms + 2, Transforms + 3);
+	}
+
+	static FORCEINLINE void Gather(FTransformSoA& Out, const FTransform* Transforms, const int32* Indices)
+	{
+		Load(Out, Transforms + Indices[0], Transforms + Indices[1], Transforms + Indices[2], Transforms + Indices[3]);
+	}
+
+	static FORCEINLINE void Scatter(const FTransformSoA& In, FTransform* Transforms, const int32* Indices)
+	{
+		Store(In, Transforms + Indices[0], Transforms + Indices[1], Transforms + Indices[2], Transforms + Indices[3]);
+	}
+
+	/** Out = Q1 * Q2, see VectorQuaternionMultiply2. */
+	static FORCEINLINE void QuaternionMultiply(VectorRegister* Out, const VectorRegister* Q1, const VectorRegister* Q2)
+	{
+		const VectorRegister X = VectorAdd(VectorMultiplyAdd(Q1[3], Q2[0], VectorMultiply(Q1[0], Q2[3])), VectorSubtract(VectorMultiply(Q1[1], Q2[2]), VectorMultiply(Q1[2], Q2[1])));
+		const VectorRegister Y = VectorAdd(VectorMultiplyAdd(Q1[3], Q2[1], VectorMultiply(Q1[1], Q2[3])), VectorSubtract(VectorMultiply(Q1[2], Q2[0]), VectorMultiply(Q1[0], Q2[2])));
+		const VectorRegister Z = VectorAdd(VectorMultiplyAdd(Q1[3], Q2[2], VectorMultiply(Q1[2], Q2[3])), VectorSubtract(VectorMultiply(Q1[0], Q2[1]), VectorMultiply(Q1[1], Q2[0])));
+		const VectorRegister W = VectorSubtract(VectorMultiply(Q1[3], Q2[3]), VectorMultiplyAdd(Q1[0], Q2[0], VectorMultiplyAdd(Q1[1], Q2[1], VectorMultiply(Q1[2], Q2[2]))));
+		Out[0] = X;
+		Out[1] = Y;
+		Out[2] = Z;
+		Out[3] = W;
+	}
+
+	/** Out = Q * V * Q^-1 for normalized Q, using V + 2W(Q x V) + 2Q x (Q x V). */
+	static FORCEINLINE void RotateVector(VectorRegister* Out, const VectorRegister* Q, const VectorRegister* V)
+	{
+		// T = 2 * (Q x V)
+		const VectorRegister CX = VectorSubtract(VectorMultiply(Q[1], V[2]), VectorMultiply(Q[2], V[1]));
+		const VectorRegister CY = VectorSubtract(VectorMultiply(Q[2], V[0]), VectorMultiply(Q[0], V[2]));
+		const VectorRegister CZ = VectorSubtract(VectorMultiply(Q[0], V[1]), VectorMultiply(Q[1], V[0]));
+		const VectorRegister TX = VectorAdd(CX, CX);
+		const VectorRegister TY = VectorAdd(CY, CY);
+		const VectorRegister TZ = VectorAdd(CZ, CZ);
+		// Out = V + W * T + Q x T
+		Out[0] = VectorAdd(VectorMultiplyAdd(Q[3], TX, V[0]), VectorSubtract(VectorMultiply(Q[1], TZ), VectorMultiply(Q[2], TY)));
+		Out[1] = VectorAdd(VectorMultiplyAdd(Q[3], TY, V[1]), VectorSubtract(VectorMultiply(Q[2], TX), VectorMultiply(Q[0], TZ)));
+		Out[2] = VectorAdd(VectorMultiplyAdd(Q[3], TZ, V[2]), VectorSubtract(VectorMultiply(Q[0], TY), VectorMultiply(Q[1], TX)));
+	}
+
+	/** See FTransform::Multiply. */
+	static FORCEINLINE void Multiply(FTransformSoA& Out, const FTransformSoA& A, const FTransformSoA& B)
+	{
+		// T(AxB) = Q(B)*S(B)*T(A)*-Q(B) + T(B)
+		VectorRegister ScaledTranslation[3];
+		VectorRegister RotatedTranslation[3];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			ScaledTranslation[Axis] = VectorMultiply(A.Translation[Axis], B.Scale3D[Axis]);
+		}
+		RotateVector(RotatedTranslation, B.Rotation, ScaledTranslation);
+
+		// Q(AxB) = Q(B)*Q(A)
+		QuaternionMultiply(Out.Rotation, B.Rotation, A.Rotation);
+
+		// S(AxB) = S(A)*S(B)
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Out.Translation[Axis] = VectorAdd(RotatedTranslation[Axis], B.Translation[Axis]);
+			Out.Scale3D[Axis] = VectorMultiply(A.Scale3D[Axis], B.Scale3D[Axis]);
+		}
+	}
+
+	/** See FTransform::Inverse, transforms with zero scale invert to the identity. */
+	static FORCEINLINE void Inverse(FTransformSoA& Out, const FTransformSoA& In)
+	{
+		const VectorRegister Zero = VectorZero();
+		const VectorRegister Small = GlobalVectorConstants::SmallNumber;
+
+		// S(~A) = 1/S(A), 0 where S(A) is 0
+		VectorRegister InvScale[3];
+		VectorRegister HasScaleMask = Zero;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const VectorRegister ZeroScaleMask = VectorCompareGE(Small, VectorAbs(In.Scale3D[Axis]));
+			InvScale[Axis] = VectorSelect(ZeroScaleMask, Zero, VectorReciprocalAccurate(In.Scale3D[Axis]));
+			HasScaleMask = VectorBitwiseOr(HasScaleMask, VectorCompareGT(VectorAbs(In.Scale3D[Axis]), Small));
+		}
+
+		// Q(~A) = -Q(A)
+		VectorRegister InvRotation[4];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			InvRotation[Axis] = VectorNegate(In.Rotation[Axis]);
+		}
+		InvRotation[3] = In.Rotation[3];
+
+		// T(~A) = -(Q(~A)*S(~A)*T(A)*Q(A))
+		VectorRegister ScaledTranslation[3];
+		VectorRegister RotatedTranslation[3];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			ScaledTranslation[Axis] = VectorMultiply(InvScale[Axis], In.Translation[Axis]);
+		}
+		RotateVector(RotatedTranslation, InvRotation, ScaledTranslation);
+
+		const VectorRegister One = VectorOne();
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Out.Rotation[Axis] = VectorSelect(HasScaleMask, InvRotation[Axis], Zero);
+			Out.Translation[Axis] = VectorSelect(HasScaleMask, VectorNegate(RotatedTranslation[Axis]), Zero);
+			Out.Scale3D[Axis] = VectorSelect(HasScaleMask, InvScale[Axis], One);
+		}
+		Out.Rotation[3] = VectorSelect(HasScaleMask, InvRotation[3], One);
+	}
+
+	/** See FTransform::Blend, without the copy shortcuts. */
+	static FORCEINLINE void Blend(FTransformSoA& Out, const FTransformSoA& A, const FTransformSoA& B, const VectorRegister& Alpha)
+	{
+		const VectorRegister Zero = VectorZero();
+		const VectorRegister OneMinusAlpha = VectorSubtract(VectorOne(), Alpha);
+
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Out.Translation[Axis] = VectorMultiplyAdd(VectorSubtract(B.Translation[Axis], A.Translation[Axis]), Alpha, A.Translation[Axis]);
+			Out.Scale3D[Axis] = VectorMultiplyAdd(VectorSubtract(B.Scale3D[Axis], A.Scale3D[Axis]), Alpha, A.Scale3D[Axis]);
+		}
+
+		// Shortest path, see VectorLerpQuat
+		const VectorRegister RotationDot = VectorMultiplyAdd(A.Rotation[0], B.Rotation[0], VectorMultiplyAdd(A.Rotation[1], B.Rotation[1], VectorMultiplyAdd(A.Rotation[2], B.Rotation[2], VectorMultiply(A.Rotation[3], B.Rotation[3]))));
+		const VectorRegister BiasTimesOneMinusAlpha = VectorSelect(VectorCompareGE(RotationDot, Zero), OneMinusAlpha, VectorNegate(OneMinusAlpha));
+		VectorRegister Rotation[4];
+		for (int32 Axis = 0; Axis < 4; Axis++)
+		{
+			Rotation[Axis] = VectorMultiplyAdd(A.Rotation[Axis], BiasTimesOneMinusAlpha, VectorMultiply(B.Rotation[Axis], Alpha));
+		}
+
+		// Renormalize, see VectorNormalizeQuaternion
+		const VectorRegister SquareSum = VectorMultiplyAdd(Rotation[0], Rotation[0], VectorMultiplyAdd(Rotation[1], Rotation[1], VectorMultiplyAdd(Rotation[2], Rotation[2], VectorMultiply(Rotation[3], Rotation[3]))));
+		const VectorRegister NonZeroMask = VectorCompareGE(SquareSum, GlobalVectorConstants::SmallLengthThreshold);
+		const VectorRegister InvLength = VectorReciprocalSqrtAccurate(SquareSum);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Out.Rotation[Axis] = VectorSelect(NonZeroMask, VectorMultiply(Rotation[Axis], InvLength), Zero);
+		}
+		Out.Rotation[3] = VectorSelect(NonZeroMask, VectorMultiply(Rotation[3], InvLength), VectorOne());
+	}
+};
+
+#else
+
+/**
+ * Batch versions of the FTransform operations which are used on large arrays of transforms.
+ * Without vector intrinsics these are plain loops over the single transform functions.
+ */
+struct FTransformBatch
+{
+	static void Multiply(FTransform* OutTransforms, const FTransform* A, const FTransform* B, int32 Num)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			FTransform::Multiply(OutTransforms + Index, A + Index, B + Index);
+		}
+	}
+
+	static void MultiplyIndexed(FTransform* Transforms, const FTransform* A, const int32* Indices, const int32* BIndices, int32 Num)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			FTransform::Multiply(Transforms + Indices[Index], A + Indices[Index], Transforms + BIndices[Index]);
+		}
+	}
+
+	static void Inverse(FTransform* OutTransforms, const FTransform* Transforms, int32 Num)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			OutTransforms[Index] = Transforms[Index].Inverse();
+		}
+	}
+
+	static void Blend(FTransform* OutTransforms, const FTransform* A, const FTransform* B, float Alpha, int32 Num)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			OutTransforms[Index].Blend(A[Index], B[Index], Alpha);
+		}
+	}
+};
+
+#endif // ENABLE_VECTORIZED_TRANSFORM
@@ -29,6 +29,7 @@ MS_ALIGN(16) struct FTransform
 	#define MAYBE_COREUOBJECT_API COREUOBJECT_API
 #endif 
 	friend MAYBE_COREUOBJECT_API class UScriptStruct* Z_Construct_UScriptStruct_FTransform();
+	friend struct FTransformBatch;
 
 protected:
 	/** Rotation of this transformation, as a quaternion */
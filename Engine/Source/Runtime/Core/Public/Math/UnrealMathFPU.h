@@ -410,6 +410,19 @@ FORCEINLINE VectorRegister VectorSelect(const VectorRegister& Mask, const Vector
 	);
 }
 
+/**
+ * Returns an integer bit-mask (0x00 - 0x0f) based on the sign-bit for each component in a vector.
+ *
+ * @param VecMask		Vector
+ * @return				Bit 0 = sign(VecMask.x), Bit 1 = sign(VecMask.y), Bit 2 = sign(VecMask.z), Bit 3 = sign(VecMask.w)
+ */
+FORCEINLINE int32 VectorMaskBits(const VectorRegister& VecMask)
+{
+	const uint32* M = (const uint32*)(&(VecMask.V[0]));
+
+	return (M[0] >> 31) | ((M[1] >> 31) << 1) | ((M[2] >> 31) << 2) | ((M[3] >> 31) << 3);
+}
+
 /**
  * Combines two vectors using bitwise OR (treating each vector as a 128 bit field)
  *
@@ -427,6 +427,18 @@ FORCEINLINE VectorRegister VectorSelect(const VectorRegister& Mask, const Vector
 	return vbslq_f32((IntVectorRegister)Mask, Vec1, Vec2);
 }
 
+/**
+ * Returns an integer bit-mask (0x00 - 0x0f) based on the sign-bit for each component in a vector.
+ *
+ * @param VecMask		Vector
+ * @return				Bit 0 = sign(VecMask.x), Bit 1 = sign(VecMask.y), Bit 2 = sign(VecMask.z), Bit 3 = sign(VecMask.w)
+ */
+FORCEINLINE int32 VectorMaskBits( VectorRegister VecMask )
+{
+	uint32x4_t Signs = vshrq_n_u32( (IntVectorRegister)VecMask, 31 );
+	return (int32)( vgetq_lane_u32( Signs, 0 ) | (vgetq_lane_u32( Signs, 1 ) << 1) | (vgetq_lane_u32( Signs, 2 ) << 2) | (vgetq_lane_u32( Signs, 3 ) << 3) );
+}
+
 /**
  * Combines two vectors using bitwise OR (treating each vector as a 128 bit field)
  *
@@ -13,6 +13,10 @@ enum ECompressionFlags
 	COMPRESS_None					= 0x00,
 	/** Compress with ZLIB															*/
 	COMPRESS_ZLIB 					= 0x01,
+	/** Compress with LZ4, fast decompression at a lower ratio than ZLIB				*/
+	COMPRESS_LZ4					= 0x02,
+	/** Compress with Zstd, needs a codec registered through FCompression::RegisterCodec	*/
+	COMPRESS_Zstd					= 0x04,
 	/** Prefer compression that compresses smaller (ONLY VALID FOR COMPRESSION)		*/
 	COMPRESS_BiasMemory 			= 0x10,
 	/** Prefer compression that compresses faster (ONLY VALID FOR COMPRESSION)		*/
@@ -39,6 +43,48 @@ enum ECompressionFlags
 #define LOADING_COMPRESSION_CHUNK_SIZE			131072
 #define SAVING_COMPRESSION_CHUNK_SIZE			LOADING_COMPRESSION_CHUNK_SIZE
 
+/**
+ * Interface for a compression format plugged into FCompression. Implementations need to be thread-safe as FCompression
+ * can be called from any thread.
+ */
+class ICompressionCodec
+{
+public:
+	virtual ~ICompressionCodec() {}
+
+	/** @return name of the format, used when selecting it by name e.g. on the command line */
+	virtual const TCHAR* GetName() const = 0;
+
+	/**
+	 * @param	UncompressedSize			Size of uncompressed data in bytes
+	 * @return The maximum possible bytes needed for compression of data buffer of size UncompressedSize
+	 */
+	virtual int32 CompressMemoryBound( int32 UncompressedSize ) const = 0;
+
+	/**
+	 * Compresses memory from uncompressed buffer and writes it to compressed buffer.
+	 *
+	 * @param	Flags						Full compression flags, so the codec can honor COMPRESS_BiasMemory / COMPRESS_BiasSpeed
+	 * @param	CompressedBuffer			Buffer compressed data is going to be written to
+	 * @param	CompressedSize	[in/out]	Size of CompressedBuffer, at exit will be size of compressed data
+	 * @param	UncompressedBuffer			Buffer containing uncompressed data
+	 * @param	UncompressedSize			Size of uncompressed data in bytes
+	 * @return true if compression succeeds, false if it fails because CompressedBuffer was too small or other reasons
+	 */
+	virtual bool CompressMemory( ECompressionFlags Flags, void* CompressedBuffer, int32& CompressedSize, const void* UncompressedBuffer, int32 UncompressedSize ) = 0;
+
+	/**
+	 * Uncompresses memory from compressed buffer and writes it to uncompressed buffer.
+	 *
+	 * @param	UncompressedBuffer			Buffer uncompressed data is going to be written to
+	 * @param	UncompressedSize			Exact size of the data after decompression in bytes
+	 * @param	CompressedBuffer			Buffer compressed data is going to be read from
+	 * @param	CompressedSize				Size of CompressedBuffer data in bytes
+	 * @return true if decompression succeeds, false otherwise
+	 */
+	virtual bool UncompressMemory( void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize ) = 0;
+};
+
 struct FCompression
 {
 	/** Maximum allowed size of an uncompressed buffer passed to CompressMemory or UncompressMemory. */
@@ -86,6 +132,35 @@ struct FCompression
 	 * @return true if compression succeeds, false if it fails because CompressedBuffer was too small or other reasons
 	 */
 	CORE_API static bool UncompressMemory( ECompressionFlags Flags, void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize, bool bIsSourcePadded = false );
+
+	/**
+	 * Registers a codec for a compression format, replacing the current one. ZLIB and LZ4 are registered by default.
+	 * Needs to happen before any data in that format is [de]compressed, typically on module startup.
+	 *
+	 * @param	Format						One of the compression type flags, e.g. COMPRESS_Zstd
+	 * @param	Codec						Codec to use for the format, nullptr to unregister. Not owned by FCompression.
+	 */
+	CORE_API static void RegisterCodec( ECompressionFlags Format, ICompressionCodec* Codec );
+
+	/**
+	 * @param	Flags						Compression flags, only the type part is looked at
+	 * @return true if a codec is registered for the compression type in Flags
+	 */
+	CORE_API static bool IsFormatAvailable( ECompressionFlags Flags );
+
+	/**
+	 * Looks up a compression format by codec name, e.g. "LZ4". The comparison is case insensitive.
+	 *
+	 * @param	Name						Name of the format
+	 * @return The compression type flag of a registered codec with that name, or COMPRESS_None if there is none
+	 */
+	CORE_API static ECompressionFlags GetFormatFromName( const TCHAR* Name );
+
+	/**
+	 * @param	Flags						Compression flags, only the type part is looked at
+	 * @return Name of the codec registered for the compression type in Flags, or "None"
+	 */
+	CORE_API static const TCHAR* GetFormatName( ECompressionFlags Flags );
 };
 
 
@@ -24,7 +24,15 @@ public:
 	enum
 	{
 		PageSize = 64 * 1024,
-		SmallPageSize = 1024
+		SmallPageSize = 1024,
+		/**
+		 * Pages threads take from and give back to the shared pools at once, see TLockFreeFixedSizeAllocator_TLSCache.
+		 * Every thread that allocates pages keeps up to one bundle cached: 8 * 64KB = 512KB of pages and 64 * 1KB = 64KB
+		 * of small pages. All threads together keep at most MaxCachedFullBundles more, and exiting threads give theirs back.
+		 */
+		PagesPerBundle = 8,
+		SmallPagesPerBundle = 64,
+		MaxCachedFullBundles = 8
 	};
 	FORCEINLINE static void *Alloc()
 	{
@@ -48,6 +56,13 @@ public:
 		TheSmallAllocator.Free(Mem);
 		STAT(UpdateStats());
 	}
+	/** Gives the pages cached by the calling thread back to the shared pools, called when a thread exits. */
+	static void ClearTLSCachesOnCurrentThread()
+	{
+		TheAllocator.FlushThreadLocalCache();
+		TheSmallAllocator.FlushThreadLocalCache();
+		STAT(UpdateStats());
+	}
 	static uint64 BytesUsed()
 	{
 		return uint64(TheAllocator.GetNumUsed().GetValue()) * PageSize + uint64(TheSmallAllocator.GetNumUsed().GetValue()) * SmallPageSize;
@@ -61,8 +76,9 @@ private:
 #if STATS
 	static void UpdateStats();
 #endif
-	static TLockFreeFixedSizeAllocator<PageSize, FThreadSafeCounter> TheAllocator;
-	static TLockFreeFixedSizeAllocator<SmallPageSize, FThreadSafeCounter> TheSmallAllocator;
+	// Pages are cached per thread, since command lists recorded on many threads at once allocate them all the time
+	static TLockFreeFixedSizeAllocator_TLSCache<PageSize, PagesPerBundle, FThreadSafeCounter> TheAllocator;
+	static TLockFreeFixedSizeAllocator_TLSCache<SmallPageSize, SmallPagesPerBundle, FThreadSafeCounter> TheSmallAllocator;
 };
 
 
@@ -481,6 +481,18 @@ public:
 		return( UsedMalloc->ValidateHeap() );
 	}
 
+	/** Lets the used allocator keep thread local caches for the calling thread. */
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	/** Flushes the used allocator's thread local caches for the calling thread. */
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
 	/**
 	* If possible determine the size of the memory allocated at the given address
 	*
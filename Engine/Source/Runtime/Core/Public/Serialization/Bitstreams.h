@@ -23,6 +23,11 @@ public:
 	 */
 	FBitWriter( int64 InMaxBits, bool AllowResize = false );
 
+	/**
+	 * Copies another bit writer, reusing this writer's buffer if it is large enough.
+	 */
+	FBitWriter& operator=( const FBitWriter& Other );
+
 	void SerializeBits( void* Src, int64 LengthBits );
 	void SerializeInt( uint32& Value, uint32 Max );
 
@@ -120,6 +125,11 @@ public:
 	 */
 	void Reset(void);
 
+	/**
+	 * Resets the bit writer as if it had just been constructed with the given size, reusing its buffer if it is large enough
+	 */
+	void Reinit( int64 InMaxBits, bool InAllowResize = false );
+
 	FORCEINLINE void WriteAlign()
 	{
 		Num = ( Num + 7 ) & ( ~0x07 );
@@ -1041,6 +1041,10 @@ struct FStatPacket
 	bool bBrokenCallstacks;
 	/** messages in this packet **/
 	FStatMessagesArray StatMessages;
+	/** messages in this packet in the compact format, only used while the packet is on its way to the stats thread. @see Compact **/
+	TArray<uint8> CompactMessages;
+	/** number of messages in CompactMessages **/
+	int32 NumCompactMessages;
 	/** Size we presize the message buffer to, currently the max of what we have seen for the last PRESIZE_MAX_NUM_ENTRIES. **/
 	TArray<int32> StatMessagesPresize;
 
@@ -1050,6 +1054,7 @@ struct FStatPacket
 		, ThreadId(0)
 		, ThreadType(EThreadType::Invalid)
 		, bBrokenCallstacks(false)
+		, NumCompactMessages(0)
 	{
 	}
 
@@ -1059,10 +1064,32 @@ struct FStatPacket
 		, ThreadId(Other.ThreadId)
 		, ThreadType(Other.ThreadType)
 		, bBrokenCallstacks(false)
+		, NumCompactMessages(0)
 		, StatMessagesPresize(Other.StatMessagesPresize)
 	{
 	}
 
+	/**
+	 * Moves StatMessages into CompactMessages. Names are replaced by indices into a table built on the fly and cycle counts
+	 * are stored as deltas to the previous cycle count, which takes a scope start or end from 16 bytes down to 2-4 bytes.
+	 */
+	CORE_API void Compact();
+
+	/** Moves CompactMessages back into StatMessages, the messages are restored bit for bit. */
+	CORE_API void Uncompact();
+
+	/** @return the number of messages in this packet, in either format. */
+	int32 GetNumMessages() const
+	{
+		return StatMessages.Num() + NumCompactMessages;
+	}
+
+	/** @return the memory used by the messages of this packet. */
+	int32 GetMessagesSize() const
+	{
+		return StatMessages.Num() * sizeof(FStatMessage) + CompactMessages.Num();
+	}
+
 	/** Initializes thread related properties for the stats packet. */
 	void SetThreadProperties()
 	{
@@ -1171,6 +1198,14 @@ class FThreadStats : FNoncopyable
 	CORE_API static bool bMasterDisableForever;
 	/** True if we running in the raw stats mode, all stats processing is disabled, captured stats messages are written in timely manner, memory overhead is minimal. */
 	CORE_API static bool bIsRawStatsActive;
+	/** Maximum number of messages a thread can collect before it has a chance to flush them, messages over the limit are dropped. */
+	CORE_API static int32 MaxMessagesPerThread;
+	/** Number of messages dropped because of MaxMessagesPerThread or the pending packet budget. */
+	CORE_API static FThreadSafeCounter NumDroppedMessages;
+	/** Number of packets dropped because the stats thread fell behind more than the pending packet budget. */
+	CORE_API static FThreadSafeCounter NumDroppedPackets;
+	/** Memory used by packets that have been sent but not processed by the stats thread yet. */
+	CORE_API static FThreadSafeCounter PendingPacketsSize;
 
 	/** The data we are eventually going to send to the stats thread. **/
 	FStatPacket Packet;
@@ -1181,6 +1216,9 @@ class FThreadStats : FNoncopyable
 	/** Tracks current stack depth for cycle counters. **/
 	int32 ScopeCount;
 
+	/** Depth of the cycle scopes that are being dropped because the packet was full, nested scopes are dropped along with them. **/
+	int32 DroppedScopeCount;
+
 	/** Tracks current stack depth for cycle counters. **/
 	int32 bWaitForExplicitFlush;
 
@@ -1256,6 +1294,9 @@ public:
 	/** Flushes the regular stats, the realtime stats. */
 	CORE_API void FlushRegularStats(bool bHasBrokenCallstacks, bool bForceFlush);
 
+	/** Sends a packet to the stats thread, or drops it if the stats thread is too far behind. */
+	CORE_API void SendPacket(FStatPacket* ToSend);
+
 	/** Flushes the raw stats, low memory and performance overhead, but not realtime. */
 	CORE_API void FlushRawStats(bool bHasBrokenCallstacks = false, bool bForceFlush = false);
 
@@ -1268,6 +1309,18 @@ public:
 		Packet.StatMessages.AddElement(StatMessage);
 	}
 
+	/** @return true if this thread can't collect any more messages until it flushes, new messages are dropped. */
+	FORCEINLINE_STATS bool IsPacketFull() const
+	{
+		return Packet.StatMessages.Num() >= MaxMessagesPerThread;
+	}
+
+	/** Counts a message that was dropped because the packet was full. */
+	static FORCEINLINE_STATS void DropMessage()
+	{
+		NumDroppedMessages.Increment();
+	}
+
 public:
 	/** This should be called when a thread exits, this deletes FThreadStats from the heap and TLS. **/
 	static void Shutdown()
@@ -1290,6 +1343,13 @@ public:
 		// these branches are handled by the optimizer
 		if (InStatOperation == EStatOperation::CycleScopeStart)
 		{
+			if (ThreadStats->DroppedScopeCount || ThreadStats->IsPacketFull())
+			{
+				// drop the whole scope, including everything nested in it, so that the callstacks stay intact
+				ThreadStats->DroppedScopeCount++;
+				DropMessage();
+				return;
+			}
 			ThreadStats->ScopeCount++;
 			ThreadStats->AddStatMessage(FStatMessage(InStatName, InStatOperation));
 
@@ -1300,7 +1360,17 @@ public:
 		}
 		else if (InStatOperation == EStatOperation::CycleScopeEnd)
 		{
-			if (ThreadStats->ScopeCount > ThreadStats->bWaitForExplicitFlush)
+			if (ThreadStats->DroppedScopeCount)
+			{
+				ThreadStats->DroppedScopeCount--;
+				DropMessage();
+				if (!ThreadStats->DroppedScopeCount && !ThreadStats->ScopeCount)
+				{
+					// this is our chance to send the full packet and start collecting again
+					ThreadStats->Flush();
+				}
+			}
+			else if (ThreadStats->ScopeCount > ThreadStats->bWaitForExplicitFlush)
 			{
 				ThreadStats->AddStatMessage(FStatMessage(InStatName, InStatOperation));
 				ThreadStats->ScopeCount--;
@@ -1324,6 +1394,15 @@ public:
 		if (!InStatName.IsNone() && WillEverCollectData())
 		{
 			FThreadStats* ThreadStats = GetThreadStats();
+			if (ThreadStats->IsPacketFull())
+			{
+				DropMessage();
+				if (!ThreadStats->ScopeCount)
+				{
+					ThreadStats->Flush();
+				}
+				return;
+			}
 			ThreadStats->AddStatMessage(FStatMessage(InStatName, InStatOperation, Value, bIsCycle));
 			if(!ThreadStats->ScopeCount)
 			{
@@ -44,7 +44,14 @@ namespace EStatMagicWithHeader
 		 *	New low-level raw stats with memory profiler functionality.
 		 *  !!CAUTION!! Not backward compatible with version 4.
 		 */
-		VERSION_5 = 5
+		VERSION_5 = 5,
+
+		/**
+		 *	Data is written in chunks, each with a header carrying its frame range and compression format.
+		 *	A chunk table is written at the end of the file, which allows reading any range of frames without reading the whole file.
+		 */
+		VERSION_6 = 6,
+		HAS_CHUNKED_DATA_VER = VERSION_6,
 	};
 }
 
@@ -65,9 +72,79 @@ struct EStatsFileConstants
 
 		/** Indicates that the compression is disabled for the data. */
 		NO_COMPRESSION = 0,
+
+		/** Indicates the start of a chunk header, only used for the chunked data. */
+		CHUNK_MARKER = 0xC4D1A5E7,
+
+		/** Size of the uncompressed data after which the raw stats are sent as a new chunk. */
+		TARGET_CHUNK_SIZE = 512 * 1024,
 	};
 };
 
+/*-----------------------------------------------------------------------------
+	FStatsChunkInfo
+-----------------------------------------------------------------------------*/
+
+/** Describes one chunk of the stats data, stored in the chunk header and in the chunk table. */
+struct FStatsChunkInfo
+{
+	/** Default constructor. */
+	FStatsChunkInfo()
+		: FileOffset( 0 )
+		, FirstFrame( -1 )
+		, LastFrame( -1 )
+		, CompressionFlags( COMPRESS_None )
+		, CompressedSize( 0 )
+		, UncompressedSize( 0 )
+	{}
+
+	/** Adds a frame to the frame range of this chunk. */
+	void AddFrame( int64 Frame )
+	{
+		FirstFrame = FirstFrame < 0 ? Frame : FMath::Min( FirstFrame, Frame );
+		LastFrame = FMath::Max( LastFrame, Frame );
+	}
+
+	/** Whether this chunk contains any frame of the specified frame range. */
+	bool Overlaps( int64 InFirstFrame, int64 InLastFrame ) const
+	{
+		return FirstFrame <= InLastFrame && LastFrame >= InFirstFrame;
+	}
+
+	/** Serializes the part of the chunk info which is stored in the chunk header. */
+	void SerializeHeader( FArchive& Ar )
+	{
+		Ar << FirstFrame << LastFrame << CompressionFlags;
+	}
+
+	/** Serialization operator, used for the chunk table. */
+	friend FArchive& operator << (FArchive& Ar, FStatsChunkInfo& Data)
+	{
+		Ar << Data.FileOffset;
+		Data.SerializeHeader( Ar );
+		Ar << Data.CompressedSize << Data.UncompressedSize;
+		return Ar;
+	}
+
+	/** Offset of the chunk header in the stats file. */
+	int64 FileOffset;
+
+	/** First frame which has data in this chunk. */
+	int64 FirstFrame;
+
+	/** Last frame which has data in this chunk. */
+	int64 LastFrame;
+
+	/** Compression format of the chunk data, COMPRESS_None if the data is stored uncompressed. */
+	int32 CompressionFlags;
+
+	/** Size of the chunk data in the file, without the chunk header. */
+	int32 CompressedSize;
+
+	/** Size of the chunk data after uncompressing. */
+	int32 UncompressedSize;
+};
+
 /*-----------------------------------------------------------------------------
 	FCompressedStatsData
 -----------------------------------------------------------------------------*/
@@ -86,8 +163,36 @@ struct CORE_API FCompressedStatsData
 		: SrcData( InSrcData )
 		, DestData( InDestData )
 		, bEndOfCompressedData( false )
+		, bChunk( false )
 	{}
 
+	/**
+	 * Makes the saved data a chunk with the specified frame range, which can be found through the chunk table.
+	 * Only valid for the stats files with the chunked data.
+	 */
+	void SetChunkFrames( int64 FirstFrame, int64 LastFrame )
+	{
+		bChunk = true;
+		ChunkInfo.FirstFrame = FirstFrame;
+		ChunkInfo.LastFrame = LastFrame;
+	}
+
+	/**
+	 * @return information about the saved or loaded chunk, only valid if the data is a chunk
+	 */
+	const FStatsChunkInfo& GetChunkInfo() const
+	{
+		return ChunkInfo;
+	}
+
+	/**
+	 * @return true if the saved or loaded data is a chunk
+	 */
+	bool IsChunk() const
+	{
+		return bChunk;
+	}
+
 	/**
 	 * Writes a special data to mark the end of the compressed data.
 	 */
@@ -120,6 +225,12 @@ protected:
 	/** Compress the data and writes to the archive. */
 	void WriteCompressed( FArchive& Writer )
 	{
+		if( bChunk )
+		{
+			WriteChunk( Writer );
+			return;
+		}
+
 		int32 UncompressedSize = SrcData.Num();
 		if( UncompressedSize > EStatsFileConstants::MAX_COMPRESSED_SIZE - EStatsFileConstants::DUMMY_HEADER_SIZE )
 		{
@@ -139,12 +250,52 @@ protected:
 		}
 	}
 
+	/** Compresses the data as a chunk and writes it with the chunk header to the archive. */
+	void WriteChunk( FArchive& Writer )
+	{
+		ChunkInfo.FileOffset = Writer.Tell();
+		ChunkInfo.UncompressedSize = SrcData.Num();
+		ChunkInfo.CompressionFlags = FCompression::IsFormatAvailable( COMPRESS_LZ4 ) ? COMPRESS_LZ4 : COMPRESS_ZLIB;
+
+		// Chunks are not limited by MAX_COMPRESSED_SIZE, so size the buffer for the worst case.
+		DestData.Reset();
+		DestData.AddUninitialized( FCompression::CompressMemoryBound( (ECompressionFlags)ChunkInfo.CompressionFlags, ChunkInfo.UncompressedSize ) );
+		ChunkInfo.CompressedSize = DestData.Num();
+
+		const bool bResult = ChunkInfo.UncompressedSize > 0 && FCompression::CompressMemory( (ECompressionFlags)ChunkInfo.CompressionFlags, DestData.GetData(), ChunkInfo.CompressedSize, SrcData.GetData(), ChunkInfo.UncompressedSize );
+		const bool bStoreUncompressed = !bResult || ChunkInfo.CompressedSize >= ChunkInfo.UncompressedSize;
+		if( bStoreUncompressed )
+		{
+			ChunkInfo.CompressionFlags = COMPRESS_None;
+			ChunkInfo.CompressedSize = ChunkInfo.UncompressedSize;
+		}
+
+		int32 Marker = EStatsFileConstants::CHUNK_MARKER;
+		Writer << Marker;
+		ChunkInfo.SerializeHeader( Writer );
+		Writer << ChunkInfo.CompressedSize << ChunkInfo.UncompressedSize;
+		Writer.Serialize( bStoreUncompressed ? SrcData.GetData() : DestData.GetData(), ChunkInfo.CompressedSize );
+	}
+
 	/** Reads the data and decompresses it. */
 	void ReadCompressed( FArchive& Reader )
 	{
 		int32 CompressedSize = 0;
 		int32 UncompressedSize = 0;
-		Reader << CompressedSize << UncompressedSize;
+		Reader << CompressedSize;
+
+		// Chunked data, read the chunk header and the data in its compression format.
+		if( CompressedSize == EStatsFileConstants::CHUNK_MARKER )
+		{
+			bChunk = true;
+			ChunkInfo.FileOffset = Reader.Tell() - sizeof( int32 );
+			ChunkInfo.SerializeHeader( Reader );
+			Reader << ChunkInfo.CompressedSize << ChunkInfo.UncompressedSize;
+			const bool bResult = ReadChunkData( Reader, ChunkInfo, SrcData, DestData );
+			check( bResult );
+			return;
+		}
+		Reader << UncompressedSize;
 
 		if( CompressedSize == EStatsFileConstants::END_OF_COMPRESSED_DATA && UncompressedSize == EStatsFileConstants::END_OF_COMPRESSED_DATA )
 		{
@@ -171,6 +322,37 @@ protected:
 	}
 
 public:
+	/**
+	 * Reads the data of a chunk whose header has already been read and uncompresses it.
+	 *
+	 * @param Reader - archive positioned at the chunk data
+	 * @param Chunk - chunk to read
+	 * @param SrcData - buffer for the compressed data
+	 * @param DestData - receives the uncompressed data
+	 *
+	 * @return true if the chunk data could be read and uncompressed
+	 */
+	static bool ReadChunkData( FArchive& Reader, const FStatsChunkInfo& Chunk, TArray<uint8>& SrcData, TArray<uint8>& DestData )
+	{
+		if( Chunk.CompressedSize < 0 || Chunk.UncompressedSize < 0 || Reader.Tell() + Chunk.CompressedSize > Reader.TotalSize() )
+		{
+			return false;
+		}
+
+		DestData.Reset( Chunk.UncompressedSize );
+		DestData.AddUninitialized( Chunk.UncompressedSize );
+		if( Chunk.CompressionFlags == COMPRESS_None )
+		{
+			Reader.Serialize( DestData.GetData(), Chunk.UncompressedSize );
+			return !Reader.IsError();
+		}
+
+		SrcData.Reset( Chunk.CompressedSize );
+		SrcData.AddUninitialized( Chunk.CompressedSize );
+		Reader.Serialize( SrcData.GetData(), Chunk.CompressedSize );
+		return !Reader.IsError() && FCompression::UncompressMemory( (ECompressionFlags)Chunk.CompressionFlags, DestData.GetData(), Chunk.UncompressedSize, SrcData.GetData(), Chunk.CompressedSize );
+	}
+
 	/**
 	 * @return true if we reached the end of the compressed data.
 	 */
@@ -188,6 +370,12 @@ protected:
 
 	/** Set to true if we reached the end of the compressed data. */
 	bool bEndOfCompressedData;
+
+	/** Set to true if the data is a chunk. */
+	bool bChunk;
+
+	/** Information about the chunk, if the data is a chunk. */
+	FStatsChunkInfo ChunkInfo;
 };
 
 /*-----------------------------------------------------------------------------
@@ -206,6 +394,8 @@ struct FStatsStreamHeader
 		, MetadataMessagesOffset( 0 )
 		, NumMetadataMessages( 0 )
 		, bRawStatsFile( false )
+		, DataOffset( 0 )
+		, ChunkTableOffset( 0 )
 	{}
 
 	/**
@@ -237,6 +427,12 @@ struct FStatsStreamHeader
 	/** Whether this stats file uses raw data, required for thread view/memory profiling/advanced profiling. */
 	bool bRawStatsFile;
 
+	/** Offset in the file for the first chunk, written before any chunk so that unfinalized files can be read. Only for the chunked data. */
+	uint64	DataOffset;
+
+	/** Offset in the file for the chunk table. Serialized as TArray<FStatsChunkInfo>. Only for the chunked data. */
+	uint64	ChunkTableOffset;
+
 	/** Whether this stats file has all names stored at the end of file. */
 	bool IsFinalized() const
 	{
@@ -249,6 +445,12 @@ struct FStatsStreamHeader
 		return Version >= EStatMagicWithHeader::HAS_COMPRESSED_DATA_VER;
 	}
 
+	/** Whether this stats file contains chunked data, which can be read through FStatsReadFile. */
+	bool HasChunkedData() const
+	{
+		return Version >= EStatMagicWithHeader::HAS_CHUNKED_DATA_VER;
+	}
+
 	/** Serialization operator. */
 	friend FArchive& operator << (FArchive& Ar, FStatsStreamHeader& Header)
 	{
@@ -273,6 +475,12 @@ struct FStatsStreamHeader
 
 		Ar << Header.bRawStatsFile;
 
+		if( Header.HasChunkedData() )
+		{
+			Ar << Header.DataOffset
+				<< Header.ChunkTableOffset;
+		}
+
 		return Ar;
 	}
 };
@@ -347,6 +555,16 @@ protected:
 	 */
 	TArray<FStatsFrameInfo> FramesInfo;
 
+	/** Frame range of the data in OutData, becomes the frame range of the chunk. */
+	FStatsChunkInfo OutDataChunk;
+
+	/**
+	 *  Array of chunks already written.
+	 *  !!CAUTION!!
+	 *  Only modified in the async write thread.
+	 */
+	TArray<FStatsChunkInfo> ChunksInfo;
+
 protected:
 	/** Default constructor. */
 	IStatsWriteFile();
@@ -496,6 +714,8 @@ protected:
 	 */
 	void WriteFrame( int64 TargetFrame )
 	{
+		// Each frame is a chunk.
+		OutDataChunk.AddFrame( TargetFrame );
 		WriteFrame( TargetFrame, false );
 		SendTask();
 	}
@@ -583,7 +803,7 @@ public:
 	// @TODO yrx 2014-12-02 Add a better way to read the file.
 
 	/** Reads a stat packed from the specified archive. */
-	void ReadStatPacket( FArchive& Ar, FStatPacket& StatPacked )
+	void ReadStatPacket( FArchive& Ar, FStatPacket& StatPacked, bool bHasFNameMap = true )
 	{
 		Ar << StatPacked.Frame;
 		Ar << StatPacked.ThreadId;
@@ -598,7 +818,7 @@ public:
 		StatPacked.StatMessages.Reserve( NumMessages );
 		for( int32 MessageIndex = 0; MessageIndex < NumMessages; ++MessageIndex )
 		{
-			new(StatPacked.StatMessages) FStatMessage( ReadMessage( Ar, true ) );
+			new(StatPacked.StatMessages) FStatMessage( ReadMessage( Ar, bHasFNameMap ) );
 		}
 	}
 
@@ -741,6 +961,124 @@ public:
 	}
 };
 
+/**
+ * Random access reader for the stats files with the chunked data.
+ * Only reads the header, the metadata and the chunk table when opened, the stats data is read per chunk on demand,
+ * so any range of frames can be read from captures of any size. Files that were never finalized, e.g. because
+ * the capture crashed, are opened by scanning the chunk headers.
+ * FNames are sent once per stream, so chunks rely on the FName table of the finalized files. Without it, the chunks
+ * before the first chunk read are read once to collect the FNames.
+ * Not thread-safe, each thread needs its own reader.
+ */
+class CORE_API FStatsReadFile
+{
+public:
+	/** Default constructor. */
+	FStatsReadFile()
+		: FileReader( nullptr )
+		, NumChunksWithFNames( 0 )
+	{}
+
+	/** Destructor. */
+	~FStatsReadFile()
+	{
+		Close();
+	}
+
+	/**
+	 * Opens the specified stats file and reads everything except the stats data.
+	 *
+	 * @param Filename - stats file to open
+	 *
+	 * @return true if the file could be opened and has the chunked data
+	 */
+	bool Open( const FString& Filename );
+
+	/** Closes the file. */
+	void Close();
+
+	/** Stats stream header of the file. */
+	const FStatsStreamHeader& GetHeader() const
+	{
+		return Stream.Header;
+	}
+
+	/** Metadata messages of the file. */
+	const TArray<FStatMessage>& GetMetadataMessages() const
+	{
+		return MetadataMessages;
+	}
+
+	/** All chunks of the file, in the file order. */
+	const TArray<FStatsChunkInfo>& GetChunks() const
+	{
+		return Chunks;
+	}
+
+	/** First frame with data in the file, -1 if the file has no data. */
+	int64 GetFirstFrame() const;
+
+	/** Last frame with data in the file, -1 if the file has no data. */
+	int64 GetLastFrame() const;
+
+	/** Finds all chunks with data for the specified frame range. */
+	void FindChunks( int64 FirstFrame, int64 LastFrame, TArray<int32>& out_ChunkIndices ) const;
+
+	/**
+	 * Reads and uncompresses the data of the specified chunk.
+	 * The data may use FNames sent in the previous chunks, ReadStatPackets and ReadMessages translate them.
+	 *
+	 * @return true if the chunk could be read
+	 */
+	bool ReadChunk( int32 ChunkIndex, TArray<uint8>& out_Data );
+
+	/**
+	 * Reads all raw stat packets of the specified frame range, only valid for the raw stats files.
+	 *
+	 * @return true if all chunks could be read
+	 */
+	bool ReadStatPackets( int64 FirstFrame, int64 LastFrame, FStatPacketArray& out_Packets );
+
+	/**
+	 * Reads the condensed stat messages of the specified frame range, only valid for the regular stats files.
+	 *
+	 * @return true if all chunks could be read
+	 */
+	bool ReadMessages( int64 FirstFrame, int64 LastFrame, TArray<FStatMessage>& out_Messages );
+
+protected:
+	/** Rebuilds the chunk table from the chunk headers, used for the files that were never finalized. */
+	void ScanChunks();
+
+	/**
+	 * Reads the FNames sent in the chunks before the specified chunk, only does any work for the files without the FName table.
+	 *
+	 * @return false if any of these chunks could not be read, some FNames will be unknown
+	 */
+	bool ReadFNamesBeforeChunk( int32 ChunkIndex );
+
+	/** Stats file archive. */
+	FArchive* FileReader;
+
+	/** Stream used to read the header and translate the FNames. */
+	FStatsReadStream Stream;
+
+	/** Metadata messages of the file. */
+	TArray<FStatMessage> MetadataMessages;
+
+	/** Chunk table of the file. */
+	TArray<FStatsChunkInfo> Chunks;
+
+	/** Number of chunks, counted from the first one, whose FNames have already been read. */
+	int32 NumChunksWithFNames;
+
+	/** Buffer for the compressed data. */
+	TArray<uint8> CompressedData;
+
+	/** Buffer for the uncompressed data. */
+	TArray<uint8> UncompressedData;
+};
+
 
 /*-----------------------------------------------------------------------------
 	Commands functionality
@@ -85,6 +85,16 @@ public:
 		UsedMalloc->DumpAllocatorStats( Ar );
 	}
 
+	virtual void SetupTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->SetupTLSCachesOnCurrentThread();
+	}
+
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+	{
+		UsedMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+	}
+
 	virtual bool ValidateHeap() override
 	{
 		return UsedMalloc->ValidateHeap();
@@ -329,6 +329,14 @@ bool FUntypedBulkData::CanLoadFromDisk() const
  */
 ECompressionFlags FUntypedBulkData::GetDecompressionFlags() const
 {
+	if( BulkDataFlags & BULKDATA_SerializeCompressedLZ4 )
+	{
+		return COMPRESS_LZ4;
+	}
+	if( BulkDataFlags & BULKDATA_SerializeCompressedZstd )
+	{
+		return COMPRESS_Zstd;
+	}
 	return (BulkDataFlags & BULKDATA_SerializeCompressedZLIB) ? COMPRESS_ZLIB : COMPRESS_None;
 }
 
@@ -650,13 +658,16 @@ void FUntypedBulkData::StartSerializingBulkData(FArchive& Ar, UObject* Owner, in
 			BulkDataAsync = FMemory::Realloc(BulkDataAsync, GetBulkDataSize());
 		}
 
-		FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent);
-		checkf(Ar != NULL, TEXT("Attempted to load bulk data from an invalid filename '%s'."), *Filename);
+		if (!SerializeBulkDataFromMappedFile(BulkDataAsync))
+		{
+			FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent);
+			checkf(Ar != NULL, TEXT("Attempted to load bulk data from an invalid filename '%s'."), *Filename);
 
-		// Seek to the beginning of the bulk data in the file.
-		Ar->Seek(BulkDataOffsetInFile);
-		SerializeBulkData(*Ar, BulkDataAsync);
-		delete Ar;
+			// Seek to the beginning of the bulk data in the file.
+			Ar->Seek(BulkDataOffsetInFile);
+			SerializeBulkData(*Ar, BulkDataAsync);
+			delete Ar;
+		}
 
 		return true;
 	});
@@ -1020,7 +1031,7 @@ void FUntypedBulkData::DetachFromArchive( FArchive* Ar, bool bEnsureBulkDataIsLo
 /**
  * Sets whether we should store the data compressed on disk.
  *
- * @param CompressionFlags	Flags to use for compressing the data. Use COMPRESS_NONE for no compression, or something like COMPRESS_ZLIB to compress the data
+ * @param CompressionFlags	Flags to use for compressing the data. Use COMPRESS_NONE for no compression, or COMPRESS_ZLIB, COMPRESS_LZ4 or COMPRESS_Zstd to compress the data
  */
 void FUntypedBulkData::StoreCompressedOnDisk( ECompressionFlags CompressionFlags )
 {
@@ -1037,8 +1048,13 @@ void FUntypedBulkData::StoreCompressedOnDisk( ECompressionFlags CompressionFlags
 		else
 		{
 			// make sure a valid compression format was specified
-			check(CompressionFlags & COMPRESS_ZLIB);
-			BulkDataFlags |= (CompressionFlags & COMPRESS_ZLIB) ? BULKDATA_SerializeCompressedZLIB : BULKDATA_None;
+			const ECompressionFlags Format = (ECompressionFlags)(CompressionFlags & COMPRESSION_FLAGS_TYPE_MASK);
+			check(Format == COMPRESS_ZLIB || Format == COMPRESS_LZ4 || Format == COMPRESS_Zstd);
+			check(FCompression::IsFormatAvailable(Format));
+
+			// only one format can be set at a time
+			BulkDataFlags &= ~BULKDATA_SerializeCompressed;
+			BulkDataFlags |= (Format == COMPRESS_LZ4) ? BULKDATA_SerializeCompressedLZ4 : (Format == COMPRESS_Zstd) ? BULKDATA_SerializeCompressedZstd : BULKDATA_SerializeCompressedZLIB;
 
 			// make sure we are not forcing the bulkdata to be stored inline if we use compression
 			BulkDataFlags &= ~BULKDATA_ForceInlinePayload;
@@ -1250,6 +1266,42 @@ bool FUntypedBulkData::FlushAsyncLoading(void* Dest)
 	return bIsLoadingAsync;
 }
 
+/**
+ * Serializes the bulk data straight out of the memory mapping of the pak file containing Filename. This skips creating
+ * a file reader and its internal buffer, the payload is copied (or decompressed) from the mapped pages into Dest.
+ * Only used with -MMapPaks, where each pak file is mapped once when it is mounted and this just takes a view of it.
+ *
+ * @param Dest Memory to serialize data into
+ * @return true if the data was serialized, false if the file isn't mapped and needs to be read with a file reader
+ */
+bool FUntypedBulkData::SerializeBulkDataFromMappedFile( void* Dest )
+{
+	// The pak platform file is set up before anything is loaded, look it up only once.
+	static const bool bMMapPaks = FParse::Param(FCommandLine::Get(), TEXT("MMapPaks"));
+	static IPlatformFile* const PakPlatformFile = bMMapPaks ? FPlatformFileManager::Get().FindPlatformFile(TEXT("PakFile")) : nullptr;
+	if (!PakPlatformFile)
+	{
+		return false;
+	}
+
+	TAutoPtr<IMappedFileHandle> MappedFile(PakPlatformFile->OpenMapped(*Filename));
+	if (!MappedFile.IsValid())
+	{
+		return false;
+	}
+	TAutoPtr<IMappedFileRegion> MappedRegion(MappedFile->MapRegion(BulkDataOffsetInFile, BulkDataSizeOnDisk));
+	if (!MappedRegion.IsValid() || MappedRegion->GetMappedSize() != BulkDataSizeOnDisk)
+	{
+		return false;
+	}
+
+	FBufferReader Ar((void*)MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), false);
+	SerializeBulkData(Ar, Dest);
+	// The region has to be closed before the file it was mapped from
+	MappedRegion.Reset();
+	return true;
+}
+
 /**
  * Loads the data from disk into the specified memory block. This requires us still being attached to an
  * archive we can use for serialization.
@@ -1306,13 +1358,16 @@ void FUntypedBulkData::LoadDataIntoMemory( void* Dest )
 		// load from the specied filename when the linker has been cleared
 		checkf( Filename != TEXT(""), TEXT( "Attempted to load bulk data without a proper filename." ) );
 	
-		FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent);
-		checkf( Ar != NULL, TEXT( "Attempted to load bulk data from an invalid filename '%s'." ), *Filename );
+		if (!SerializeBulkDataFromMappedFile(Dest))
+		{
+			FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent);
+			checkf( Ar != NULL, TEXT( "Attempted to load bulk data from an invalid filename '%s'." ), *Filename );
 	
-		// Seek to the beginning of the bulk data in the file.
-		Ar->Seek( BulkDataOffsetInFile );
-		SerializeBulkData( *Ar, Dest );
-		delete Ar;
+			// Seek to the beginning of the bulk data in the file.
+			Ar->Seek( BulkDataOffsetInFile );
+			SerializeBulkData( *Ar, Dest );
+			delete Ar;
+		}
 	}
 #endif // WITH_EDITOR
 }
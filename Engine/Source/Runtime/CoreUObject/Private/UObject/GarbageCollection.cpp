@@ -51,6 +51,16 @@ static volatile bool GIsRunningParallelReachability = false;
 /** Whether we are currently purging an object in the GC purge pass. */
 static bool GIsPurgingObject = false;
 
+/** Whether an incremental reachability pass has started and not finished yet. */
+COREUOBJECT_API bool GIsIncrementalReachabilityPending = false;
+/** Keep flags of the incremental reachability pass in progress. */
+static EObjectFlags GIncrementalReachabilityKeepFlags = RF_NoFlags;
+/** Objects of the incremental pass that are known to be reachable but whose references have not been processed yet. */
+static TArray<UObject*> GIncrementalObjectsToSerialize;
+/** Objects marked by the write barrier or created while the incremental pass is running. Guarded by GIncrementalBarrierCritical. */
+static TArray<UObject*> GIncrementalBarrierObjects;
+static FCriticalSection GIncrementalBarrierCritical;
+
 /**
  * If set and VERIFY_DISREGARD_GC_ASSUMPTIONS is true, we verify GC assumptions about "Disregard For GC" objects. We also
  * verify that no unreachable actors/ components are referenced if VERIFY_NO_UNREACHABLE_OBJECTS_ARE_REFERENCED
@@ -381,25 +391,31 @@ private:
 		int32		LoopStartIndex;
 	};
 
-	class FGCTask
+	/** Number of objects in a unit of work that can be handed to another reachability worker */
+	enum { GCWorkChunkSize = 256 };
+
+	/** Fixed size block of objects that still need their references processed. */
+	struct FGCWorkChunk
+	{
+		UObject*	Objects[GCWorkChunkSize];
+		int32		Num;
+	};
+
+	/** Runs one reachability worker on a task graph thread. */
+	class FGCWorkerTask
 	{
 		FArchiveRealtimeGC*	Owner;
-		TArray<UObject*>	ObjectsToSerialize;
+		int32				WorkerIndex;
 
 	public:
-		FGCTask(FArchiveRealtimeGC* InOwner, const TArray<UObject*>* InObjectsToSerialize,int32 StartIndex, int32 NumObjects)
+		FGCWorkerTask(FArchiveRealtimeGC* InOwner, int32 InWorkerIndex)
 			: Owner(InOwner)
+			, WorkerIndex(InWorkerIndex)
 		{
-			ObjectsToSerialize.Reserve(NumObjects);
-			while (NumObjects)
-			{
-				ObjectsToSerialize.Add((*InObjectsToSerialize)[StartIndex++]);
-				NumObjects--;
-			}
 		}
 		FORCEINLINE TStatId GetStatId() const
 		{
-			RETURN_QUICK_DECLARE_CYCLE_STAT(FGCTask, STATGROUP_TaskGraphTasks);
+			RETURN_QUICK_DECLARE_CYCLE_STAT(FGCWorkerTask, STATGROUP_TaskGraphTasks);
 		}
 		static ENamedThreads::Type GetDesiredThread()
 		{
@@ -411,13 +427,133 @@ private:
 		}
 		void DoTask(ENamedThreads::Type CurrentThread, FGraphEventRef& MyCompletionGraphEvent)
 		{
-			Owner->ProcessObjectArray(ObjectsToSerialize, MyCompletionGraphEvent);
+			Owner->RunReachabilityWorker(WorkerIndex);
 		}
 	};
 
+	/** Per worker queues of pending chunks. A worker pops from its own queue first and steals from the others when it runs dry. */
+	TIndirectArray<TLockFreePointerList<FGCWorkChunk> > WorkerQueues;
+	/** Chunks that have been processed and can be reused. */
+	TLockFreePointerList<FGCWorkChunk> FreeChunks;
+	/** Number of chunks that have been queued but not fully processed yet. Parallel marking is done once this reaches zero. */
+	volatile int32 NumOutstandingChunks;
+
+	FGCWorkChunk* AllocateChunk()
+	{
+		FGCWorkChunk* Chunk = FreeChunks.Pop();
+		if (!Chunk)
+		{
+			Chunk = new FGCWorkChunk;
+		}
+		Chunk->Num = 0;
+		return Chunk;
+	}
+
+	/** Splits Objects into chunks and queues them on the given worker's queue where any idle worker can steal them. */
+	void QueueWork(int32 WorkerIndex, UObject* const* Objects, int32 NumObjects)
+	{
+		while (NumObjects > 0)
+		{
+			FGCWorkChunk* Chunk = AllocateChunk();
+			Chunk->Num = FMath::Min<int32>(NumObjects, GCWorkChunkSize);
+			FMemory::Memcpy(Chunk->Objects, Objects, Chunk->Num * sizeof(UObject*));
+			Objects += Chunk->Num;
+			NumObjects -= Chunk->Num;
+
+			// Must be counted before it becomes visible, otherwise another worker could see zero outstanding chunks and quit early.
+			FPlatformAtomics::InterlockedIncrement(&NumOutstandingChunks);
+			WorkerQueues[WorkerIndex].Push(Chunk);
+		}
+	}
+
+	/** Pops work from the worker's own queue, or steals it from another worker. */
+	FGCWorkChunk* DequeueWork(int32 WorkerIndex)
+	{
+		const int32 NumWorkers = WorkerQueues.Num();
+		for (int32 Offset = 0; Offset < NumWorkers; ++Offset)
+		{
+			if (FGCWorkChunk* Chunk = WorkerQueues[(WorkerIndex + Offset) % NumWorkers].Pop())
+			{
+				return Chunk;
+			}
+		}
+		return nullptr;
+	}
+
+	/** Processes queued work until every queue is empty and no other worker can produce more. */
+	void RunReachabilityWorker(int32 WorkerIndex)
+	{
+		TArray<UObject*> ObjectsToSerialize;
+		ObjectsToSerialize.Empty(GCWorkChunkSize * 2);
+
+		while (true)
+		{
+			FGCWorkChunk* Chunk = DequeueWork(WorkerIndex);
+			if (Chunk)
+			{
+				ObjectsToSerialize.Reset();
+				ObjectsToSerialize.Append(Chunk->Objects, Chunk->Num);
+				FreeChunks.Push(Chunk);
+
+				ProcessObjectArray(ObjectsToSerialize, WorkerIndex);
+				FPlatformAtomics::InterlockedDecrement(&NumOutstandingChunks);
+			}
+			else if (NumOutstandingChunks == 0)
+			{
+				break;
+			}
+			else
+			{
+				// Other workers are still processing and may queue more work.
+				FPlatformProcess::Sleep(0.0f);
+			}
+		}
+	}
+
+	/** Runs the mark phase on the calling thread and all task graph workers. */
+	void PerformParallelReachabilityAnalysis(TArray<UObject*>& ObjectsToSerialize)
+	{
+		check(!GIsRunningParallelReachability);
+		GIsRunningParallelReachability = true;
+
+		// The calling thread takes part as worker 0 instead of idling until the tasks finish.
+		const int32 NumWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+		NumOutstandingChunks = 0;
+		WorkerQueues.Empty(NumWorkers);
+		for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+		{
+			WorkerQueues.Add(new TLockFreePointerList<FGCWorkChunk>());
+		}
+
+		// Spread the initial set round robin so every worker starts with local work.
+		for (int32 StartIndex = 0, ChunkIndex = 0; StartIndex < ObjectsToSerialize.Num(); StartIndex += GCWorkChunkSize, ++ChunkIndex)
+		{
+			QueueWork(ChunkIndex % NumWorkers, ObjectsToSerialize.GetData() + StartIndex, FMath::Min<int32>(GCWorkChunkSize, ObjectsToSerialize.Num() - StartIndex));
+		}
+
+		FGraphEventArray WorkerTasks;
+		WorkerTasks.Empty(NumWorkers - 1);
+		for (int32 WorkerIndex = 1; WorkerIndex < NumWorkers; ++WorkerIndex)
+		{
+			WorkerTasks.Add(TGraphTask<FGCWorkerTask>::CreateTask().ConstructAndDispatchWhenReady(this, WorkerIndex));
+		}
+		RunReachabilityWorker(0);
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(WorkerTasks, ENamedThreads::GameThread_Local);
+		check(NumOutstandingChunks == 0);
+
+		GIsRunningParallelReachability = false;
+
+		WorkerQueues.Empty();
+		while (FGCWorkChunk* Chunk = FreeChunks.Pop())
+		{
+			delete Chunk;
+		}
+	}
+
 public:
 	/** Default constructor, initializing all members. */
 	FArchiveRealtimeGC()
+		: NumOutstandingChunks(0)
 	{}
 
 	/**
@@ -427,11 +563,43 @@ public:
 	 */
 	void PerformReachabilityAnalysis( EObjectFlags KeepFlags, bool bForceSingleThreaded = false )
 	{
-		UObject* CurrentObject = NULL;
-
 		/** Growing array of objects that require serialization */
 		TArray<UObject*>	ObjectsToSerialize;
 
+		MarkObjectsAsUnreachable( ObjectsToSerialize, KeepFlags );
+		MarkReachableFrom( ObjectsToSerialize, bForceSingleThreaded );
+	}
+
+	/**
+	 * Marks everything reachable from the passed in objects, on all task graph workers unless told otherwise.
+	 *
+	 * @param ObjectsToSerialize	Objects that have already been marked reachable and still need their references processed
+	 */
+	void MarkReachableFrom( TArray<UObject*>& ObjectsToSerialize, bool bForceSingleThreaded )
+	{
+		if( ObjectsToSerialize.Num() )
+		{
+			check(!GIsRunningParallelReachability);
+
+			if ( bForceSingleThreaded )
+			{
+				ProcessObjectArray( ObjectsToSerialize, INDEX_NONE );
+			}
+			else
+			{
+				PerformParallelReachabilityAnalysis( ObjectsToSerialize );
+			}
+		}
+	}
+
+	/**
+	 * Flags every object that is not part of the root set or kept by KeepFlags as unreachable.
+	 *
+	 * @param ObjectsToSerialize	Receives the objects reachability analysis has to start from
+	 * @param KeepFlags				Objects with these flags will be kept regardless of being referenced or not
+	 */
+	static void MarkObjectsAsUnreachable( TArray<UObject*>& ObjectsToSerialize, EObjectFlags KeepFlags )
+	{
 		// Reset object count.
 		GObjectCountDuringLastMarkPhase = 0;
 
@@ -487,50 +655,21 @@ public:
 				}
 			}
 		}
-
-		if( ObjectsToSerialize.Num() )
-		{
-			check(!GIsRunningParallelReachability);
-
-			if ( bForceSingleThreaded )
-			{
-				FGraphEventRef InvalidRef;
-				ProcessObjectArray( ObjectsToSerialize, InvalidRef );
-			}
-			else
-			{				
-				GIsRunningParallelReachability = true;
-
-				int32 NumChunks = FMath::Min<int32>(FTaskGraphInterface::Get().GetNumWorkerThreads(), ObjectsToSerialize.Num());
-				int32 NumPerChunk = ObjectsToSerialize.Num() / NumChunks;
-				check(NumPerChunk > 0);
-				FGraphEventArray ChunkTasks;
-				ChunkTasks.Empty(NumChunks);
-				int32 StartIndex = 0;
-				for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
-				{
-					if (Chunk + 1 == NumChunks)
-					{
-						NumPerChunk = ObjectsToSerialize.Num() - StartIndex; // last chunk takes all remaining items
-					}
-					ChunkTasks.Add(TGraphTask<FGCTask>::CreateTask().ConstructAndDispatchWhenReady(this, &ObjectsToSerialize, StartIndex, NumPerChunk));
-					StartIndex += NumPerChunk;
-				}
-				FTaskGraphInterface::Get().WaitUntilTasksComplete(ChunkTasks, ENamedThreads::GameThread_Local);
-				GIsRunningParallelReachability = false;
-			}
-		}
 	}
 
-	void DispatchObjectTasks(TArray<UObject*>& ObjectsToSerialize)
-	{
-	}
-
-	void ProcessObjectArray(TArray<UObject*>& InObjectsToSerializeArray, FGraphEventRef& MyCompletionGraphEvent)
+	/**
+	 * Marks everything reachable from the passed in objects.
+	 *
+	 * @param InObjectsToSerializeArray	Objects that have already been marked reachable and still need their references processed
+	 * @param WorkerIndex				Index of the calling parallel reachability worker, INDEX_NONE when running single threaded
+	 * @param EndTime					If non-zero, stop once FPlatformTime::Seconds() passes this and leave the unprocessed objects in InObjectsToSerializeArray
+	 * @return true if all reachable objects have been processed, false if the time limit was hit first
+	 */
+	bool ProcessObjectArray(TArray<UObject*>& InObjectsToSerializeArray, int32 WorkerIndex, double EndTime = 0.0)
 	{		
 		UObject* CurrentObject = NULL;
+		int32 NumProcessedSinceTimeCheck = 0;
 
-		const int32 MinDesiredObjectsPerSubTask = 128; // sometimes there will be less, a lot less
 		const int32 NewObjectsArrayLength = InObjectsToSerializeArray.Num() * 2;
 		int32 TotalObjectsSerialized = InObjectsToSerializeArray.Num();
 
@@ -557,6 +696,18 @@ public:
 			FGCCollector ReferenceCollector( NewObjectsToSerialize );
 			while( CurrentIndex < ObjectsToSerialize.Num() )
 			{
+				// Reading the clock is not free, so only check the time limit every few objects.
+				if( EndTime > 0.0 && ++NumProcessedSinceTimeCheck >= 64 )
+				{
+					NumProcessedSinceTimeCheck = 0;
+					if( FPlatformTime::Seconds() >= EndTime )
+					{
+						// Keep all objects that still need processing for the next slice.
+						ObjectsToSerialize.RemoveAt( 0, CurrentIndex, false );
+						ObjectsToSerialize.Append( NewObjectsToSerialize );
+						return false;
+					}
+				}
 #if PERF_DETAILED_PER_CLASS_GC_STATS
 				uint32 StartCycles = FPlatformTime::Cycles();
 #endif
@@ -748,18 +899,14 @@ public:
 #else
 			}
 #endif
-			if( GIsRunningParallelReachability && NewObjectsToSerialize.Num() >= MinDesiredObjectsPerSubTask )
-			{			
-				int32 ObjectsPerSubTask = FMath::Max<int32>(MinDesiredObjectsPerSubTask,NewObjectsToSerialize.Num() / FTaskGraphInterface::Get().GetNumWorkerThreads());
-				int32 StartIndex = 0;
-				while (StartIndex < NewObjectsToSerialize.Num())
-				{
-					int32 NumThisTask = FMath::Min<int32>(ObjectsPerSubTask, NewObjectsToSerialize.Num() - StartIndex);
-					MyCompletionGraphEvent->DontCompleteUntil(TGraphTask<FGCTask>::CreateTask().ConstructAndDispatchWhenReady(this, &NewObjectsToSerialize, StartIndex, NumThisTask));
-					StartIndex += NumThisTask;
-				}
+			if( GIsRunningParallelReachability && NewObjectsToSerialize.Num() > GCWorkChunkSize )
+			{
+				// Keep one chunk for this worker and queue the rest where idle workers can steal it.
+				const int32 NumToShare = NewObjectsToSerialize.Num() - GCWorkChunkSize;
+				QueueWork( WorkerIndex, NewObjectsToSerialize.GetData() + GCWorkChunkSize, NumToShare );
+				NewObjectsToSerialize.RemoveAt( GCWorkChunkSize, NumToShare, false );
 			}
-			else if( NewObjectsToSerialize.Num() )
+			if( NewObjectsToSerialize.Num() )
 			{
 				// Don't spawn a new task, continue in the current one
 				// To avoid allocating and moving memory around swap ObjectsToSerialize and NewObjectsToSerialize arrays
@@ -772,6 +919,9 @@ public:
 			}
 		}
 		while( CurrentIndex < ObjectsToSerialize.Num() );
+
+		ObjectsToSerialize.Reset();
+		return true;
 	}
 };
 
@@ -788,6 +938,7 @@ void IncrementalPurgeGarbage( bool bUseTimeLimit, float TimeLimit )
 {
 	if (GExitPurge)
 	{
+		CancelIncrementalReachabilityAnalysis();
 		GObjPurgeIsRequired = true;
 		GUObjectArray.DisableDisregardForGC();
 		GObjCurrentPurgeObjectIndexNeedsReset = true;
@@ -1045,6 +1196,54 @@ COREUOBJECT_API EditorPostReachabilityAnalysisCallbackType EditorPostReachabilit
 static const auto CVarAllowParallelGC = 
 	IConsoleManager::Get().RegisterConsoleVariable( TEXT("AllowParallelGC"), 1, TEXT("Used to control parallel GC.") )->AsVariableInt();
 
+/**
+ * Whether reachability analysis has to run on the calling thread only: if processor count is 1 or parallel GC is disabled
+ * or detailed per class gc stats are enabled (not thread safe).
+ * Temporarily forcing single-threaded GC in the editor until Modify() can be safely removed from HandleObjectReference.
+ */
+static bool ShouldForceSingleThreadedGC()
+{
+	return !FApp::ShouldUseThreadingForPerformance() || !FPlatformProcess::SupportsMultithreading() ||
+#if PLATFORM_SUPPORTS_MULTITHREADED_GC
+		( FPlatformMisc::NumberOfCores() < 2 || CVarAllowParallelGC->GetValueOnGameThread() == 0 || PERF_DETAILED_PER_CLASS_GC_STATS );
+#else	//PLATFORM_SUPPORTS_MULTITHREADED_GC
+		true;
+#endif	//PLATFORM_SUPPORTS_MULTITHREADED_GC
+}
+
+/**
+ * Routes ConditionalBeginDestroy to every object left unreachable by the mark phase and flags that a purge is required.
+ */
+static void BeginDestroyUnreachableObjects()
+{
+#if WITH_EDITOR
+	if ( GIsEditor && EditorPostReachabilityAnalysisCallback )
+	{
+		EditorPostReachabilityAnalysisCallback();
+	}
+#endif // WITH_EDITOR
+
+	// Unhash all unreachable objects.
+	const double StartTime = FPlatformTime::Seconds();
+	for ( FRawObjectIterator It(true); It; ++It )
+	{
+		//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
+
+		UObject* Object = *It;
+		if( Object->HasAnyFlags( RF_Unreachable ) )
+		{
+			// Begin the object's asynchronous destruction.
+			Object->ConditionalBeginDestroy();
+		}
+	}
+	UE_LOG(LogGarbage, Log, TEXT("%f ms for unhashing unreachable objects"), (FPlatformTime::Seconds() - StartTime) * 1000 );
+
+	// Set flag to indicate that we are relying on a purge to be performed.
+	GObjPurgeIsRequired = true;
+	// Reset purged count.
+	GPurgedObjectCountSinceLastMarkPhase = 0;
+}
+
 /** 
  * Deletes all unreferenced objects, keeping objects that have any of the passed in KeepFlags set
  *
@@ -1078,6 +1277,12 @@ void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge )
 	// We can't collect garbage while there's a load in progress. E.g. one potential issue is Import.XObject
 	check( !IsLoading() );
 
+	// A stop-the-world collection supersedes an incremental pass that is still marking.
+	if( GIsIncrementalReachabilityPending )
+	{
+		CancelIncrementalReachabilityAnalysis();
+	}
+
 	// Route callbacks so we can ensure that we are e.g. not in the middle of loading something by flushing
 	// the async loading, etc...
 	FCoreUObjectDelegates::PreGarbageCollect.Broadcast();
@@ -1140,15 +1345,7 @@ void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge )
 	}
 #endif
 
-	// Fall back to single threaded GC if processor count is 1 or parallel GC is disabled
-	// or detailed per class gc stats are enabled (not thread safe)
-	// Temporarily forcing single-threaded GC in the editor until Modify() can be safely removed from HandleObjectReference.
-	const bool bForceSingleThreadedGC = !FApp::ShouldUseThreadingForPerformance() || !FPlatformProcess::SupportsMultithreading() ||
-#if PLATFORM_SUPPORTS_MULTITHREADED_GC
-		( FPlatformMisc::NumberOfCores() < 2 || CVarAllowParallelGC->GetValueOnGameThread() == 0 || PERF_DETAILED_PER_CLASS_GC_STATS );
-#else	//PLATFORM_SUPPORTS_MULTITHREADED_GC
-		true;
-#endif	//PLATFORM_SUPPORTS_MULTITHREADED_GC
+	const bool bForceSingleThreadedGC = ShouldForceSingleThreadedGC();
 
 	// Perform reachability analysis.
 	{
@@ -1158,44 +1355,186 @@ void CollectGarbage( EObjectFlags KeepFlags, bool bPerformFullPurge )
 		UE_LOG(LogGarbage, Log, TEXT("%f ms for GC"), (FPlatformTime::Seconds() - StartTime) * 1000 );
 	}
 
-#if WITH_EDITOR
-	if ( GIsEditor && EditorPostReachabilityAnalysisCallback )
+	BeginDestroyUnreachableObjects();
+
+	// Perform a full purge by not using a time limit for the incremental purge. The Editor always does a full purge.
+	if( bPerformFullPurge || GIsEditor )
 	{
-		EditorPostReachabilityAnalysisCallback();
+		IncrementalPurgeGarbage( false );	
 	}
-#endif // WITH_EDITOR
 
-	// Unhash all unreachable objects.
+	// We're done collecting garbage. Note that IncrementalPurgeGarbage above might already clear it internally.
+	GIsGarbageCollecting = false;
+
+	// Route callbacks to verify GC assumptions
+	FCoreUObjectDelegates::PostGarbageCollect.Broadcast();
+}
+
+/**
+ * Puts objects created while an incremental reachability pass is running on the barrier list. They have never been
+ * flagged unreachable, but their references were not visible when the pass started and must still be processed.
+ */
+class FIncrementalReachabilityCreateListener : public FUObjectArray::FUObjectCreateListener
+{
+public:
+	virtual void NotifyUObjectCreated(const class UObjectBase* Object, int32 Index) override
+	{
+		FScopeLock BarrierLock(&GIncrementalBarrierCritical);
+		GIncrementalBarrierObjects.Add((UObject*)Object);
+	}
+};
+static FIncrementalReachabilityCreateListener GIncrementalReachabilityCreateListener;
+
+void MarkObjectReachableDuringIncrementalGC( UObject* Object )
+{
+	if( GIsIncrementalReachabilityPending && !GUObjectAllocator.ResidesInPermanentPool(Object) && Object->ThisThreadAtomicallyClearedRFUnreachable() )
+	{
+		FScopeLock BarrierLock(&GIncrementalBarrierCritical);
+		GIncrementalBarrierObjects.Add(Object);
+	}
+}
+
+bool IsIncrementalReachabilityAnalysisPending()
+{
+	return GIsIncrementalReachabilityPending;
+}
+
+/**
+ * Moves all objects queued by the write barrier and the create listener to the incremental pass' work list.
+ *
+ * @return true if any objects were queued
+ */
+static bool DrainIncrementalBarrierObjects()
+{
+	FScopeLock BarrierLock(&GIncrementalBarrierCritical);
+	const bool bHadObjects = GIncrementalBarrierObjects.Num() > 0;
+	GIncrementalObjectsToSerialize.Append(GIncrementalBarrierObjects);
+	GIncrementalBarrierObjects.Reset();
+	return bHadObjects;
+}
+
+/** Stops listening for new objects and drops all state of the incremental pass. */
+static void ResetIncrementalReachabilityAnalysis()
+{
+	GUObjectArray.RemoveUObjectCreateListener(&GIncrementalReachabilityCreateListener);
+	GIsIncrementalReachabilityPending = false;
+	GIncrementalObjectsToSerialize.Empty();
+	FScopeLock BarrierLock(&GIncrementalBarrierCritical);
+	GIncrementalBarrierObjects.Empty();
+}
+
+void CancelIncrementalReachabilityAnalysis()
+{
+	if( !GIsIncrementalReachabilityPending )
+	{
+		return;
+	}
+
+	ResetIncrementalReachabilityAnalysis();
+
+	// Nothing has been destroyed yet, so simply forget which objects were found unreachable so far.
+	for( FRawObjectIterator It(true); It; ++It )
+	{
+		(*It)->ClearFlags( RF_Unreachable );
+	}
+}
+
+bool IncrementalCollectGarbage( EObjectFlags KeepFlags, bool bUseTimeLimit, float TimeLimit )
+{
+	check( !IsLoading() );
+
 	const double StartTime = FPlatformTime::Seconds();
-	for ( FRawObjectIterator It(true); It; ++It )
+	FArchiveRealtimeGC TagUsedRealtimeGC;
+
+	if( !GIsIncrementalReachabilityPending )
 	{
-		//@todo UE4 - A prefetch was removed here. Re-add it. It wasn't right anyway, since it was ten items ahead and the consoles on have 8 prefetch slots
+		// Objects can't be flagged unreachable again until the previous purge has finished. Keep purging within
+		// this call's budget instead of forcing a full purge, and start the pass once nothing is left to purge.
+		if( GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired )
+		{
+			IncrementalPurgeGarbage( bUseTimeLimit, TimeLimit );
+			if( GObjIncrementalPurgeIsInProgress || GObjPurgeIsRequired )
+			{
+				return false;
+			}
+		}
 
+		FCoreUObjectDelegates::PreGarbageCollect.Broadcast();
+
+		TGuardValue<bool> GuardIsGarbageCollecting(GIsGarbageCollecting, true);
+
+		UE_LOG(LogGarbage, Log, TEXT("Starting incremental reachability analysis") );
+
+		FArchiveRealtimeGC::MarkObjectsAsUnreachable( GIncrementalObjectsToSerialize, KeepFlags );
+		GIncrementalReachabilityKeepFlags = KeepFlags;
+		GIsIncrementalReachabilityPending = true;
+		GUObjectArray.AddUObjectCreateListener(&GIncrementalReachabilityCreateListener);
+	}
+
+	TGuardValue<bool> GuardIsGarbageCollecting(GIsGarbageCollecting, true);
+
+	DrainIncrementalBarrierObjects();
+	if( !TagUsedRealtimeGC.ProcessObjectArray( GIncrementalObjectsToSerialize, INDEX_NONE, bUseTimeLimit ? StartTime + TimeLimit : 0.0 ) )
+	{
+		return false;
+	}
+
+	// Final, non incremental step. Native UPROPERTY assignments, container adds, struct copies and references
+	// held by FGCObjects are not covered by the write barrier, so an object scanned early in the pass may have
+	// picked up a reference to an object still flagged unreachable. Trace every object marked reachable so far
+	// once more, together with objects that were added to the root set or gained a keep flag during the pass.
+	// This runs on all workers like the mark of CollectGarbage, so the step costs about as much as that parallel mark and
+	// never more than a stop-the-world collection would have.
+	const double FinalStepStartTime = FPlatformTime::Seconds();
+	GIncrementalObjectsToSerialize.Reset();
+	for( FRawObjectIterator It(true); It; ++It )
+	{
 		UObject* Object = *It;
-		if( Object->HasAnyFlags( RF_Unreachable ) )
+		if( Object->HasAnyFlags( RF_RootSet ) )
 		{
-			// Begin the object's asynchronous destruction.
-			Object->ConditionalBeginDestroy();
+			Object->ClearFlags( RF_Unreachable );
+			GIncrementalObjectsToSerialize.Add( Object );
+		}
+		else if( !Object->HasAnyFlags( RF_Unreachable ) )
+		{
+			GIncrementalObjectsToSerialize.Add( Object );
+		}
+		else if( Object->HasAnyFlags( GIncrementalReachabilityKeepFlags ) && !Object->HasAnyFlags( RF_PendingKill ) )
+		{
+			Object->ClearFlags( RF_Unreachable );
+			GIncrementalObjectsToSerialize.Add( Object );
 		}
-	}
-	UE_LOG(LogGarbage, Log, TEXT("%f ms for unhashing unreachable objects"), (FPlatformTime::Seconds() - StartTime) * 1000 );
 
-	// Set flag to indicate that we are relying on a purge to be performed.
-	GObjPurgeIsRequired = true;
-	// Reset purged count.
-	GPurgedObjectCountSinceLastMarkPhase = 0;
+		// Classes loaded during the pass need their token stream before the workers trace their instances.
+		if( UClass* Class = dynamic_cast<UClass*>(Object) )
+		{
+			if( !Class->HasAnyClassFlags(CLASS_TokenStreamAssembled) )
+			{
+				Class->AssembleReferenceTokenStream();
+			}
+		}
+	}
+	if( FGCObject::GGCObjectReferencer && GUObjectArray.IsDisregardForGC(FGCObject::GGCObjectReferencer) )
+	{
+		GIncrementalObjectsToSerialize.Add( FGCObject::GGCObjectReferencer );
+	}
+	DrainIncrementalBarrierObjects();
 
-	// Perform a full purge by not using a time limit for the incremental purge. The Editor always does a full purge.
-	if( bPerformFullPurge || GIsEditor )
+	const bool bForceSingleThreadedGC = ShouldForceSingleThreadedGC();
+	do
 	{
-		IncrementalPurgeGarbage( false );	
+		TagUsedRealtimeGC.MarkReachableFrom( GIncrementalObjectsToSerialize, bForceSingleThreadedGC );
+		GIncrementalObjectsToSerialize.Reset();
 	}
+	while( DrainIncrementalBarrierObjects() );
 
-	// We're done collecting garbage. Note that IncrementalPurgeGarbage above might already clear it internally.
-	GIsGarbageCollecting = false;
+	ResetIncrementalReachabilityAnalysis();
+	UE_LOG(LogGarbage, Log, TEXT("%f ms for final incremental reachability step"), (FPlatformTime::Seconds() - FinalStepStartTime) * 1000 );
+
+	BeginDestroyUnreachableObjects();
 
-	// Route callbacks to verify GC assumptions
 	FCoreUObjectDelegates::PostGarbageCollect.Broadcast();
+	return true;
 }
 
 /**
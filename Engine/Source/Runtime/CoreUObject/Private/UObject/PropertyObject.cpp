@@ -63,6 +63,7 @@ void UObjectProperty::SetObjectPropertyValue(void* PropertyValueAddress, UObject
 	}
 #endif // USE_DEFERRED_DEPENDENCY_CHECK_VERIFICATION_TESTS
 
+	GCWriteBarrier(Value);
 	SetPropertyValue(PropertyValueAddress, Value);
 }
 
@@ -24,10 +24,14 @@ enum EBulkDataFlags
 	BULKDATA_Unused								= 1<<5,
 	/** Forces the payload to be saved inline, regardless of its size				*/
 	BULKDATA_ForceInlinePayload					= 1<<6,
-	/** Flag to check if either compression mode is specified						*/
-	BULKDATA_SerializeCompressed				= (BULKDATA_SerializeCompressedZLIB),
 	/** Forces the payload to be always streamed, regardless of its size */
 	BULKDATA_ForceStreamPayload = 1 << 7,
+	/** If set, payload should be [un]compressed using LZ4 during serialization.	*/
+	BULKDATA_SerializeCompressedLZ4				= 1<<8,
+	/** If set, payload should be [un]compressed using Zstd during serialization.	*/
+	BULKDATA_SerializeCompressedZstd			= 1<<9,
+	/** Flag to check if either compression mode is specified						*/
+	BULKDATA_SerializeCompressed				= (BULKDATA_SerializeCompressedZLIB | BULKDATA_SerializeCompressedLZ4 | BULKDATA_SerializeCompressedZstd),
 
 };
 
@@ -283,7 +287,7 @@ struct COREUOBJECT_API FUntypedBulkData
 	/**
 	 * Sets whether we should store the data compressed on disk.
 	 *
-	 * @param CompressionFlags	Flags to use for compressing the data. Use COMPRESS_NONE for no compression, or something like COMPRESS_ZLIB to compress the data
+	 * @param CompressionFlags	Flags to use for compressing the data. Use COMPRESS_NONE for no compression, or COMPRESS_ZLIB, COMPRESS_LZ4 or COMPRESS_Zstd to compress the data
 	 */
 	void StoreCompressedOnDisk( ECompressionFlags CompressionFlags );
 
@@ -382,6 +386,14 @@ private:
 	 */
 	void LoadDataIntoMemory( void* Dest );
 
+	/**
+	 * Serializes the bulk data from the mapping of the pak file containing Filename, if paks are mapped with -MMapPaks.
+	 *
+	 * @param Dest Memory to serialize data into
+	 * @return true if the data was serialized, false if the caller needs to fall back to a file reader
+	 */
+	bool SerializeBulkDataFromMappedFile( void* Dest );
+
 	/** Starts serializing bulk data asynchronously */
 	void StartSerializingBulkData(FArchive& Ar, UObject* Owner, int32 Idx, bool bPayloadInline);
 
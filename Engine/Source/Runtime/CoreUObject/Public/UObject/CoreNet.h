@@ -301,6 +301,7 @@ struct FNetDeltaSerializeInfo
 
 		NewState	= NULL;
 		OldState	= NULL;
+		AckedState	= NULL;
 		Map			= NULL;
 		Data		= NULL;
 
@@ -323,6 +324,7 @@ struct FNetDeltaSerializeInfo
 
 	TSharedPtr<INetDeltaBaseState>*	NewState;		// SharedPtr to new base state created by NetDeltaSerialize.
 	INetDeltaBaseState*				OldState;				// Pointer to the previous base state.
+	INetDeltaBaseState*				AckedState;				// Pointer to the newest base state the receiver is known to have, when writing. Same as OldState unless updates are in flight.
 	UPackageMap*					Map;
 	void*							Data;
 
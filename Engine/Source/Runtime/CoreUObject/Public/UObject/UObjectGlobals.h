@@ -355,6 +355,53 @@ COREUOBJECT_API bool IsIncrementalPurgePending();
  */
 COREUOBJECT_API void IncrementalPurgeGarbage( bool bUseTimeLimit, float TimeLimit = 0.002 );
 
+/**
+ * Runs one time-sliced step of incremental reachability analysis, starting a new pass if none is in progress.
+ * Once all reachable objects have been marked, unreachable objects are unhashed and left for
+ * IncrementalPurgeGarbage, just like CollectGarbage( KeepFlags, false ) does.
+ *
+ * If a purge of the previous pass is still pending, this only advances the purge and the new pass starts once it is done.
+ * The final step traces every object marked reachable once more, so references stored without GCWriteBarrier during
+ * the pass are still found. That step runs on all task graph workers, like the mark phase of CollectGarbage, and costs
+ * about as much as that mark.
+ *
+ * @param	KeepFlags		objects with those flags will be kept regardless of being referenced or not. Only used when a new pass starts.
+ * @param	bUseTimeLimit	whether the time limit parameter should be used
+ * @param	TimeLimit		soft time limit for this function call
+ * @return	true if the pass finished during this call
+ */
+COREUOBJECT_API bool IncrementalCollectGarbage( EObjectFlags KeepFlags, bool bUseTimeLimit, float TimeLimit = 0.002 );
+
+/**
+ * Returns whether an incremental reachability pass has been started and not finished yet.
+ */
+COREUOBJECT_API bool IsIncrementalReachabilityAnalysisPending();
+
+/**
+ * Abandons the incremental reachability pass in progress, if any, without destroying anything.
+ */
+COREUOBJECT_API void CancelIncrementalReachabilityAnalysis();
+
+/** Whether an incremental reachability pass is in progress. Use GCWriteBarrier instead of testing this directly. */
+extern COREUOBJECT_API bool GIsIncrementalReachabilityPending;
+
+/** Marks Object as reachable for the incremental reachability pass in progress. Use GCWriteBarrier instead of calling this directly. */
+COREUOBJECT_API void MarkObjectReachableDuringIncrementalGC( UObject* Object );
+
+/**
+ * Write barrier for incremental reachability analysis. Must be called with the new value whenever a reference
+ * to a UObject is stored somewhere the garbage collector can see it. Free when no incremental pass is running.
+ *
+ * @param	NewReference	object that is now being referenced, can be NULL
+ */
+FORCEINLINE void GCWriteBarrier( UObject* NewReference )
+{
+	if( GIsIncrementalReachabilityPending && NewReference )
+	{
+		MarkObjectReachableDuringIncrementalGC( NewReference );
+	}
+}
+
 /**
  * Create a unique name by combining a base name and an arbitrary number string.
  * The object name returned is guaranteed not to exist.
@@ -0,0 +1,25 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+#include "Commandlets/Commandlet.h"
+#include "ReplicationBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the cost of server side replication without real clients. Spawns actors that move along scripted paths in an
+ * empty world, replicates them to simulated clients through a UNullNetDriver with a fixed time step, and reports the server
+ * time per replicated actor, the bytes sent per connection and the bunches sent per second. The same parameters give the
+ * same traffic on every run, so the results can be compared between builds.
+ *
+ * Usage: -run=ReplicationBenchmark [-Clients=16] [-Actors=1000] [-Frames=900] [-TickRate=30] [-Warmup=30] [-WorldSize=40000]
+ *                                  [-NetSpeed=0] [-Seed=0] [-ActorClass=/Script/Engine.Actor] [-NetProfile]
+ */
+UCLASS()
+class UReplicationBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+
+	// Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	// End UCommandlet Interface
+};
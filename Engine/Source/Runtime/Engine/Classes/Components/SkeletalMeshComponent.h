@@ -638,6 +638,9 @@ public:
 	/** Temporary array of bone indices required this frame. Filled in by UpdateSkelPose. */
 	TArray<FBoneIndexType> RequiredBones;
 
+	/** RequiredBones sorted by depth for FillSpaceBases, rebuilt by RecalcRequiredBones. */
+	FBoneDepthLevels RequiredBoneDepthLevels;
+
 	/** 
 	 *	Index of the 'Root Body', or top body in the asset hierarchy. 
 	 *	Filled in by InitInstance, so we don't need to save it.
@@ -43,6 +43,15 @@ class UDemoNetDriver
 	/** True if as have paused all of the channels */
 	bool bChannelsArePaused;
 
+	/** Demo time (in game seconds) of the last checkpoint that was recorded */
+	float LastCheckpointTime;
+
+	/** Connection a checkpoint is being recorded through, only set while SaveCheckpoint runs */
+	class UDemoNetConnection* CheckpointConnection;
+
+	/** Demo time (in seconds) playback is going to, while waiting for the replay streamer to load a checkpoint. Negative otherwise. */
+	float GotoTime;
+
 	/** This is our spectator controller that is used to view the demo world from */
 	APlayerController* SpectatorController;
 
@@ -93,5 +102,25 @@ public:
 
 	void StopDemo();
 
+	/**
+	 * Jumps playback to TimeInSeconds. The closest checkpoint before it is loaded, and the frames recorded after the checkpoint are
+	 * read up to TimeInSeconds without ticking the world in between. Only works for replays recorded with checkpoints.
+	 *
+	 * @return false if nothing is playing back, or playback is already going to another time
+	 */
+	bool GotoTimeInSeconds( float TimeInSeconds );
+
+	/**
+	 * Records the state of every actor with a channel to the replay streamer's checkpoint archive, the way a client joining
+	 * now would receive it, so that playback can start from here.
+	 */
+	void SaveCheckpoint();
+
+	/** Called by the replay streamer once the checkpoint GotoTimeInSeconds asked for is ready */
+	void LoadCheckpoint( bool bSuccess, uint32 CheckpointTimeInMS );
+
+	/** Processes packets from Ar up to the end marker, returns false if the demo was stopped because of an error */
+	bool ReadDemoPackets( FArchive& Ar );
+
 	void ReplayStreamingReady( bool bSuccess, bool bRecord );
 };
@@ -2441,6 +2441,12 @@ struct FRepMovement
 		return true;
 	}
 
+	/**
+	 * Sends the movement as a difference from the last movement the receiver is known to have, or like NetSerialize
+	 * if there is none. Nothing is sent if the quantized movement didn't change. See FRepMovementDeltaState.
+	 */
+	ENGINE_API bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
 	void FillFrom(const struct FRigidBodyState& RBState)
 	{
 		Location = RBState.Position;
@@ -2641,6 +2647,7 @@ struct TStructOpsTypeTraits<FRepMovement> : public TStructOpsTypeTraitsBase
 	enum 
 	{
 		WithNetSerializer = true,
+		WithNetDeltaSerializer = true,
 	};
 };
 
@@ -198,6 +198,7 @@ public:
 	double			LastReceiveTime;		// Last time a packet was received, for timeout checking.
 	double			LastSendTime;			// Last time a packet was sent, for keepalives.
 	double			LastTickTime;			// Last time of polling.
+	double			PacketReceiveTime;		// FPlatformTime::Seconds() the packet being received arrived at, if the driver timestamps packets, 0 otherwise.
 	int32			QueuedBytes;			// Bytes assumed to be queued up.
 	int32			TickCount;				// Count of ticks.
 	/** The last time an ack was received */
@@ -212,6 +213,10 @@ public:
 	bool			TimeSensitive;			// Whether contents are time-sensitive.
 	FOutBunch*		LastOutBunch;			// Most recent outgoing bunch.
 	FOutBunch		LastOut;
+	/** Header of the bunch being sent, kept so that SendRawBunch doesn't allocate one each time. */
+	FBitWriter		SendBunchHeader;
+	/** Sent or discarded bunches kept for AllocOutBunch to reuse, see net.OutBunchPoolSize. */
+	TArray<FOutBunch*> FreeOutBunches;
 
 	// Stat display.
 	/** Time of last stat update */
@@ -236,6 +241,7 @@ public:
 	// Packet.
 	FBitWriter		SendBuffer;				// Queued up bits waiting to send
 	double			OutLagTime[256];		// For lag measuring.
+	double			OutLagRealTime[256];	// For lag measuring against PacketReceiveTime.
 	int32			OutLagPacketId[256];	// For lag measuring.
 	int32			InPacketId;				// Full incoming packet index.
 	int32			OutPacketId;			// Most recently sent packet.
@@ -521,6 +527,21 @@ public:
 	/** Send a raw bunch. */
 	ENGINE_API int32 SendRawBunch( FOutBunch& Bunch, bool InAllowMerge );
 
+	/**
+	 * Returns a new outgoing bunch for a channel, like new FOutBunch( Channel, bClose ), reusing a pooled one when possible.
+	 * Bunches from any of the AllocOutBunch functions are given back with FreeOutBunch instead of deleted.
+	 */
+	ENGINE_API FOutBunch* AllocOutBunch( class UChannel* Channel, bool bClose );
+
+	/** Returns a new resizable bunch to write into through this connection's package map, like new FOutBunch( PackageMap, MaxBits ). */
+	ENGINE_API FOutBunch* AllocOutBunch( int64 MaxBits );
+
+	/** Returns a new copy of a bunch, like new FOutBunch( Source ). */
+	ENGINE_API FOutBunch* AllocOutBunch( const FOutBunch& Source );
+
+	/** Gives a bunch back to the pool, or deletes it if the pool is full or the connection is cleaned up. */
+	ENGINE_API void FreeOutBunch( FOutBunch* Bunch );
+
 	/** @return The driver object */
 	UNetDriver* GetDriver() {return Driver;}
 
@@ -260,6 +260,10 @@ public:
 	float						JoinInProgressStandbyWaitTime;
 	/** Used to track whether a given actor was replicated by the net driver recently */
 	int32						NetTag;
+	/** Spatial hash of the considered actors, used when net.RelevancyGrid is enabled */
+	TSharedPtr<class FNetRelevancyGrid>	RelevancyGrid;
+	/** Network actors ordered by their next update time, used when net.ActorSchedule is enabled */
+	TSharedPtr<class FNetActorSchedule>	ActorSchedule;
 	/** Dumps next net update's relevant actors when true*/
 	bool						DebugRelevantActors;
 
@@ -477,6 +481,15 @@ public:
 	ENGINE_API virtual void NotifyStreamingLevelUnload( ULevel* );
 
 	ENGINE_API virtual void NotifyActorLevelUnloaded( AActor* Actor );
+
+	/** Called when an actor is added to the world's network actors, or taken out of dormancy. */
+	ENGINE_API void NotifyNetworkActorAdded( AActor* Actor );
+
+	/** Called when an actor is removed from the world's network actors. */
+	ENGINE_API void NotifyNetworkActorRemoved( AActor* Actor );
+
+	/** Called when an actor has to be considered for replication sooner, at UpdateTime, than the schedule expects. */
+	ENGINE_API void NotifyActorNetUpdateTimeLowered( AActor* Actor, float UpdateTime );
 	
 	/** creates a child connection and adds it to the given parent connection */
 	ENGINE_API virtual class UChildConnection* CreateChild(UNetConnection* Parent);
@@ -542,4 +555,13 @@ protected:
 	ENGINE_API void UnregisterTickEvents(class UWorld* InWorld);
 	/** Returns true if this actor is considered to be in a loaded level */
 	bool IsLevelInitializedForActor(const AActor* InActor, const UNetConnection* InConnection) const;
+
+	/**
+	 * Builds the list of relevant actors to replicate to a connection this frame, sorted by priority.
+	 * Doesn't change anything that is shared with other connections, so different connections can be prioritized in parallel.
+	 */
+	void PrioritizeActorsForConnection(struct FConnectionReplicationPriorities& Priorities);
+
+	/** Returns true if the actor has gone dormant on every client connection. */
+	bool IsActorDormantOnAllConnections(const AActor* Actor) const;
 };
@@ -941,6 +941,97 @@ bool SerializePackedVector(FVector &Vector, FArchive& Ar)
 	return true;
 }
 
+// --------------------------------------------------------------
+// Quantized vectors, for NetDeltaSerialize implementations which keep the values the receiver has in their base state
+// and send the difference to them (see FRepMovement::NetDeltaSerialize).
+//
+// QuantizePackedVector rounds and clamps a vector the same way WritePackedVector does, so a value rebuilt from
+// quantized deltas is exactly the value a packed vector would have been received as.
+// WritePackedIntVector/ReadPackedIntVector use the packed format on integers, which is what keeps small deltas small.
+
+template<int32 ScaleFactor, int32 MaxBitsPerComponent>
+FIntVector QuantizePackedVector(FVector Value)
+{
+	if( Value.ContainsNaN() )
+	{
+		return FIntVector(0, 0, 0);
+	}
+
+	// Scale vector by quant factor first
+	Value *= ScaleFactor;
+
+	// Clamp to the range WritePackedVector can write, before rounding too so the conversion can't overflow
+	const int32 MinValue = -(1 << MaxBitsPerComponent);
+	const int32 MaxValue = (1 << MaxBitsPerComponent) - 1;
+
+	return FIntVector(
+		FMath::Clamp(FMath::RoundToInt(FMath::Clamp(Value.X, (float)MinValue, (float)MaxValue)), MinValue, MaxValue),
+		FMath::Clamp(FMath::RoundToInt(FMath::Clamp(Value.Y, (float)MinValue, (float)MaxValue)), MinValue, MaxValue),
+		FMath::Clamp(FMath::RoundToInt(FMath::Clamp(Value.Z, (float)MinValue, (float)MaxValue)), MinValue, MaxValue));
+}
+
+template<uint32 ScaleFactor>
+FVector DequantizePackedVector(const FIntVector& Value)
+{
+	float fact = (float)ScaleFactor;
+
+	return FVector((float)Value.X / fact, (float)Value.Y / fact, (float)Value.Z / fact);
+}
+
+/** @return true if WritePackedIntVector can write every component of Value without clamping it */
+template<int32 MaxBitsPerComponent>
+bool CanWritePackedIntVector(int64 X, int64 Y, int64 Z)
+{
+	const int64 Limit = 1ll << MaxBitsPerComponent;
+
+	return X >= -Limit && X < Limit && Y >= -Limit && Y < Limit && Z >= -Limit && Z < Limit;
+}
+
+template<int32 MaxBitsPerComponent>
+void WritePackedIntVector(const FIntVector& Value, FArchive& Ar)
+{
+	check(Ar.IsSaving());
+	checkSlow(CanWritePackedIntVector<MaxBitsPerComponent>(Value.X, Value.Y, Value.Z));
+
+	uint32 Bits	= FMath::Clamp<uint32>( FMath::CeilLogTwo( 1 + FMath::Max3( FMath::Abs(Value.X), FMath::Abs(Value.Y), FMath::Abs(Value.Z) ) ), 1, MaxBitsPerComponent ) - 1;
+
+	// Serialize how many bits each component will have
+	Ar.SerializeInt( Bits, MaxBitsPerComponent );
+
+	int32  Bias	= 1<<(Bits+1);
+	uint32 Max	= 1<<(Bits+2);
+	uint32 DX	= Value.X + Bias;
+	uint32 DY	= Value.Y + Bias;
+	uint32 DZ	= Value.Z + Bias;
+
+	Ar.SerializeInt( DX, Max );
+	Ar.SerializeInt( DY, Max );
+	Ar.SerializeInt( DZ, Max );
+}
+
+template<int32 MaxBitsPerComponent>
+void ReadPackedIntVector(FIntVector& Value, FArchive& Ar)
+{
+	uint32 Bits	= 0;
+
+	// Serialize how many bits each component will have
+	Ar.SerializeInt( Bits, MaxBitsPerComponent );
+
+	int32  Bias = 1<<(Bits+1);
+	uint32 Max	= 1<<(Bits+2);
+	uint32 DX	= 0;
+	uint32 DY	= 0;
+	uint32 DZ	= 0;
+
+	Ar.SerializeInt( DX, Max );
+	Ar.SerializeInt( DY, Max );
+	Ar.SerializeInt( DZ, Max );
+
+	Value.X = static_cast<int32>(DX) - Bias;
+	Value.Y = static_cast<int32>(DY) - Bias;
+	Value.Z = static_cast<int32>(DZ) - Bias;
+}
+
 // --------------------------------------------------------------
 
 template<int32 MaxValue, int32 NumBits>
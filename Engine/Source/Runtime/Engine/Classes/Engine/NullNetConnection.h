@@ -0,0 +1,31 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "NullNetConnection.generated.h"
+
+/**
+ * Simulated client connection of a UNullNetDriver. Packets are counted and dropped instead of being sent, and are acked
+ * as soon as they are sent. Bandwidth is limited the same way it is for a real connection.
+ */
+UCLASS(transient, config=Engine)
+class UNullNetConnection
+	: public UNetConnection
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Number of packets sent through the connection, since the totals were last reset */
+	uint64 TotalOutPackets;
+
+	/** Number of bytes sent through the connection, including the packet overhead, since the totals were last reset */
+	uint64 TotalOutBytes;
+
+public:
+
+	// UNetConnection interface.
+
+	virtual void InitConnection( class UNetDriver* InDriver, EConnectionState InState, const FURL& InURL, int32 InConnectionSpeed = 0 ) override;
+	virtual FString LowLevelGetRemoteAddress( bool bAppendPort = false ) override;
+	virtual FString LowLevelDescribe() override;
+	virtual void LowLevelSend( void* Data, int32 Count ) override;
+};
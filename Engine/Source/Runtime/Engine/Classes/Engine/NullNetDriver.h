@@ -0,0 +1,57 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "NullNetDriver.generated.h"
+
+/**
+ * Server network driver without sockets, for measuring replication without real clients.
+ *
+ * Clients are simulated by AddSimulatedClient, which sets up a connection and a player controller the way a client
+ * joining the server would get them. Everything sent to them is counted and dropped, and every packet is acked right away.
+ */
+UCLASS(transient, config=Engine)
+class UNullNetDriver
+	: public UNetDriver
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Number of bunches sent to the simulated clients, since the driver started listening */
+	uint64 TotalOutBunches;
+
+	/** Number of actors replicated by ServerReplicateActors, counted once per connection they were sent to */
+	uint64 TotalReplicatedActors;
+
+	/** Time spent in ServerReplicateActors, in cycles */
+	uint64 TotalReplicateActorsCycles;
+
+public:
+
+	// UNetDriver interface.
+
+	virtual bool InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const FURL& URL, bool bReuseAddressAndPort, FString& Error ) override;
+	virtual bool InitConnect( FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error ) override;
+	virtual bool InitListen( FNetworkNotify* InNotify, FURL& ListenURL, bool bReuseAddressAndPort, FString& Error ) override;
+	virtual FString LowLevelGetNetworkNumber() override;
+	virtual void TickFlush( float DeltaSeconds ) override;
+	virtual void ProcessRemoteFunction( class AActor* Actor, class UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, struct FFrame* Stack, class UObject* SubObject = nullptr ) override;
+	virtual bool IsAvailable() const override { return true; }
+	virtual class ISocketSubsystem* GetSocketSubsystem() override { return NULL; }
+	virtual bool IsNetResourceValid(void) override { return true; }
+
+public:
+
+	/**
+	 * Adds a simulated client connection, with a player controller of PlayerControllerClass that the connection views the world from.
+	 * Must be called after InitListen, once the driver has a world.
+	 *
+	 * @param PlayerControllerClass Class of the player controller to spawn for the client
+	 * @param ConnectionSpeed Bytes per second the connection can send, 0 uses the configured internet speed
+	 *
+	 * @return The new connection, or NULL if the player controller couldn't be spawned
+	 */
+	class UNullNetConnection* AddSimulatedClient( UClass* PlayerControllerClass, int32 ConnectionSpeed = 0 );
+
+	/** Resets the totals of what was sent to the simulated clients */
+	void ResetTotals();
+};
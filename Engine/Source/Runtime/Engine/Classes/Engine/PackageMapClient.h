@@ -134,6 +134,9 @@ public:
 
 	void HandleUnAssignedObject( const UObject* Obj );
 
+	/** Exports the NetGUIDs of the objects with stable names that Other has exported, so this connection can resolve them like Other's can */
+	void ExportNetGUIDsFrom( const UPackageMapClient* Other );
+
 	static void	AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
 	virtual void NotifyStreamingLevelUnload(UObject* UnloadedLevel) override;
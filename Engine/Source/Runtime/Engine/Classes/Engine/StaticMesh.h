@@ -344,6 +344,13 @@ class UStaticMesh : public UObject, public IInterface_CollisionDataProvider, pub
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=StaticMesh, meta=(ToolTip="If true, use a less-conservative method of mip LOD texture factor computation.  Requires mesh to be resaved to take effect as algorithm is applied on save"))
 	uint32 bUseMaximumStreamingTexelRatio:1;
 
+	/**
+	 * LOD whose triangles are drawn into the renderer's software occlusion buffer by components that use the mesh, to cull
+	 * what is behind them, see r.SoftwareOcclusion. A copy of the LOD is kept on the CPU for it. -1 means the mesh doesn't occlude.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=StaticMesh)
+	int32 LODForOccluderMesh;
+
 	/** If true, strips unwanted complex collision data aka kDOP tree when cooking for consoles.
 		On the Playstation 3 data of this mesh will be stored in video memory. */
 	UPROPERTY()
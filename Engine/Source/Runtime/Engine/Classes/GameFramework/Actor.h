@@ -1669,6 +1669,14 @@ public:
 	  */
 	virtual bool IsNetRelevantFor(const APlayerController* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const;
 
+	/**
+	  * Whether IsNetRelevantFor currently is a plain distance check against NetCullDistanceSquared, apart from being
+	  * relevant when this actor is the view target. Such actors are only tested against the connections close to them
+	  * when the net driver's relevancy grid is enabled (net.RelevancyGrid). Classes that override IsNetRelevantFor
+	  * so that they can be relevant further away must override this to return false.
+	  */
+	virtual bool IsNetRelevancySpatial() const;
+
 	/**
 	 * Check if this actor is the owner when doing relevancy checks for actors marked bOnlyRelevantToOwner
 	 *
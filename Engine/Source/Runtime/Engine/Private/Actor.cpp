@@ -1413,7 +1413,22 @@ bool AActor::IsRelevancyOwnerFor(AActor* ReplicatedActor, AActor* ActorOwner, AA
 
 void AActor::SetNetUpdateTime(float NewUpdateTime)
 {
+	const bool bLowered = NewUpdateTime < NetUpdateTime;
 	NetUpdateTime = NewUpdateTime;
+
+	// The net driver only looks at actors when they are due, so tell it when the update comes sooner
+	if (bLowered && GetRemoteRole() != ROLE_None)
+	{
+		const ENetMode NetMode = GetNetMode();
+		if (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer)
+		{
+			UNetDriver* NetDriver = GEngine->FindNamedNetDriver(GetWorld(), NetDriverName);
+			if (NetDriver)
+			{
+				NetDriver->NotifyActorNetUpdateTimeLowered(this, NetUpdateTime);
+			}
+		}
+	}
 }
 
 void AActor::ForceNetUpdate()
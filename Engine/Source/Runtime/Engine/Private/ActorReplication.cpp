@@ -182,6 +182,13 @@ bool AActor::IsNetRelevantFor(const APlayerController* RealViewer, const AActor*
 	return true;
 }
 
+bool AActor::IsNetRelevancySpatial() const
+{
+	// Rule out everything that makes IsNetRelevantFor return true before it gets to the distance check.
+	return !bAlwaysRelevant && !bNetUseOwnerRelevancy && !bOnlyRelevantToOwner && Owner == NULL && Instigator == NULL
+		&& RootComponent && RootComponent->AttachParent == NULL && GetDefault<AGameNetworkManager>()->bUseDistanceBasedRelevancy;
+}
+
 void AActor::GatherCurrentMovement()
 {
 	UPrimitiveComponent* RootPrimComp = Cast<UPrimitiveComponent>(GetRootComponent());
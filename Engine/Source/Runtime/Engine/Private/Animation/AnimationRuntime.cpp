@@ -744,6 +744,14 @@ void FAnimationRuntime::ConvertPoseToMeshSpace(const TArray<FTransform> & LocalT
 		MeshSpaceTransforms[0] = LocalTransforms[0];
 	}
 
+	// Convert a whole level of the hierarchy at a time, unless the levels were lost by serializing the container.
+	const FBoneDepthLevels& BoneDepthLevels = RequiredBones.GetBoneDepthLevels();
+	if (BoneDepthLevels.IsBuiltFor(RequiredBoneIndexArray, RequiredBones.GetReferenceSkeleton()))
+	{
+		BoneDepthLevels.ConvertToComponentSpace(LocalTransformsData, SpaceBasesData);
+		return;
+	}
+
 	const int32 NumRequiredBones = RequiredBoneIndexArray.Num();
 	for(int32 i=1; i<NumRequiredBones; i++)
 	{
@@ -135,6 +135,80 @@ void UAnimationAsset::ValidateSkeleton()
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+// FBoneDepthLevels
+
+void FBoneDepthLevels::Build(const TArray<FBoneIndexType>& RequiredBoneIndices, const FReferenceSkeleton& InRefSkeleton)
+{
+	Reset();
+
+	const int32 NumRequiredBones = RequiredBoneIndices.Num();
+	if (NumRequiredBones == 0 || RequiredBoneIndices[0] != 0)
+	{
+		return;
+	}
+
+	// Depth of every required bone, INDEX_NONE for bones that aren't required (yet).
+	TArray<int32, TInlineAllocator<256>> BoneDepths;
+	BoneDepths.Init(INDEX_NONE, InRefSkeleton.GetNum());
+	BoneDepths[0] = 0;
+
+	TArray<int32, TInlineAllocator<32>> LevelCounts;
+	LevelCounts.Add(1);
+	for (int32 Index = 1; Index < NumRequiredBones; Index++)
+	{
+		const int32 BoneIndex = RequiredBoneIndices[Index];
+		const int32 ParentIndex = InRefSkeleton.GetParentIndex(BoneIndex);
+		if (ParentIndex == INDEX_NONE || BoneDepths[ParentIndex] == INDEX_NONE)
+		{
+			// Parents must come before children, leave it to the caller's fallback to complain.
+			return;
+		}
+
+		const int32 Depth = BoneDepths[ParentIndex] + 1;
+		BoneDepths[BoneIndex] = Depth;
+		if (Depth == LevelCounts.Num())
+		{
+			LevelCounts.Add(0);
+		}
+		LevelCounts[Depth]++;
+	}
+
+	// Level 0 only holds the root, which isn't part of the levels.
+	const int32 NumLevels = LevelCounts.Num() - 1;
+	LevelOffsets.AddUninitialized(NumLevels + 1);
+	LevelOffsets[0] = 0;
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		LevelOffsets[Level + 1] = LevelOffsets[Level] + LevelCounts[Level + 1];
+	}
+
+	// Counting sort, keeps the order of RequiredBoneIndices within a level.
+	TArray<int32, TInlineAllocator<32>> WriteOffsets;
+	WriteOffsets.Append(LevelOffsets.GetData(), NumLevels);
+	BoneIndices.AddUninitialized(NumRequiredBones - 1);
+	ParentIndices.AddUninitialized(NumRequiredBones - 1);
+	for (int32 Index = 1; Index < NumRequiredBones; Index++)
+	{
+		const int32 BoneIndex = RequiredBoneIndices[Index];
+		const int32 WriteIndex = WriteOffsets[BoneDepths[BoneIndex] - 1]++;
+		BoneIndices[WriteIndex] = BoneIndex;
+		ParentIndices[WriteIndex] = InRefSkeleton.GetParentIndex(BoneIndex);
+	}
+
+	RequiredBones = RequiredBoneIndices;
+	RefSkeleton = &InRefSkeleton;
+}
+
+void FBoneDepthLevels::ConvertToComponentSpace(const FTransform* LocalTransforms, FTransform* ComponentSpaceTransforms) const
+{
+	for (int32 Level = 0; Level + 1 < LevelOffsets.Num(); Level++)
+	{
+		const int32 Start = LevelOffsets[Level];
+		FTransformBatch::MultiplyIndexed(ComponentSpaceTransforms, LocalTransforms, BoneIndices.GetData() + Start, ParentIndices.GetData() + Start, LevelOffsets[Level + 1] - Start);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 // FBoneContainer
 
@@ -209,6 +283,8 @@ void FBoneContainer::Initialize()
 		BoneSwitchArray[BoneIndex] = true;
 	}
 
+	BoneDepthLevels.Build(BoneIndicesArray, *RefSkeleton);
+
 	// Clear remapping table
 	SkeletonToPoseBoneIndexArray.Empty();
 
@@ -0,0 +1,272 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ReplicationBenchmarkCommandlet.cpp: Replication benchmark with simulated clients.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Commandlets/ReplicationBenchmarkCommandlet.h"
+#include "Engine/NullNetDriver.h"
+#include "Engine/NullNetConnection.h"
+#include "Net/NetworkProfiler.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogReplicationBenchmark, Log, All);
+
+namespace ReplicationBenchmark
+{
+	/** Circle an actor moves along, so that the movement is the same on every run. */
+	struct FScriptedPath
+	{
+		FVector Center;
+		float Radius;
+		/** Radians per second, negative goes clockwise. */
+		float AngularSpeed;
+		/** Angle at time 0. */
+		float Phase;
+
+		/** Picks a random circle with its center within Extent of the origin. */
+		void Init(FRandomStream& Random, float Extent, float MinRadius, float MaxRadius, float MaxAngularSpeed)
+		{
+			Center = FVector(Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent), 0.f);
+			Radius = Random.FRandRange(MinRadius, MaxRadius);
+			AngularSpeed = Random.FRandRange(-MaxAngularSpeed, MaxAngularSpeed);
+			Phase = Random.FRandRange(0.f, 2.f * PI);
+		}
+
+		/** Moves Actor to where it is at Time, facing the way it moves. */
+		void Apply(AActor* Actor, float Time) const
+		{
+			const float Angle = Phase + AngularSpeed * Time;
+			const FVector Offset(FMath::Cos(Angle), FMath::Sin(Angle), 0.f);
+			const FVector Velocity = Radius * AngularSpeed * FVector(-Offset.Y, Offset.X, 0.f);
+
+			Actor->SetActorLocationAndRotation(Center + Radius * Offset, Velocity.Rotation());
+			Actor->GetRootComponent()->ComponentVelocity = Velocity;
+		}
+	};
+}
+
+UReplicationBenchmarkCommandlet::UReplicationBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsServer = true;
+	IsClient = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UReplicationBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace ReplicationBenchmark;
+
+	const TCHAR* Parms = *Params;
+
+	int32 NumClients = 16;
+	int32 NumActors = 1000;
+	int32 NumFrames = 900;
+	int32 NumWarmupFrames = 30;
+	int32 NetSpeed = 0;
+	int32 Seed = 0;
+	float TickRate = 30.f;
+	float WorldSize = 40000.f;
+	FString ActorClassName = TEXT("/Script/Engine.Actor");
+
+	FParse::Value(Parms, TEXT("Clients="), NumClients);
+	FParse::Value(Parms, TEXT("Actors="), NumActors);
+	FParse::Value(Parms, TEXT("Frames="), NumFrames);
+	FParse::Value(Parms, TEXT("Warmup="), NumWarmupFrames);
+	FParse::Value(Parms, TEXT("NetSpeed="), NetSpeed);
+	FParse::Value(Parms, TEXT("Seed="), Seed);
+	FParse::Value(Parms, TEXT("TickRate="), TickRate);
+	FParse::Value(Parms, TEXT("WorldSize="), WorldSize);
+	FParse::Value(Parms, TEXT("ActorClass="), ActorClassName);
+
+#if USE_NETWORK_PROFILER
+	const bool bNetProfile = FParse::Param(Parms, TEXT("NetProfile"));
+#endif
+
+	NumClients = FMath::Max(NumClients, 1);
+	NumActors = FMath::Max(NumActors, 0);
+	NumFrames = FMath::Max(NumFrames, 1);
+	NumWarmupFrames = FMath::Max(NumWarmupFrames, 0);
+	TickRate = FMath::Max(TickRate, 1.f);
+
+	UClass* ActorClass = LoadClass<AActor>(NULL, *ActorClassName, NULL, LOAD_None, NULL);
+	if (ActorClass == NULL)
+	{
+		UE_LOG(LogReplicationBenchmark, Error, TEXT("Couldn't load actor class %s"), *ActorClassName);
+		return 1;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	// Listen before the actors are initialized, like UEngine::LoadMap does for a server
+	UNullNetDriver* NetDriver = NewObject<UNullNetDriver>();
+	NetDriver->SetWorld(World);
+	World->SetNetDriver(NetDriver);
+
+	FString Error;
+	if (!NetDriver->InitListen(World, World->URL, false, Error))
+	{
+		UE_LOG(LogReplicationBenchmark, Error, TEXT("Couldn't listen: %s"), *Error);
+		World->SetNetDriver(NULL);
+		NetDriver->SetWorld(NULL);
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		return 1;
+	}
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// Everything is spawned up front, the driver builds its replication schedule from the world's network actors on the first frame
+	FRandomStream Random(Seed);
+	const float Extent = 0.5f * WorldSize;
+
+	TArray<AActor*> Actors;
+	TArray<FScriptedPath> ActorPaths;
+	Actors.Reserve(NumActors);
+	ActorPaths.AddUninitialized(NumActors);
+
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		FActorSpawnParameters SpawnInfo;
+		SpawnInfo.ObjectFlags |= RF_Transient;
+		AActor* Actor = World->SpawnActor<AActor>(ActorClass, SpawnInfo);
+
+		if (Actor == NULL)
+		{
+			UE_LOG(LogReplicationBenchmark, Error, TEXT("Couldn't spawn a %s"), *ActorClass->GetName());
+			break;
+		}
+
+		if (Actor->GetRootComponent() == NULL)
+		{
+			USceneComponent* Root = NewObject<USceneComponent>(Actor, NAME_None, RF_Transient);
+			Actor->SetRootComponent(Root);
+			Root->RegisterComponent();
+		}
+
+		Actor->SetReplicates(true);
+		Actor->bReplicateMovement = true;
+
+		ActorPaths[i].Init(Random, Extent, 200.f, 2000.f, 1.f);
+		ActorPaths[i].Apply(Actor, 0.f);
+		Actors.Add(Actor);
+	}
+
+	// The clients move slower, over a larger part of the world, so that what is relevant to them changes over time
+	TArray<APlayerController*> Controllers;
+	TArray<FScriptedPath> ControllerPaths;
+	ControllerPaths.AddUninitialized(NumClients);
+
+	for (int32 i = 0; i < NumClients; i++)
+	{
+		UNullNetConnection* Connection = NetDriver->AddSimulatedClient(APlayerController::StaticClass(), NetSpeed);
+
+		if (Connection == NULL)
+		{
+			break;
+		}
+
+		ControllerPaths[i].Init(Random, 0.25f * WorldSize, 0.1f * WorldSize, 0.25f * WorldSize, 0.1f);
+		ControllerPaths[i].Apply(Connection->PlayerController, 0.f);
+		Controllers.Add(Connection->PlayerController);
+	}
+
+	const float DeltaTime = 1.f / TickRate;
+
+	uint64 TickFlushCycles = 0;
+	uint32 MaxTickFlushCycles = 0;
+
+	for (int32 Frame = 0; Frame < NumWarmupFrames + NumFrames; Frame++)
+	{
+		// The first frames open channels to everything, the results only count the steady state after them
+		if (Frame == NumWarmupFrames)
+		{
+			NetDriver->ResetTotals();
+			TickFlushCycles = 0;
+			MaxTickFlushCycles = 0;
+
+#if USE_NETWORK_PROFILER
+			if (bNetProfile)
+			{
+				GNetworkProfiler.EnableTracking(true);
+				GNetworkProfiler.TrackSessionChange(true, World->URL);
+			}
+#endif
+		}
+
+		World->TimeSeconds += DeltaTime;
+		World->RealTimeSeconds += DeltaTime;
+		World->DeltaTimeSeconds = DeltaTime;
+
+		NETWORK_PROFILER(GNetworkProfiler.TrackFrameBegin());
+
+		NetDriver->TickDispatch(DeltaTime);
+
+		for (int32 i = 0; i < Actors.Num(); i++)
+		{
+			ActorPaths[i].Apply(Actors[i], World->TimeSeconds);
+		}
+
+		for (int32 i = 0; i < Controllers.Num(); i++)
+		{
+			ControllerPaths[i].Apply(Controllers[i], World->TimeSeconds);
+		}
+
+		const uint32 StartCycles = FPlatformTime::Cycles();
+
+		NetDriver->TickFlush(DeltaTime);
+		NetDriver->PostTickFlush();
+
+		const uint32 FrameCycles = FPlatformTime::Cycles() - StartCycles;
+		TickFlushCycles += FrameCycles;
+		MaxTickFlushCycles = FMath::Max(MaxTickFlushCycles, FrameCycles);
+	}
+
+#if USE_NETWORK_PROFILER
+	if (bNetProfile)
+	{
+		GNetworkProfiler.EnableTracking(false);
+	}
+#endif
+
+	uint64 TotalOutBytes = 0;
+	uint64 TotalOutPackets = 0;
+
+	for (int32 i = 0; i < NetDriver->ClientConnections.Num(); i++)
+	{
+		const UNullNetConnection* Connection = CastChecked<UNullNetConnection>(NetDriver->ClientConnections[i]);
+		TotalOutBytes += Connection->TotalOutBytes;
+		TotalOutPackets += Connection->TotalOutPackets;
+	}
+
+	const double MSPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+	const double Seconds = NumFrames * DeltaTime;
+	const int32 NumConnections = FMath::Max(NetDriver->ClientConnections.Num(), 1);
+
+	UE_LOG(LogReplicationBenchmark, Display, TEXT("%d clients, %d actors, %d frames at %.0f Hz (%.1f seconds, after %d warmup frames)"),
+		Controllers.Num(), Actors.Num(), NumFrames, TickRate, Seconds, NumWarmupFrames);
+	UE_LOG(LogReplicationBenchmark, Display, TEXT("  Server: %.3f ms per frame, %.3f ms max"),
+		TickFlushCycles * MSPerCycle / NumFrames, MaxTickFlushCycles * MSPerCycle);
+	UE_LOG(LogReplicationBenchmark, Display, TEXT("  ServerReplicateActors: %.3f ms per frame, %.5f ms per replicated actor (%llu actors replicated)"),
+		NetDriver->TotalReplicateActorsCycles * MSPerCycle / NumFrames,
+		NetDriver->TotalReplicatedActors > 0 ? NetDriver->TotalReplicateActorsCycles * MSPerCycle / NetDriver->TotalReplicatedActors : 0.0,
+		NetDriver->TotalReplicatedActors);
+	UE_LOG(LogReplicationBenchmark, Display, TEXT("  Per connection: %.0f bytes/s, %.1f packets/s"),
+		TotalOutBytes / Seconds / NumConnections, TotalOutPackets / Seconds / NumConnections);
+	UE_LOG(LogReplicationBenchmark, Display, TEXT("  Bunches: %.0f per second"),
+		NetDriver->TotalOutBunches / Seconds);
+
+	NetDriver->Shutdown();
+	NetDriver->SetWorld(NULL);
+	World->SetNetDriver(NULL);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return 0;
+}
@@ -143,6 +143,72 @@ FOutBunch::FOutBunch( UPackageMap *InPackageMap, int64 MaxBits )
 }
 
 
+void FOutBunch::Reinit( UChannel* InChannel, bool bInClose )
+{
+	Reinit( InChannel->Connection->PackageMap, InChannel->Connection->MaxPacket*8-MAX_BUNCH_HEADER_BITS-MAX_PACKET_TRAILER_BITS-MAX_PACKET_HEADER_BITS );
+
+	Channel		= InChannel;
+	ChIndex		= InChannel->ChIndex;
+	ChType		= InChannel->ChType;
+	bClose		= bInClose;
+
+	checkSlow(!Channel->Closing);
+	checkSlow(Channel->Connection->Channels[Channel->ChIndex]==Channel);
+
+	// Match the byte swapping settings of the connection
+	SetByteSwapping(Channel->Connection->bNeedsByteSwapping);
+
+	// Reserve channel and set bunch info.
+	if( Channel->NumOutRec >= RELIABLE_BUFFER-1+bClose )
+	{
+		SetOverflowed();
+	}
+}
+
+void FOutBunch::Reinit( UPackageMap *InPackageMap, int64 MaxBits )
+{
+	FBitWriter::Reinit( MaxBits, true );
+	PackageMap				= InPackageMap;
+	Next					= NULL;
+	Channel					= NULL;
+	Time					= 0;
+	ReceivedAck				= false;
+	ChIndex					= 0;
+	ChType					= 0;
+	ChSequence				= 0;
+	PacketId				= 0;
+	bOpen					= 0;
+	bClose					= 0;
+	bDormant				= 0;
+	bReliable				= 0;
+	bPartial				= 0;
+	bPartialInitial			= 0;
+	bPartialFinal			= 0;
+	bHasGUIDs				= 0;
+	bHasMustBeMappedGUIDs	= 0;
+	ExportNetGUIDs.Reset();
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	DebugString.Empty();
+#endif
+}
+
+FScopedOutBunch::FScopedOutBunch( UChannel* InChannel, bool bClose )
+:	Connection	( InChannel->Connection )
+,	Bunch		( InChannel->Connection->AllocOutBunch( InChannel, bClose ) )
+{
+}
+
+FScopedOutBunch::FScopedOutBunch( UNetConnection* InConnection, int64 InMaxBits )
+:	Connection	( InConnection )
+,	Bunch		( InConnection->AllocOutBunch( InMaxBits ) )
+{
+}
+
+FScopedOutBunch::~FScopedOutBunch()
+{
+	Connection->FreeOutBunch( Bunch );
+}
+
 FControlChannelOutBunch::FControlChannelOutBunch(UChannel* InChannel, bool bClose)
 	: FOutBunch(InChannel, bClose)
 {
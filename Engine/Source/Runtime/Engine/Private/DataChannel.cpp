@@ -129,7 +129,7 @@ bool UChannel::CleanUp( const bool bForDestroy )
 	for (FOutBunch* Out = OutRec, *NextOut; Out != NULL; Out = NextOut)
 	{
 		NextOut = Out->Next;
-		delete Out;
+		Connection->FreeOutBunch(Out);
 	}
 	for (FInBunch* In = InRec, *NextIn; In != NULL; In = NextIn)
 	{
@@ -215,7 +215,7 @@ void UChannel::ReceivedAcks()
 		DoClose = DoClose || !!OutRec->bClose;
 		FOutBunch* Release = OutRec;
 		OutRec = OutRec->Next;
-		delete Release;
+		Connection->FreeOutBunch(Release);
 		NumOutRec--;
 	}
 
@@ -760,7 +760,7 @@ FPacketIdRange UChannel::SendBunch( FOutBunch* Bunch, bool Merge )
 
 		while(bitsLeft > 0)
 		{
-			FOutBunch * PartialBunch = new FOutBunch(this, false);
+			FOutBunch * PartialBunch = Connection->AllocOutBunch(this, false);
 			int64 bitsThisBunch = FMath::Min<int64>(bitsLeft, MAX_PARTIAL_BUNCH_SIZE_BITS);
 			PartialBunch->SerializeBits(data, bitsThisBunch);
 			OutgoingBunches.Add(PartialBunch);
@@ -867,7 +867,7 @@ FPacketIdRange UChannel::SendBunch( FOutBunch* Bunch, bool Merge )
 	{
 		FOutBunch *DeleteBunch = *It;
 		if (DeleteBunch != Bunch)
-			delete DeleteBunch;
+			Connection->FreeOutBunch(DeleteBunch);
 	}
 
 	return PacketIdRange;
@@ -897,7 +897,7 @@ FOutBunch* UChannel::PrepBunch(FOutBunch* Bunch, FOutBunch* OutBunch, bool Merge
 			Bunch->Next	= NULL;
 			Bunch->ChSequence = ++Connection->OutReliable[ChIndex];
 			NumOutRec++;
-			OutBunch = new FOutBunch(*Bunch);
+			OutBunch = Connection->AllocOutBunch(*Bunch);
 			FOutBunch** OutLink = &OutRec;
 			while(*OutLink) // This was rewritten from a single-line for loop due to compiler complaining about empty body for loops (-Wempty-body)
 			{
@@ -1965,7 +1965,8 @@ bool UActorChannel::ReplicateActor()
 	}
 
 	// Create an outgoing bunch, and skip this actor if the channel is saturated.
-	FOutBunch Bunch( this, 0 );
+	FScopedOutBunch PooledBunch( this, 0 );
+	FOutBunch& Bunch = *PooledBunch;
 	if( Bunch.IsError() )
 	{
 		return false;
@@ -11,6 +11,7 @@
 #include "Net/DataReplication.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/PackageMapClient.h"
+#include "Engine/DemoNetDriver.h"
 
 static TAutoConsoleVariable<int32> CVarMaxRPCPerNetUpdate( TEXT( "net.MaxRPCPerNetUpdate" ), 2, TEXT( "Maximum number of RPCs allowed per net update" ) );
 
@@ -61,7 +62,7 @@ bool IsCustomDeltaProperty( UProperty * Property )
 	return false;
 }
 
-bool FObjectReplicator::SerializeCustomDeltaProperty( UNetConnection * Connection, void* Src, UProperty * Property, int32 ArrayDim, FNetBitWriter & OutBunch, TSharedPtr<INetDeltaBaseState> &NewFullState, TSharedPtr<INetDeltaBaseState> & OldState )
+bool FObjectReplicator::SerializeCustomDeltaProperty( UNetConnection * Connection, void* Src, UProperty * Property, int32 ArrayDim, FNetBitWriter & OutBunch, TSharedPtr<INetDeltaBaseState> &NewFullState, TSharedPtr<INetDeltaBaseState> & OldState, INetDeltaBaseState * AckedState )
 {
 	check( NewFullState.IsValid() == false ); // NewState is passed in as NULL and instantiated within this function if necessary
 
@@ -84,6 +85,7 @@ bool FObjectReplicator::SerializeCustomDeltaProperty( UNetConnection * Connectio
 	Parms.Writer			= &OutBunch;
 	Parms.Map				= Connection->PackageMap;
 	Parms.OldState			= OldState.Get();
+	Parms.AckedState		= AckedState;
 	Parms.NewState			= &NewFullState;
 	Parms.NetSerializeCB	= &NetSerializeCB;
 
@@ -133,7 +135,7 @@ void FObjectReplicator::InitRecentProperties( uint8* Source )
 
 					TSharedPtr<INetDeltaBaseState> OldState;
 
-					SerializeCustomDeltaProperty( Connection, Source, *It, ArrayIdx, DeltaState, NewState, OldState );
+					SerializeCustomDeltaProperty( Connection, Source, *It, ArrayIdx, DeltaState, NewState, OldState, NULL );
 				}
 			}
 		}
@@ -542,10 +544,15 @@ bool FObjectReplicator::ReceivedBunch( FInBunch &Bunch, const FReplicationFlags&
 
 				FNetSerializeCB NetSerializeCB( OwningChannel->Connection->Driver );
 
+				// Give the struct a state of its own on the receiving side too, for the values it has received
+				TSharedPtr<INetDeltaBaseState> & ReceivedState = RecentCustomDeltaState.FindOrAdd( ReplicatedProp->RepIndex + Element );
+
 				Parms.DebugName			= StructProperty->GetName();
 				Parms.Struct			= InnerStruct;
 				Parms.Map				= PackageMap;
 				Parms.Reader			= &Bunch;
+				Parms.OldState			= ReceivedState.Get();
+				Parms.NewState			= &ReceivedState;
 				Parms.NetSerializeCB	= &NetSerializeCB;
 
 				// Call the custom delta serialize function to handle it
@@ -798,6 +805,11 @@ void FObjectReplicator::ReplicateCustomDeltaProperties( FOutBunch & Bunch, FRepl
 
 	UNetConnection * OwningChannelConnection = OwningChannel->Connection;
 
+	// Scratch writer for the properties, from the connection's pool so it doesn't allocate every time
+	FScopedOutBunch TempBitWriter( OwningChannelConnection, 0 );
+
+	const bool bIsReplay = OwningChannelConnection->Driver->IsA( UDemoNetDriver::StaticClass() );
+
 	// Initialize a map of which conditions are valid
 
 	bool ConditionMap[COND_Max];
@@ -840,6 +852,12 @@ void FObjectReplicator::ReplicateCustomDeltaProperties( FOutBunch & Bunch, FRepl
 			}
 		}
 
+		if ( RepState->RepChangedPropertyTracker.IsValid() && !RepState->RepChangedPropertyTracker->Parents[RetireIndex].Active )
+		{
+			// Turned off with DOREPLIFETIME_ACTIVE_OVERRIDE
+			continue;
+		}
+
 		const int32 BitsWrittenBeforeThis = Bunch.GetNumBits();
 
 		// If this is a dynamic array, we do the delta here
@@ -855,12 +873,21 @@ void FObjectReplicator::ReplicateCustomDeltaProperties( FOutBunch & Bunch, FRepl
 
 		ValidateRetirementHistory( Retire );
 
-		FNetBitWriter TempBitWriter( OwningChannel->Connection->PackageMap, 0 );
+		// The records left are the updates in flight, the oldest one was made from the last state the receiver is known to have.
+		// Replays can be started from any checkpoint instead of from what was sent before, so they don't have an acked state.
+		INetDeltaBaseState * AckedState = NULL;
+
+		if ( !bIsReplay )
+		{
+			AckedState = Retire.Next != NULL ? Retire.Next->DynamicState.Get() : OldState.Get();
+		}
+
+		TempBitWriter->Reinit( OwningChannelConnection->PackageMap, 0 );
 
 		//-----------------------------------------
 		//	Do delta serialization on dynamic properties
 		//-----------------------------------------
-		const bool WroteSomething = SerializeCustomDeltaProperty( OwningChannelConnection, (void*)Object, It, Index, TempBitWriter, NewState, OldState );
+		const bool WroteSomething = SerializeCustomDeltaProperty( OwningChannelConnection, (void*)Object, It, Index, *TempBitWriter, NewState, OldState, AckedState );
 
 		if ( !WroteSomething )
 		{
@@ -881,7 +908,7 @@ void FObjectReplicator::ReplicateCustomDeltaProperties( FOutBunch & Bunch, FRepl
 		const int NumStartingBits = Bunch.GetNumBits();
 
 		// Send property.
-		Bunch.SerializeBits( TempBitWriter.GetData(), TempBitWriter.GetNumBits() );
+		Bunch.SerializeBits( TempBitWriter->GetData(), TempBitWriter->GetNumBits() );
 
 		NETWORK_PROFILER(GNetworkProfiler.TrackReplicateProperty(It, Bunch.GetNumBits() - NumStartingBits));
 	}
@@ -18,11 +18,13 @@
 #include "NetworkReplayStreaming.h"
 #include "Net/UnrealNetwork.h"
 #include "Net/NetworkProfiler.h"
+#include "Engine/PackageMapClient.h"
 
 DEFINE_LOG_CATEGORY_STATIC( LogDemo, Log, All );
 
 static TAutoConsoleVariable<float> CVarDemoRecordHz( TEXT( "demo.RecordHz" ), 10, TEXT( "Number of demo frames recorded per second" ) );
 static TAutoConsoleVariable<float> CVarDemoTimeDilation( TEXT( "demo.TimeDilation" ), -1.0f, TEXT( "Override time dilation during demo playback (-1 = don't override)" ) );
+static TAutoConsoleVariable<float> CVarDemoCheckpointSaveDelay( TEXT( "demo.CheckpointSaveDelayInSeconds" ), 30.0f, TEXT( "Seconds of demo time between the checkpoints playback can jump to (0 = don't record checkpoints)" ) );
 
 static const int32 MAX_DEMO_READ_WRITE_BUFFER = 1024 * 2;
 
@@ -46,6 +48,8 @@ bool UDemoNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, con
 		bIsRecordingDemoFrame	= false;
 		bDemoPlaybackDone		= false;
 		bChannelsArePaused		= false;
+		CheckpointConnection	= NULL;
+		GotoTime				= -1.0f;
 
 		ResetDemoState();
 
@@ -143,6 +147,7 @@ void UDemoNetDriver::ResetDemoState()
 	DemoTotalTime	= 0;
 	DemoCurrentTime	= 0;
 	DemoTotalFrames	= 0;
+	LastCheckpointTime = 0;
 }
 
 bool UDemoNetDriver::InitConnect( FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error )
@@ -686,6 +691,92 @@ void UDemoNetDriver::TickDemoRecord( float DeltaSeconds )
 	int32 EndCount = 0;
 
 	*FileAr << EndCount;
+
+	// Checkpoint right after the first frame, so playback always has one to go back to, and then periodically
+	const float CheckpointSaveDelay = CVarDemoCheckpointSaveDelay.GetValueOnGameThread();
+
+	if ( CheckpointSaveDelay > 0.0f && ( DemoFrameNum == 1 || DemoCurrentTime - LastCheckpointTime >= CheckpointSaveDelay ) )
+	{
+		SaveCheckpoint();
+	}
+}
+
+void UDemoNetDriver::SaveCheckpoint()
+{
+	FArchive* CheckpointAr = ReplayStreamer->GetCheckpointArchive();
+
+	if ( CheckpointAr == NULL )
+	{
+		return;		// The streamer doesn't support checkpoints
+	}
+
+	UNetConnection* RecordingConnection = ClientConnections[0];
+
+	// Replicate every actor that has a channel to a new connection, on the same channel index so the stream that follows applies to it.
+	// The spectator is left out, playback keeps its own across checkpoints.
+	CheckpointConnection = NewObject<UDemoNetConnection>();
+	CheckpointConnection->InitConnection( this, USOCK_Open, RecordingConnection->URL, 1000000 );
+	ClientConnections.Add( CheckpointConnection );
+
+	// The stream only sends the NetGUID of objects the recording connection already exported
+	CastChecked< UPackageMapClient >( CheckpointConnection->PackageMap )->ExportNetGUIDsFrom( CastChecked< UPackageMapClient >( RecordingConnection->PackageMap ) );
+
+	for ( auto It = RecordingConnection->ActorChannels.CreateIterator(); It; ++It )
+	{
+		AActor* Actor = It.Key().Get();
+		UActorChannel* RecordingChannel = It.Value();
+
+		if ( Actor == NULL || RecordingChannel == NULL || RecordingChannel->Closing || Actor == RecordingConnection->PlayerController )
+		{
+			continue;
+		}
+
+		UActorChannel* Channel = (UActorChannel*)CheckpointConnection->CreateChannel( CHTYPE_Actor, 1, RecordingChannel->ChIndex );
+		Channel->SetChannelActor( Actor );
+		Channel->ReplicateActor();
+	}
+
+	CheckpointConnection->FlushNet();
+
+	// Write a count of 0 to signal the end of the checkpoint packets
+	int32 EndCount = 0;
+
+	*CheckpointAr << EndCount;
+
+	// Then the sequence numbers of the recording connection, which the packets after the checkpoint carry on from
+	int32 NextPacketId = RecordingConnection->OutPacketId;
+	int32 NumReliableChannels = 0;
+
+	for ( int32 i = 0; i < MAX_CHANNELS; i++ )
+	{
+		if ( RecordingConnection->OutReliable[i] != 0 )
+		{
+			NumReliableChannels++;
+		}
+	}
+
+	*CheckpointAr << NextPacketId;
+	*CheckpointAr << NumReliableChannels;
+
+	for ( int32 i = 0; i < MAX_CHANNELS; i++ )
+	{
+		if ( RecordingConnection->OutReliable[i] != 0 )
+		{
+			int32 ChIndex = i;
+
+			*CheckpointAr << ChIndex;
+			*CheckpointAr << RecordingConnection->OutReliable[i];
+		}
+	}
+
+	// Anything sent while cleaning up goes nowhere
+	UDemoNetConnection* Connection = CheckpointConnection;
+	CheckpointConnection = NULL;
+	Connection->CleanUp();
+
+	ReplayStreamer->FlushCheckpoint( DemoCurrentTime * 1000 );
+
+	LastCheckpointTime = DemoCurrentTime;
 }
 
 void UDemoNetDriver::PauseChannels( const bool bPause )
@@ -780,17 +871,22 @@ bool UDemoNetDriver::ReadDemoFrame()
 
 	DemoDeltaTime -= ServerDeltaTime;
 
+	return ReadDemoPackets( *FileAr );
+}
+
+bool UDemoNetDriver::ReadDemoPackets( FArchive& Ar )
+{
 	while ( true )
 	{
 		uint8 ReadBuffer[ MAX_DEMO_READ_WRITE_BUFFER ];
 
 		int32 PacketBytes;
 
-		*FileAr << PacketBytes;
+		Ar << PacketBytes;
 
-		if ( FileAr->IsError() )
+		if ( Ar.IsError() )
 		{
-			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoFrame: Failed to read demo PacketBytes" ) );
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoPackets: Failed to read demo PacketBytes" ) );
 			StopDemo();
 			return false;
 		}
@@ -802,24 +898,24 @@ bool UDemoNetDriver::ReadDemoFrame()
 
 		if ( PacketBytes > sizeof( ReadBuffer ) )
 		{
-			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoFrame: PacketBytes > sizeof( ReadBuffer )" ) );
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoPackets: PacketBytes > sizeof( ReadBuffer )" ) );
 
 			StopDemo();
 
 			if ( World != NULL && World->GetGameInstance() != NULL )
 			{
-				World->GetGameInstance()->HandleDemoPlaybackFailure( EDemoPlayFailure::Generic, FString( TEXT( "UDemoNetDriver::ReadDemoFrame: PacketBytes > sizeof( ReadBuffer )" ) ) );
+				World->GetGameInstance()->HandleDemoPlaybackFailure( EDemoPlayFailure::Generic, FString( TEXT( "UDemoNetDriver::ReadDemoPackets: PacketBytes > sizeof( ReadBuffer )" ) ) );
 			}
 
 			return false;
 		}
 
 		// Read data from file.
-		FileAr->Serialize( ReadBuffer, PacketBytes );
+		Ar.Serialize( ReadBuffer, PacketBytes );
 
-		if ( FileAr->IsError() )
+		if ( Ar.IsError() )
 		{
-			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoFrame: Failed to read demo file packet" ) );
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoPackets: Failed to read demo file packet" ) );
 			StopDemo();
 			return false;
 		}
@@ -827,13 +923,13 @@ bool UDemoNetDriver::ReadDemoFrame()
 #if DEMO_CHECKSUMS == 1
 		{
 			uint32 ServerChecksum = 0;
-			*FileAr << ServerChecksum;
+			Ar << ServerChecksum;
 
 			const uint32 Checksum = FCrc::MemCrc32( ReadBuffer, PacketBytes, 0 );
 
 			if ( Checksum != ServerChecksum )
 			{
-				UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoFrame: Checksum != ServerChecksum" ) );
+				UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoPackets: Checksum != ServerChecksum" ) );
 				StopDemo();
 				return false;
 			}
@@ -846,7 +942,7 @@ bool UDemoNetDriver::ReadDemoFrame()
 		if ( ServerConnection == NULL || ServerConnection->State == USOCK_Closed )
 		{
 			// Something we received resulted in the demo being stopped
-			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoFrame: ReceivedRawPacket closed connection" ) );
+			UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::ReadDemoPackets: ReceivedRawPacket closed connection" ) );
 			StopDemo();
 			return false;
 		}
@@ -863,6 +959,11 @@ void UDemoNetDriver::TickDemoPlayback( float DeltaSeconds )
 		return;
 	}
 
+	if ( GotoTime >= 0.0f )
+	{
+		return;		// Waiting for the replay streamer to load a checkpoint
+	}
+
 	const uint32 TotalDemoTimeInMS = ReplayStreamer->GetTotalDemoTime();
 
 	if ( TotalDemoTimeInMS > 0 )
@@ -890,6 +991,124 @@ void UDemoNetDriver::TickDemoPlayback( float DeltaSeconds )
 	}
 }
 
+bool UDemoNetDriver::GotoTimeInSeconds( float TimeInSeconds )
+{
+	if ( ServerConnection == NULL || ServerConnection->State == USOCK_Closed || SpectatorController == NULL || GotoTime >= 0.0f )
+	{
+		return false;
+	}
+
+	GotoTime = FMath::Max( TimeInSeconds, 0.0f );
+
+	if ( DemoTotalTime > 0.0f )
+	{
+		GotoTime = FMath::Min( GotoTime, DemoTotalTime );
+	}
+
+	ReplayStreamer->GotoTimeInMS( GotoTime * 1000, FOnCheckpointReady::CreateUObject( this, &UDemoNetDriver::LoadCheckpoint ) );
+
+	return true;
+}
+
+void UDemoNetDriver::LoadCheckpoint( bool bSuccess, uint32 CheckpointTimeInMS )
+{
+	const float TargetTime = GotoTime;
+
+	GotoTime = -1.0f;
+
+	FArchive* CheckpointAr = ReplayStreamer->GetCheckpointArchive();
+
+	if ( !bSuccess || CheckpointAr == NULL )
+	{
+		UE_LOG( LogDemo, Warning, TEXT( "UDemoNetDriver::LoadCheckpoint: Can't go to %.2f, no checkpoint was loaded. Filename: %s" ), TargetTime, *DemoFilename );
+		return;
+	}
+
+	if ( ServerConnection == NULL || ServerConnection->State == USOCK_Closed )
+	{
+		return;
+	}
+
+	const float CheckpointTime = (float)CheckpointTimeInMS / 1000.0f;
+
+	UE_LOG( LogDemo, Log, TEXT( "UDemoNetDriver::LoadCheckpoint: Going to %.2f from the checkpoint at %.2f" ), TargetTime, CheckpointTime );
+
+	PauseChannels( false );
+
+	// Close every actor channel but the spectator's. Dynamic actors are destroyed with their channel, the level's own actors are
+	// kept and get their state from the checkpoint (those that were destroyed before now can't be brought back).
+	for ( int32 i = ServerConnection->OpenChannels.Num() - 1; i >= 0; i-- )
+	{
+		UActorChannel* ActorChannel = Cast< UActorChannel >( ServerConnection->OpenChannels[i] );
+
+		if ( ActorChannel == NULL || ( ActorChannel->Actor != NULL && ActorChannel->Actor == SpectatorController ) )
+		{
+			continue;
+		}
+
+		if ( ActorChannel->Actor != NULL && ActorChannel->Actor->IsNetStartupActor() )
+		{
+			ServerConnection->ActorChannels.Remove( ActorChannel->Actor );
+			ActorChannel->Actor = NULL;
+		}
+
+		ActorChannel->ConditionalCleanUp();
+	}
+
+	// The checkpoint was recorded through a new connection, so its packets start from the first sequence numbers
+	ServerConnection->InPacketId = -1;
+	FMemory::Memzero( ServerConnection->InReliable, sizeof( ServerConnection->InReliable ) );
+
+	if ( !ReadDemoPackets( *CheckpointAr ) )
+	{
+		return;
+	}
+
+	// Then carry on with the sequence numbers of the stream that follows the checkpoint
+	int32 NextPacketId = 0;
+	int32 NumReliableChannels = 0;
+
+	*CheckpointAr << NextPacketId;
+	*CheckpointAr << NumReliableChannels;
+
+	bool bSequencesValid = !CheckpointAr->IsError();
+
+	for ( int32 i = 0; i < NumReliableChannels && bSequencesValid; i++ )
+	{
+		int32 ChIndex = 0;
+		int32 Sequence = 0;
+
+		*CheckpointAr << ChIndex;
+		*CheckpointAr << Sequence;
+
+		bSequencesValid = !CheckpointAr->IsError() && ChIndex >= 0 && ChIndex < MAX_CHANNELS;
+
+		if ( bSequencesValid )
+		{
+			ServerConnection->InReliable[ChIndex] = Sequence;
+		}
+	}
+
+	if ( !bSequencesValid )
+	{
+		UE_LOG( LogDemo, Error, TEXT( "UDemoNetDriver::LoadCheckpoint: Failed to read checkpoint sequence numbers" ) );
+		StopDemo();
+		return;
+	}
+
+	ServerConnection->InPacketId = NextPacketId - 1;
+
+	// Read the frames recorded after the checkpoint up to the time we're going to, without ticking the world in between
+	DemoCurrentTime		= FMath::Max( TargetTime, CheckpointTime );
+	DemoDeltaTime		= DemoCurrentTime - CheckpointTime;
+	bDemoPlaybackDone	= false;
+
+	while ( ReadDemoFrame() )
+	{
+		DemoFrameNum++;
+	}
+}
+
 void UDemoNetDriver::SpawnDemoRecSpectator( UNetConnection* Connection )
 {
 	check( Connection != NULL );
@@ -981,12 +1200,15 @@ void UDemoNetConnection::LowLevelSend( void* Data, int32 Count )
 		UE_LOG( LogDemo, Fatal, TEXT( "UDemoNetConnection::LowLevelSend: Count > MAX_DEMO_READ_WRITE_BUFFER." ) );
 	}
 
-	FArchive* FileAr = GetDriver()->ReplayStreamer->GetStreamingArchive();
+	// Checkpoints are recorded through their own connection, into their own archive
+	const bool bIsCheckpoint = ( this == GetDriver()->CheckpointConnection );
+
+	FArchive* FileAr = bIsCheckpoint ? GetDriver()->ReplayStreamer->GetCheckpointArchive() : GetDriver()->ReplayStreamer->GetStreamingArchive();
 
 	if ( !GetDriver()->ServerConnection && FileAr )
 	{
 		// If we're outside of an official demo frame, we need to queue this up or it will throw off the stream
-		if ( !GetDriver()->bIsRecordingDemoFrame )
+		if ( !bIsCheckpoint && !GetDriver()->bIsRecordingDemoFrame )
 		{
 			FQueuedDemoPacket & B = *( new( QueuedDemoPackets )FQueuedDemoPacket );
 			B.Data.AddUninitialized( Count );
@@ -152,3 +152,418 @@ USceneComponent* FComponentReference::GetComponent(AActor* OwningActor) const
 
 	return Result;
 }
+
+static TAutoConsoleVariable<int32> CVarNetRepMovementDelta(
+	TEXT("net.RepMovementDelta"),
+	1,
+	TEXT("Sends replicated movement as a difference from the last movement the connection acked.\n")
+	TEXT("0 always sends the full movement, which clients read either way."),
+	ECVF_Default);
+
+/** FRepMovement quantized the way FRepMovement::NetSerialize sends it */
+struct FRepMovementQuantized
+{
+	FIntVector Location;
+	/** Pitch, yaw and roll compressed to shorts */
+	FIntVector Rotation;
+	FIntVector LinearVelocity;
+	/** Zero unless bRepPhysics is set */
+	FIntVector AngularVelocity;
+	uint8 Flags;
+
+	FRepMovementQuantized()
+		: Location(0, 0, 0)
+		, Rotation(0, 0, 0)
+		, LinearVelocity(0, 0, 0)
+		, AngularVelocity(0, 0, 0)
+		, Flags(0)
+	{
+	}
+
+	bool operator==(const FRepMovementQuantized& Other) const
+	{
+		return Location == Other.Location && Rotation == Other.Rotation && LinearVelocity == Other.LinearVelocity
+			&& AngularVelocity == Other.AngularVelocity && Flags == Other.Flags;
+	}
+};
+
+/**
+ * Base state of FRepMovement::NetDeltaSerialize.
+ *
+ * Movements are sent with a key, which wraps around after NumKeys, and a delta names the key of the movement it is a
+ * difference from. The receiving side keeps the last movement it received with each key. The sending side keeps the
+ * last movement it sent, and gets the state the receiver is known to have from the property's retirement records
+ * (FNetDeltaSerializeInfo::AckedState). Keys are handed out in order starting after the key of that acked movement,
+ * and never wrap around onto it, so the receiver still has the acked movement however many updates are in flight.
+ *
+ * When a packet is lost, the replicator goes back to the state the lost update was made from. Movements sent after
+ * that one may still have arrived, so a restored state always sends the current movement, even if it didn't change.
+ */
+class FRepMovementDeltaState : public INetDeltaBaseState
+{
+public:
+
+	enum { NumKeyBits = 4 };
+	enum { NumKeys = 1 << NumKeyBits };
+
+	struct FKeyedMovement
+	{
+		uint8 Key;
+		FRepMovementQuantized Movement;
+	};
+
+	FRepMovementDeltaState()
+		: Sequence(0)
+		, NextKey(0)
+		, bHasLastSent(false)
+	{
+	}
+
+	virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+	{
+		FRepMovementDeltaState* Other = static_cast<FRepMovementDeltaState*>(OtherState);
+		if (NextKey != Other->NextKey || bHasLastSent != Other->bHasLastSent || (bHasLastSent && !(LastSent == Other->LastSent))
+			|| Movements.Num() != Other->Movements.Num())
+		{
+			return false;
+		}
+		for (int32 Index = 0; Index < Movements.Num(); Index++)
+		{
+			if (Movements[Index].Key != Other->Movements[Index].Key || !(Movements[Index].Movement == Other->Movements[Index].Movement))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const FKeyedMovement* Find(uint8 Key) const
+	{
+		for (const FKeyedMovement& Keyed : Movements)
+		{
+			if (Keyed.Key == Key)
+			{
+				return &Keyed;
+			}
+		}
+		return NULL;
+	}
+
+	void Set(uint8 Key, const FRepMovementQuantized& Movement)
+	{
+		FKeyedMovement* Keyed = const_cast<FKeyedMovement*>(Find(Key));
+		if (Keyed == NULL)
+		{
+			Keyed = &Movements[Movements.AddUninitialized()];
+			Keyed->Key = Key;
+		}
+		Keyed->Movement = Movement;
+	}
+
+	/** Sending side: number of updates made before this state */
+	uint32 Sequence;
+	/** Sending side: Sequence of the newest state, shared by all the states of the property. Ahead of Sequence if this state was restored. */
+	TSharedPtr<uint32> NewestSequence;
+	/** Sending side: the key of the next movement, the movement with the key before it is the one in Movements */
+	uint8 NextKey;
+	/** Sending side: whether LastSent is set */
+	bool bHasLastSent;
+	/** Sending side: the last movement sent, which didn't get a key if too many updates were in flight */
+	FRepMovementQuantized LastSent;
+	/** Movements with a key, at most one per key. The sending side only keeps the last one. */
+	TArray<FKeyedMovement, TInlineAllocator<1>> Movements;
+};
+
+/** Max bits per component of the location and velocity values and deltas, like FVector_NetQuantize100 */
+static const int32 RepMovementVectorBits = 30;
+/** Max bits per component of rotation deltas, which are wrapped to the range of a signed short */
+static const int32 RepMovementRotationDeltaBits = 15;
+
+static FRepMovementQuantized QuantizeRepMovement(const FRepMovement& Movement)
+{
+	FRepMovementQuantized Quantized;
+	Quantized.Location = QuantizePackedVector<100, RepMovementVectorBits>(Movement.Location);
+	Quantized.Rotation = FIntVector(FRotator::CompressAxisToShort(Movement.Rotation.Pitch), FRotator::CompressAxisToShort(Movement.Rotation.Yaw), FRotator::CompressAxisToShort(Movement.Rotation.Roll));
+	Quantized.LinearVelocity = QuantizePackedVector<100, RepMovementVectorBits>(Movement.LinearVelocity);
+	Quantized.AngularVelocity = Movement.bRepPhysics ? QuantizePackedVector<100, RepMovementVectorBits>(Movement.AngularVelocity) : FIntVector(0, 0, 0);
+	Quantized.Flags = (Movement.bSimulatedPhysicSleep << 0) | (Movement.bRepPhysics << 1);
+	return Quantized;
+}
+
+/**
+ * Writes a quantized vector, as a difference from Base if there is one.
+ * The format is [<changed bit> [<delta bit>]] <packed vector>, the bits are only written when there is a base.
+ */
+static void WriteRepMovementVector(FArchive& Ar, const FIntVector& Value, const FIntVector* Base, bool bRotation)
+{
+	if (Base)
+	{
+		uint8 bChanged = (Value != *Base);
+		Ar.SerializeBits(&bChanged, 1);
+		if (!bChanged)
+		{
+			return;
+		}
+
+		int64 DeltaX = (int64)Value.X - Base->X;
+		int64 DeltaY = (int64)Value.Y - Base->Y;
+		int64 DeltaZ = (int64)Value.Z - Base->Z;
+		if (bRotation)
+		{
+			// Take the short way around
+			DeltaX = (int16)(uint16)DeltaX;
+			DeltaY = (int16)(uint16)DeltaY;
+			DeltaZ = (int16)(uint16)DeltaZ;
+		}
+
+		uint8 bDelta = bRotation || CanWritePackedIntVector<RepMovementVectorBits>(DeltaX, DeltaY, DeltaZ);
+		Ar.SerializeBits(&bDelta, 1);
+		if (bDelta)
+		{
+			const FIntVector Delta((int32)DeltaX, (int32)DeltaY, (int32)DeltaZ);
+			if (bRotation)
+			{
+				WritePackedIntVector<RepMovementRotationDeltaBits>(Delta, Ar);
+			}
+			else
+			{
+				WritePackedIntVector<RepMovementVectorBits>(Delta, Ar);
+			}
+			return;
+		}
+	}
+
+	if (bRotation)
+	{
+		// Same as FRotator::SerializeCompressedShort
+		const int32 Axes[] = { Value.X, Value.Y, Value.Z };
+		for (int32 Axis = 0; Axis < ARRAY_COUNT(Axes); Axis++)
+		{
+			uint16 Short = (uint16)Axes[Axis];
+			uint8 B = (Short != 0);
+			Ar.SerializeBits(&B, 1);
+			if (B)
+			{
+				Ar << Short;
+			}
+		}
+	}
+	else
+	{
+		WritePackedIntVector<RepMovementVectorBits>(Value, Ar);
+	}
+}
+
+/** Reads a vector written by WriteRepMovementVector. Base is the value the delta is from, bHasBase whether there is one. */
+static void ReadRepMovementVector(FArchive& Ar, FIntVector& OutValue, const FIntVector& Base, bool bHasBase, bool bRotation)
+{
+	if (bHasBase)
+	{
+		uint8 bChanged = 0;
+		Ar.SerializeBits(&bChanged, 1);
+		if (!bChanged)
+		{
+			OutValue = Base;
+			return;
+		}
+
+		uint8 bDelta = 0;
+		Ar.SerializeBits(&bDelta, 1);
+		if (bDelta)
+		{
+			FIntVector Delta;
+			if (bRotation)
+			{
+				ReadPackedIntVector<RepMovementRotationDeltaBits>(Delta, Ar);
+				OutValue = FIntVector((Base.X + Delta.X) & 0xFFFF, (Base.Y + Delta.Y) & 0xFFFF, (Base.Z + Delta.Z) & 0xFFFF);
+			}
+			else
+			{
+				ReadPackedIntVector<RepMovementVectorBits>(Delta, Ar);
+				OutValue = FIntVector(Base.X + Delta.X, Base.Y + Delta.Y, Base.Z + Delta.Z);
+			}
+			return;
+		}
+	}
+
+	if (bRotation)
+	{
+		int32* Axes[] = { &OutValue.X, &OutValue.Y, &OutValue.Z };
+		for (int32 Axis = 0; Axis < ARRAY_COUNT(Axes); Axis++)
+		{
+			uint16 Short = 0;
+			uint8 B = 0;
+			Ar.SerializeBits(&B, 1);
+			if (B)
+			{
+				Ar << Short;
+			}
+			*Axes[Axis] = Short;
+		}
+	}
+	else
+	{
+		ReadPackedIntVector<RepMovementVectorBits>(OutValue, Ar);
+	}
+}
+
+bool FRepMovement::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+	if (DeltaParms.bUpdateUnmappedObjects)
+	{
+		// No object references
+		return true;
+	}
+
+	typedef FRepMovementDeltaState::FKeyedMovement FKeyedMovement;
+	const uint8 KeyMask = FRepMovementDeltaState::NumKeys - 1;
+
+	if (DeltaParms.Writer)
+	{
+		FRepMovementDeltaState* OldState = static_cast<FRepMovementDeltaState*>(DeltaParms.OldState);
+		FRepMovementDeltaState* AckedState = static_cast<FRepMovementDeltaState*>(DeltaParms.AckedState);
+
+		check(DeltaParms.NewState);
+		if (OldState == NULL)
+		{
+			// Initial state, the receiver doesn't have anything yet
+			FRepMovementDeltaState* InitialState = new FRepMovementDeltaState();
+			InitialState->NewestSequence = MakeShareable(new uint32(0));
+			*DeltaParms.NewState = MakeShareable(InitialState);
+			return false;
+		}
+
+		const FRepMovementQuantized Current = QuantizeRepMovement(*this);
+		const bool bRestored = *OldState->NewestSequence != OldState->Sequence;
+		if (!bRestored && OldState->bHasLastSent && OldState->LastSent == Current)
+		{
+			return false;
+		}
+
+		// The acked movement is the one with the key before the acked state's next key, if it had one
+		const uint8 AckedKey = ((AckedState ? AckedState->NextKey : 0) - 1) & KeyMask;
+		const FKeyedMovement* Base = AckedState && CVarNetRepMovementDelta.GetValueOnGameThread() != 0 ? AckedState->Find(AckedKey) : NULL;
+
+		// Don't hand out the acked key again while the receiver may need the acked movement
+		uint8 bKeyed = OldState->NextKey != AckedKey;
+		uint8 Key = OldState->NextKey;
+		uint8 bHasBase = Base != NULL;
+		uint8 BaseKey = AckedKey;
+		uint8 Flags = Current.Flags;
+
+		FBitWriter& Writer = *DeltaParms.Writer;
+		Writer.SerializeBits(&bKeyed, 1);
+		if (bKeyed)
+		{
+			Writer.SerializeBits(&Key, FRepMovementDeltaState::NumKeyBits);
+		}
+		Writer.SerializeBits(&bHasBase, 1);
+		if (bHasBase)
+		{
+			Writer.SerializeBits(&BaseKey, FRepMovementDeltaState::NumKeyBits);
+		}
+		Writer.SerializeBits(&Flags, 2);
+
+		WriteRepMovementVector(Writer, Current.Location, Base ? &Base->Movement.Location : NULL, false);
+		WriteRepMovementVector(Writer, Current.Rotation, Base ? &Base->Movement.Rotation : NULL, true);
+		WriteRepMovementVector(Writer, Current.LinearVelocity, Base ? &Base->Movement.LinearVelocity : NULL, false);
+		if (bRepPhysics)
+		{
+			WriteRepMovementVector(Writer, Current.AngularVelocity, Base ? &Base->Movement.AngularVelocity : NULL, false);
+		}
+
+		FRepMovementDeltaState* NewState = new FRepMovementDeltaState();
+		NewState->Sequence = OldState->Sequence + 1;
+		NewState->NewestSequence = OldState->NewestSequence;
+		*NewState->NewestSequence = NewState->Sequence;
+		NewState->bHasLastSent = true;
+		NewState->LastSent = Current;
+		if (bKeyed)
+		{
+			NewState->NextKey = (Key + 1) & KeyMask;
+			NewState->Set(Key, Current);
+		}
+		else
+		{
+			NewState->NextKey = OldState->NextKey;
+			NewState->Movements = OldState->Movements;
+		}
+		*DeltaParms.NewState = MakeShareable(NewState);
+
+		return true;
+	}
+
+	check(DeltaParms.Reader);
+	FBitReader& Reader = *DeltaParms.Reader;
+
+	FRepMovementDeltaState* State = static_cast<FRepMovementDeltaState*>(DeltaParms.OldState);
+	if (State == NULL)
+	{
+		check(DeltaParms.NewState);
+		State = new FRepMovementDeltaState();
+		*DeltaParms.NewState = MakeShareable(State);
+	}
+
+	uint8 bKeyed = 0;
+	uint8 Key = 0;
+	uint8 bHasBase = 0;
+	uint8 BaseKey = 0;
+	uint8 Flags = 0;
+	Reader.SerializeBits(&bKeyed, 1);
+	if (bKeyed)
+	{
+		Reader.SerializeBits(&Key, FRepMovementDeltaState::NumKeyBits);
+	}
+	Reader.SerializeBits(&bHasBase, 1);
+	if (bHasBase)
+	{
+		Reader.SerializeBits(&BaseKey, FRepMovementDeltaState::NumKeyBits);
+	}
+	Reader.SerializeBits(&Flags, 2);
+
+	const FKeyedMovement* Base = bHasBase ? State->Find(BaseKey) : NULL;
+	const FRepMovementQuantized BaseMovement = Base ? Base->Movement : FRepMovementQuantized();
+
+	FRepMovementQuantized Received;
+	Received.Flags = Flags;
+	ReadRepMovementVector(Reader, Received.Location, BaseMovement.Location, bHasBase != 0, false);
+	ReadRepMovementVector(Reader, Received.Rotation, BaseMovement.Rotation, bHasBase != 0, true);
+	ReadRepMovementVector(Reader, Received.LinearVelocity, BaseMovement.LinearVelocity, bHasBase != 0, false);
+	if (Flags & (1 << 1))
+	{
+		ReadRepMovementVector(Reader, Received.AngularVelocity, BaseMovement.AngularVelocity, bHasBase != 0, false);
+	}
+	else
+	{
+		Received.AngularVelocity = FIntVector(0, 0, 0);
+	}
+
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	if (bHasBase && Base == NULL)
+	{
+		// Shouldn't happen, see FRepMovementDeltaState. Keep the current movement until a full one arrives.
+		UE_LOG(LogNet, Warning, TEXT("FRepMovement::NetDeltaSerialize: Missing base movement %d"), BaseKey);
+		return true;
+	}
+
+	if (bKeyed)
+	{
+		State->Set(Key, Received);
+	}
+
+	bSimulatedPhysicSleep = (Flags & (1 << 0)) ? 1 : 0;
+	bRepPhysics = (Flags & (1 << 1)) ? 1 : 0;
+	Location = DequantizePackedVector<100>(Received.Location);
+	Rotation = FRotator(FRotator::DecompressAxisFromShort(Received.Rotation.X), FRotator::DecompressAxisFromShort(Received.Rotation.Y), FRotator::DecompressAxisFromShort(Received.Rotation.Z));
+	LinearVelocity = DequantizePackedVector<100>(Received.LinearVelocity);
+	if (bRepPhysics)
+	{
+		AngularVelocity = DequantizePackedVector<100>(Received.AngularVelocity);
+	}
+
+	return true;
+}
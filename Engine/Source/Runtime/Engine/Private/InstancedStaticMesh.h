@@ -523,6 +523,12 @@ public:
 
 	virtual int32 GetNumMeshBatches() const override;
 
+	/** The occluder mesh is in the space of a single instance, so instanced meshes are never used as software occluders. */
+	virtual const FOccluderMeshData* GetOccluderMeshData() const override
+	{
+		return NULL;
+	}
+
 	/** Sets up a shadow FMeshBatch for a specific LOD. */
 	virtual bool GetShadowMeshElement(int32 LODIndex, int32 BatchIndex, uint8 InDepthPriorityGroup, FMeshBatch& OutMeshBatch) const override;
 
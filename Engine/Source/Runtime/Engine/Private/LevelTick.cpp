@@ -696,6 +696,18 @@ void UWorld::RunTickGroup(ETickingGroup Group, bool bBlockTillComplete = true)
 	TickGroup = ETickingGroup(TickGroup + 1); // new actors go into the next tick group because this one is already gone
 }
 
+static TAutoConsoleVariable<int32> CVarIncrementalReachability(
+	TEXT("gc.IncrementalReachability"),
+	0,
+	TEXT("If non-zero, periodic garbage collection marks reachable objects over several frames instead of in one stop-the-world pass.\n")
+	TEXT("The last frame of a pass still traces every reachable object again in parallel, since native stores bypass the write\n")
+	TEXT("barrier, so this spreads the flagging work but keeps the hitch of a parallel mark. Experimental, default 0."));
+
+static TAutoConsoleVariable<float> CVarIncrementalReachabilityTimeLimit(
+	TEXT("gc.IncrementalReachabilityTimeLimit"),
+	0.002f,
+	TEXT("Time budget in seconds per frame for incremental reachability analysis."));
+
 static TAutoConsoleVariable<int32> CVarAllowAsyncRenderThreadUpdates(
 	TEXT("AllowAsyncRenderThreadUpdates"),
 	0,
@@ -1299,6 +1311,12 @@ void UWorld::Tick( ELevelTick TickType, float DeltaSeconds )
 		{
 			bShouldDelayGarbageCollect = false;
 		}
+		// Keep marking if an incremental reachability pass is in progress.
+		else if( IsIncrementalReachabilityAnalysisPending() )
+		{
+			SCOPE_CYCLE_COUNTER(STAT_GCMarkTime);
+			PerformGarbageCollectionAndCleanupActors();
+		}
 		// Perform incremental purge update if it's pending or in progress.
 		else if( !IsIncrementalPurgePending() 
 		// Purge reference to pending kill objects every now and so often.
@@ -1387,7 +1405,18 @@ void UWorld::PerformGarbageCollectionAndCleanupActors()
 	if( !IsAsyncLoading() )
 	{
 		// Perform housekeeping.
-		CollectGarbage( GARBAGE_COLLECTION_KEEPFLAGS, false );
+		if( IsIncrementalReachabilityAnalysisPending() || CVarIncrementalReachability.GetValueOnGameThread() != 0 )
+		{
+			// Only clean up once the pass has finished and unreachable actors are actually going away.
+			if( !IncrementalCollectGarbage( GARBAGE_COLLECTION_KEEPFLAGS, true, CVarIncrementalReachabilityTimeLimit.GetValueOnGameThread() ) )
+			{
+				return;
+			}
+		}
+		else
+		{
+			CollectGarbage( GARBAGE_COLLECTION_KEEPFLAGS, false );
+		}
 
 		CleanupActors();
 
@@ -0,0 +1,167 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NetActorSchedule.cpp: Replication schedule of a net driver's network actors.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Net/NetActorSchedule.h"
+
+FNetActorSchedule::FNetActorSchedule()
+	: NextQueueSerial(0)
+	, NumParkedActors(0)
+{
+}
+
+void FNetActorSchedule::AddActor(AActor* Actor, float UpdateTime)
+{
+	FActorEntry* Entry = Actors.Find(Actor);
+	if (Entry && !Entry->Actor.IsValid())
+	{
+		// A collected actor that was never removed, and a new one at the same address.
+		RemoveActor(Actor);
+		Entry = NULL;
+	}
+
+	if (Entry == NULL)
+	{
+		Entry = &Actors.Add(Actor);
+		Entry->Actor = Actor;
+		Enqueue(Actor, *Entry, UpdateTime);
+	}
+	else if (Entry->State == EActorState::Parked)
+	{
+		NumParkedActors--;
+		Enqueue(Actor, *Entry, UpdateTime);
+	}
+	else if (Entry->State == EActorState::Queued && UpdateTime < Entry->UpdateTime)
+	{
+		Enqueue(Actor, *Entry, UpdateTime);
+	}
+}
+
+void FNetActorSchedule::UpdateActor(AActor* Actor, float UpdateTime)
+{
+	FActorEntry* Entry = Actors.Find(Actor);
+	if (Entry && Entry->State == EActorState::Queued && UpdateTime < Entry->UpdateTime)
+	{
+		Enqueue(Actor, *Entry, UpdateTime);
+	}
+}
+
+void FNetActorSchedule::RemoveActor(AActor* Actor)
+{
+	const FActorEntry* Entry = Actors.Find(Actor);
+	if (Entry)
+	{
+		if (Entry->State == EActorState::Parked)
+		{
+			NumParkedActors--;
+		}
+		// Its queue entry, if any, is skipped when it comes up.
+		Actors.Remove(Actor);
+	}
+}
+
+void FNetActorSchedule::PopDueActors(float Time, TArray<AActor*>& OutActors)
+{
+	while (Queue.Num() > 0 && Queue.HeapTop().UpdateTime <= Time)
+	{
+		FQueuedActor Queued;
+		Queue.HeapPop(Queued);
+
+		FActorEntry* Entry = Actors.Find(Queued.Actor);
+		if (Entry == NULL || Entry->State != EActorState::Queued || Entry->QueueSerial != Queued.QueueSerial)
+		{
+			continue;
+		}
+		if (!Entry->Actor.IsValid())
+		{
+			Actors.Remove(Queued.Actor);
+			continue;
+		}
+
+		Entry->State = EActorState::Popped;
+		OutActors.Add(Queued.Actor);
+	}
+
+	CompactQueue();
+}
+
+void FNetActorSchedule::RescheduleActor(AActor* Actor, float UpdateTime)
+{
+	FActorEntry* Entry = Actors.Find(Actor);
+	if (Entry && Entry->State == EActorState::Popped)
+	{
+		Enqueue(Actor, *Entry, UpdateTime);
+	}
+}
+
+void FNetActorSchedule::ParkActor(AActor* Actor)
+{
+	FActorEntry* Entry = Actors.Find(Actor);
+	if (Entry && Entry->State == EActorState::Popped)
+	{
+		Entry->State = EActorState::Parked;
+		NumParkedActors++;
+	}
+}
+
+void FNetActorSchedule::WakeActor(AActor* Actor, float UpdateTime)
+{
+	FActorEntry* Entry = Actors.Find(Actor);
+	if (Entry && Entry->State == EActorState::Parked)
+	{
+		NumParkedActors--;
+		Enqueue(Actor, *Entry, UpdateTime);
+	}
+}
+
+void FNetActorSchedule::WakeAllActors(float UpdateTime)
+{
+	if (NumParkedActors == 0)
+	{
+		return;
+	}
+
+	for (auto It = Actors.CreateIterator(); It; ++It)
+	{
+		if (It.Value().State == EActorState::Parked)
+		{
+			Enqueue(It.Key(), It.Value(), UpdateTime);
+		}
+	}
+	NumParkedActors = 0;
+}
+
+void FNetActorSchedule::Enqueue(AActor* Actor, FActorEntry& Entry, float UpdateTime)
+{
+	Entry.State = EActorState::Queued;
+	Entry.UpdateTime = UpdateTime;
+	Entry.QueueSerial = NextQueueSerial++;
+
+	FQueuedActor Queued;
+	Queued.UpdateTime = UpdateTime;
+	Queued.QueueSerial = Entry.QueueSerial;
+	Queued.Actor = Actor;
+	Queue.HeapPush(Queued);
+}
+
+void FNetActorSchedule::CompactQueue()
+{
+	// Every actor has at most one current entry, so past this size most entries are stale.
+	if (Queue.Num() <= 2 * Actors.Num() + 64)
+	{
+		return;
+	}
+
+	for (int32 Index = Queue.Num() - 1; Index >= 0; Index--)
+	{
+		const FActorEntry* Entry = Actors.Find(Queue[Index].Actor);
+		if (Entry == NULL || Entry->State != EActorState::Queued || Entry->QueueSerial != Queue[Index].QueueSerial)
+		{
+			Queue.RemoveAtSwap(Index, 1, false);
+		}
+	}
+	Queue.Heapify();
+}
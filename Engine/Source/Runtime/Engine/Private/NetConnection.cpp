@@ -21,6 +21,13 @@
 	UNetConnection implementation.
 -----------------------------------------------------------------------------*/
 
+static TAutoConsoleVariable<int32> CVarNetOutBunchPoolSize(
+	TEXT("net.OutBunchPoolSize"),
+	64,
+	TEXT("Number of sent bunches each connection keeps to reuse for the next ones, instead of allocating a bunch and its buffer every time.\n")
+	TEXT("0 allocates every bunch."),
+	ECVF_Default);
+
 UNetConnection* UNetConnection::GNetConnectionBeingCleanedUp = NULL;
 
 UNetConnection::UNetConnection(const FObjectInitializer& ObjectInitializer)
@@ -35,6 +42,7 @@ UNetConnection::UNetConnection(const FObjectInitializer& ObjectInitializer)
 ,	PacketOverhead		( 0 )
 ,	ResponseId			( 0 )
 
+,	PacketReceiveTime	( 0.0 )
 ,	QueuedBytes			( 0 )
 ,	TickCount			( 0 )
 ,	ConnectTime			( 0.0 )
@@ -301,6 +309,12 @@ void UNetConnection::CleanUp()
 
 	CleanupDormantActorState();
 
+	for ( FOutBunch* FreeBunch : FreeOutBunches )
+	{
+		delete FreeBunch;
+	}
+	FreeOutBunches.Empty();
+
 	Driver = NULL;
 }
 
@@ -570,6 +584,7 @@ void UNetConnection::FlushNet(bool bIgnoreSimulation)
 		const int32 Index = OutPacketId & (ARRAY_COUNT(OutLagPacketId)-1);
 		OutLagPacketId [Index] = OutPacketId;
 		OutLagTime     [Index] = Driver->Time;
+		OutLagRealTime [Index] = FPlatformTime::Seconds();
 		OutPacketId++;
 		Driver->OutPackets++;
 		LastSendTime = Driver->Time;
@@ -749,7 +764,11 @@ void UNetConnection::ReceivedPacket( FBitReader& Reader )
 			int32 Index = AckPacketId & (ARRAY_COUNT(OutLagPacketId)-1);
 			if( OutLagPacketId[Index]==AckPacketId )
 			{
-				float NewLag = Driver->Time - OutLagTime[Index] - (FrameTime/2.f);
+				// When the driver timestamps packets as they arrive, measure the lag from those times,
+				// otherwise assume the ack arrived in the middle of the last frame.
+				float NewLag = PacketReceiveTime > 0.0
+					? PacketReceiveTime - OutLagRealTime[Index]
+					: Driver->Time - OutLagTime[Index] - (FrameTime/2.f);
 
 				LagAcc += NewLag;
 				LagCount++;
@@ -1154,6 +1173,56 @@ void UNetConnection::SendAck( int32 AckPacketId, bool FirstTime/*=1*/, bool bHav
 }
 
 
+FOutBunch* UNetConnection::AllocOutBunch( UChannel* Channel, bool bClose )
+{
+	if ( FreeOutBunches.Num() > 0 )
+	{
+		INC_DWORD_STAT( STAT_NetOutBunchAllocsAvoided );
+		FOutBunch* Bunch = FreeOutBunches.Pop( false );
+		Bunch->Reinit( Channel, bClose );
+		return Bunch;
+	}
+	return new FOutBunch( Channel, bClose );
+}
+
+FOutBunch* UNetConnection::AllocOutBunch( int64 MaxBits )
+{
+	if ( FreeOutBunches.Num() > 0 )
+	{
+		INC_DWORD_STAT( STAT_NetOutBunchAllocsAvoided );
+		FOutBunch* Bunch = FreeOutBunches.Pop( false );
+		Bunch->Reinit( PackageMap, MaxBits );
+		return Bunch;
+	}
+	return new FOutBunch( PackageMap, MaxBits );
+}
+
+FOutBunch* UNetConnection::AllocOutBunch( const FOutBunch& Source )
+{
+	if ( FreeOutBunches.Num() > 0 )
+	{
+		INC_DWORD_STAT( STAT_NetOutBunchAllocsAvoided );
+		FOutBunch* Bunch = FreeOutBunches.Pop( false );
+		*Bunch = Source;
+		return Bunch;
+	}
+	return new FOutBunch( Source );
+}
+
+void UNetConnection::FreeOutBunch( FOutBunch* Bunch )
+{
+	// Reinit keeps the buffer allocation, so only bunches that fit in a packet are kept. Large partial or initial bunches are deleted.
+	const bool bFitsInPacket = Bunch->GetBuffer()->Max() <= MaxPacket;
+	if ( Driver != NULL && bFitsInPacket && FreeOutBunches.Num() < CVarNetOutBunchPoolSize.GetValueOnGameThread() )
+	{
+		FreeOutBunches.Add( Bunch );
+	}
+	else
+	{
+		delete Bunch;
+	}
+}
+
 int32 UNetConnection::SendRawBunch( FOutBunch& Bunch, bool InAllowMerge )
 {
 	ValidateSendBuffer();
@@ -1163,7 +1232,8 @@ int32 UNetConnection::SendRawBunch( FOutBunch& Bunch, bool InAllowMerge )
 	TimeSensitive = 1;
 
 	// Build header.
-	FBitWriter Header( MAX_BUNCH_HEADER_BITS );
+	FBitWriter& Header = SendBunchHeader;
+	Header.Reinit( MAX_BUNCH_HEADER_BITS );
 	Header.WriteBit( 0 );
 	Header.WriteBit( Bunch.bOpen || Bunch.bClose );
 	if( Bunch.bOpen || Bunch.bClose )
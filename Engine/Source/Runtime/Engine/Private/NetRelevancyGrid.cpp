@@ -0,0 +1,187 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NetRelevancyGrid.cpp: Spatial hash of replicated actors for relevancy checks.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Net/NetRelevancyGrid.h"
+
+/** Number of replication frames after which actors that weren't considered are dropped, and how often that is checked. */
+static const uint32 NetRelevancyGridPruneFrames = 256;
+
+FNetRelevancyGrid::FNetRelevancyGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 100.0f))
+	, InvCellSize(1.0f / CellSize)
+	, MaxCullDistance(0.0f)
+	, Frame(0)
+	, LastPruneFrame(0)
+	, GatherTag(0)
+{
+}
+
+void FNetRelevancyGrid::BeginFrame(uint32 InFrame)
+{
+	Frame = InFrame;
+	if (Frame - LastPruneFrame >= NetRelevancyGridPruneFrames)
+	{
+		Prune();
+		LastPruneFrame = Frame;
+	}
+}
+
+void FNetRelevancyGrid::UpdateActor(AActor* Actor)
+{
+	const FVector Location = Actor->GetActorLocation();
+	const FIntPoint Cell = GetCell(Location);
+	MaxCullDistance = FMath::Max(MaxCullDistance, FMath::Sqrt(Actor->NetCullDistanceSquared));
+
+	FActorCell* ActorCell = ActorCells.Find(Actor);
+	if (ActorCell && ActorCell->Cell != Cell)
+	{
+		const FActorCell Removed = *ActorCell;
+		ActorCells.Remove(Actor);
+		RemoveFromCell(Removed.Cell, Removed.Index);
+		ActorCell = NULL;
+	}
+
+	FCellEntry* Entry;
+	if (ActorCell)
+	{
+		Entry = &Cells.FindChecked(Cell)[ActorCell->Index];
+	}
+	else
+	{
+		TArray<FCellEntry>& CellEntries = Cells.FindOrAdd(Cell);
+		FActorCell& NewActorCell = ActorCells.Add(Actor);
+		NewActorCell.Cell = Cell;
+		NewActorCell.Index = CellEntries.AddUninitialized();
+		Entry = &CellEntries[NewActorCell.Index];
+		Entry->Actor = Actor;
+		Entry->GatherTag = 0;
+	}
+	Entry->Location = Location;
+	Entry->CullDistanceSquared = Actor->NetCullDistanceSquared;
+	Entry->Frame = Frame;
+}
+
+void FNetRelevancyGrid::RemoveActor(AActor* Actor)
+{
+	const FActorCell* ActorCell = ActorCells.Find(Actor);
+	if (ActorCell)
+	{
+		const FActorCell Removed = *ActorCell;
+		ActorCells.Remove(Actor);
+		RemoveFromCell(Removed.Cell, Removed.Index);
+	}
+}
+
+void FNetRelevancyGrid::RemoveFromCell(const FIntPoint& Cell, int32 Index)
+{
+	TArray<FCellEntry>& CellEntries = Cells.FindChecked(Cell);
+	CellEntries.RemoveAtSwap(Index, 1, false);
+	if (Index < CellEntries.Num())
+	{
+		ActorCells.FindChecked(CellEntries[Index].Actor).Index = Index;
+	}
+	else if (CellEntries.Num() == 0)
+	{
+		Cells.Remove(Cell);
+	}
+}
+
+void FNetRelevancyGrid::BeginGather()
+{
+	GatherTag++;
+}
+
+void FNetRelevancyGrid::GatherRelevantActors(const FVector& ViewLocation, TArray<AActor*>& OutActors)
+{
+	const FIntPoint MinCell = GetCell(ViewLocation - FVector(MaxCullDistance, MaxCullDistance, 0.0f));
+	const FIntPoint MaxCell = GetCell(ViewLocation + FVector(MaxCullDistance, MaxCullDistance, 0.0f));
+
+	auto GatherCell = [&](TArray<FCellEntry>& CellEntries)
+	{
+		for (FCellEntry& Entry : CellEntries)
+		{
+			// Same test as AActor::IsNetRelevantFor.
+			if (Entry.Frame == Frame && Entry.GatherTag != GatherTag && (ViewLocation - Entry.Location).SizeSquared() < Entry.CullDistanceSquared)
+			{
+				Entry.GatherTag = GatherTag;
+				OutActors.Add(Entry.Actor);
+			}
+		}
+	};
+
+	// Visit whichever is fewer, the cells in range or the non-empty cells.
+	const int64 NumCellsInRange = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+	if (NumCellsInRange > Cells.Num())
+	{
+		for (auto It = Cells.CreateIterator(); It; ++It)
+		{
+			const FIntPoint& Cell = It.Key();
+			if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X && Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y)
+			{
+				GatherCell(It.Value());
+			}
+		}
+	}
+	else
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+			{
+				TArray<FCellEntry>* CellEntries = Cells.Find(FIntPoint(X, Y));
+				if (CellEntries)
+				{
+					GatherCell(*CellEntries);
+				}
+			}
+		}
+	}
+}
+
+void FNetRelevancyGrid::GatherActor(AActor* Actor, TArray<AActor*>& OutActors)
+{
+	const FActorCell* ActorCell = ActorCells.Find(Actor);
+	if (ActorCell)
+	{
+		FCellEntry& Entry = Cells.FindChecked(ActorCell->Cell)[ActorCell->Index];
+		if (Entry.Frame == Frame && Entry.GatherTag != GatherTag)
+		{
+			Entry.GatherTag = GatherTag;
+			OutActors.Add(Entry.Actor);
+		}
+	}
+}
+
+void FNetRelevancyGrid::Prune()
+{
+	MaxCullDistance = 0.0f;
+	for (auto CellIt = Cells.CreateIterator(); CellIt; ++CellIt)
+	{
+		TArray<FCellEntry>& CellEntries = CellIt.Value();
+		for (int32 Index = CellEntries.Num() - 1; Index >= 0; Index--)
+		{
+			if (Frame - CellEntries[Index].Frame >= NetRelevancyGridPruneFrames)
+			{
+				// The actor may be gone, only use it as a key.
+				ActorCells.Remove(CellEntries[Index].Actor);
+				CellEntries.RemoveAtSwap(Index, 1, false);
+				if (Index < CellEntries.Num())
+				{
+					ActorCells.FindChecked(CellEntries[Index].Actor).Index = Index;
+				}
+			}
+			else
+			{
+				MaxCullDistance = FMath::Max(MaxCullDistance, FMath::Sqrt(CellEntries[Index].CullDistanceSquared));
+			}
+		}
+		if (CellEntries.Num() == 0)
+		{
+			CellIt.RemoveCurrent();
+		}
+	}
+}
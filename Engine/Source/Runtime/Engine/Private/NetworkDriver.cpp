@@ -9,6 +9,9 @@
 #include "Net/UnrealNetwork.h"
 #include "Net/NetworkProfiler.h"
 #include "Net/RepLayout.h"
+#include "Net/NetRelevancyGrid.h"
+#include "Net/NetActorSchedule.h"
+#include "ParallelFor.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/VoiceChannel.h"
 #include "GameFramework/GameNetworkManager.h"
@@ -35,6 +38,7 @@ DEFINE_STAT(STAT_OutBunches);
 DEFINE_STAT(STAT_OutLoss);
 DEFINE_STAT(STAT_InLoss);
 DEFINE_STAT(STAT_NumConsideredActors);
+DEFINE_STAT(STAT_NumGridGatheredActors);
 DEFINE_STAT(STAT_PrioritizedActors);
 DEFINE_STAT(STAT_NumRelevantActors);
 DEFINE_STAT(STAT_NumRelevantDeletedActors);
@@ -43,6 +47,8 @@ DEFINE_STAT(STAT_NumReplicatedActors);
 DEFINE_STAT(STAT_NumActorChannels);
 DEFINE_STAT(STAT_NumActors);
 DEFINE_STAT(STAT_NumNetActors);
+DEFINE_STAT(STAT_NumParkedNetActors);
+DEFINE_STAT(STAT_NetOutBunchAllocsAvoided);
 DEFINE_STAT(STAT_NumDormantActors);
 DEFINE_STAT(STAT_NumInitiallyDormantActors);
 DEFINE_STAT(STAT_NumActorChannelsReadyDormant);
@@ -97,6 +103,33 @@ static TAutoConsoleVariable<int32> CVarNetDormancyValidate(
 	TEXT("0: Dont validate. 1: Validate on wake up. 2: Validate on each net update"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarNetRelevancyGrid(
+	TEXT("net.RelevancyGrid"),
+	0,
+	TEXT("Only tests connections against the actors close to their viewers, plus the actors whose relevancy isn't based on distance\n")
+	TEXT("(see AActor::IsNetRelevancySpatial). 1 Enables the grid. 0 tests every connection against every considered actor."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarNetRelevancyGridCellSize(
+	TEXT("net.RelevancyGridCellSize"),
+	10000.f,
+	TEXT("Size of the cells of net.RelevancyGrid in world units, best close to the common NetCullDistance."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarNetActorSchedule(
+	TEXT("net.ActorSchedule"),
+	0,
+	TEXT("Keeps the network actors ordered by their next update time, so that only the actors that are due are looked at, and parks the actors\n")
+	TEXT("that are dormant on every connection until their dormancy is flushed. 1 Enables the schedule. 0 checks every network actor every frame."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarNetParallelPrioritization(
+	TEXT("net.ParallelPrioritization"),
+	0,
+	TEXT("Prioritizes the actors to replicate to different connections on task graph worker threads. Replicating them stays on the game thread.\n")
+	TEXT("Requires IsNetRelevantFor, GetNetPriority and GetNetDormancy to only read state. 1 Enables parallel prioritization. 0 prioritizes one connection after another."),
+	ECVF_Default);
+
 /*-----------------------------------------------------------------------------
 	UNetDriver implementation.
 -----------------------------------------------------------------------------*/
@@ -812,7 +845,8 @@ void UNetDriver::InternalProcessRemoteFunction
 	}
 
 	// Form the RPC preamble.
-	FOutBunch Bunch( Ch, 0 );
+	FScopedOutBunch PooledBunch( Ch, 0 );
+	FOutBunch& Bunch = *PooledBunch;
 
 	// Reliability.
 	//warning: RPC's might overflow, preventing reliable functions from getting thorough.
@@ -1456,6 +1490,14 @@ void UNetDriver::NotifyActorDestroyed( AActor* ThisActor, bool IsSeamlessTravel
 {
 	// Remove the actor from the property tracker map
 	RepChangedPropertyTrackerMap.Remove(ThisActor);
+	if (RelevancyGrid.IsValid())
+	{
+		RelevancyGrid->RemoveActor(ThisActor);
+	}
+	if (ActorSchedule.IsValid())
+	{
+		ActorSchedule->RemoveActor(ThisActor);
+	}
 #if WITH_SERVER_CODE
 
 	FActorDestructionInfo* DestructionInfo = NULL;
@@ -1591,6 +1633,11 @@ void UNetDriver::FlushActorDormancy(AActor* Actor)
 	check(Actor);
 	check(ServerConnection == NULL);
 
+	if (ActorSchedule.IsValid())
+	{
+		ActorSchedule->WakeActor(Actor, Actor->NetUpdateTime);
+	}
+
 	// Go through each connection and remove the actor from the dormancy list
 	for (int32 i=0; i < ClientConnections.Num(); ++i)
 	{
@@ -1603,6 +1650,30 @@ void UNetDriver::FlushActorDormancy(AActor* Actor)
 #endif // WITH_SERVER_CODE
 }
 
+void UNetDriver::NotifyNetworkActorAdded(AActor* Actor)
+{
+	if (ActorSchedule.IsValid() && Actor->NetDriverName == NetDriverName)
+	{
+		ActorSchedule->AddActor(Actor, Actor->NetUpdateTime);
+	}
+}
+
+void UNetDriver::NotifyNetworkActorRemoved(AActor* Actor)
+{
+	if (ActorSchedule.IsValid())
+	{
+		ActorSchedule->RemoveActor(Actor);
+	}
+}
+
+void UNetDriver::NotifyActorNetUpdateTimeLowered(AActor* Actor, float UpdateTime)
+{
+	if (ActorSchedule.IsValid())
+	{
+		ActorSchedule->UpdateActor(Actor, UpdateTime);
+	}
+}
+
 UChildConnection* UNetDriver::CreateChild(UNetConnection* Parent)
 {
 	UE_LOG(LogNet, Log, TEXT("Creating child connection with %s parent"), *Parent->GetName());
@@ -1833,6 +1904,225 @@ FActorPriority::FActorPriority(class UNetConnection* InConnection, struct FActor
 	}
 }
 
+/** What UNetDriver::ServerReplicateActors does with a network actor after looking at it. */
+namespace ENetworkActorConsideration
+{
+	enum Type
+	{
+		/** Due for an update, it was added to the consider lists. */
+		Due,
+		/** Not due for an update yet. */
+		NotDue,
+		/** Can't be replicated right now, look at it again next frame. */
+		Defer,
+		/** Replicated by a different net driver. */
+		Ignore,
+		/** Remove it from the network actors. */
+		Remove,
+	};
+}
+
+/** What UNetDriver::PrioritizeActorsForConnection needs to know about a connection, and the actors it prioritized for it. */
+struct FConnectionReplicationPriorities
+{
+	UNetConnection* Connection;
+	/** Viewers of the connection and its children. */
+	TArray<FNetViewer> Viewers;
+	/** Actors to consider for the connection, either every considered actor or GridConsiderList. */
+	const TArray<AActor*>* ConsiderList;
+	/** Actors gathered from the relevancy grid for the connection. */
+	TArray<AActor*> GridConsiderList;
+	/** Whether the connection's bandwidth is low, which lowers the priority of actors that aren't in view. */
+	bool bLowNetBandwidth;
+	/** net.DormancyEnable, read on the game thread. */
+	bool bDormancyEnabled;
+	/** Whether net.DormancyValidate validates dormant actors on every net update, read on the game thread. */
+	bool bValidateDormantActors;
+	/** Relevant actors and destroyed actors to replicate, highest priority first. */
+	TArray<FActorPriority> PriorityList;
+	/** Number of destroyed actors in PriorityList. */
+	int32 DeletedCount;
+
+	FConnectionReplicationPriorities(UNetConnection* InConnection)
+		: Connection(InConnection)
+		, ConsiderList(NULL)
+		, bLowNetBandwidth(false)
+		, bDormancyEnabled(false)
+		, bValidateDormantActors(false)
+		, DeletedCount(0)
+	{
+	}
+};
+
+bool UNetDriver::IsActorDormantOnAllConnections(const AActor* Actor) const
+{
+	for (UNetConnection* Connection : ClientConnections)
+	{
+		if (!Connection->DormantActors.Contains(Actor))
+		{
+			return false;
+		}
+	}
+	return ClientConnections.Num() > 0;
+}
+
+void UNetDriver::PrioritizeActorsForConnection(FConnectionReplicationPriorities& Priorities)
+{
+	SCOPE_CYCLE_COUNTER(STAT_NetPrioritizeActorsTime);
+
+	UNetConnection* Connection = Priorities.Connection;
+	const TArray<FNetViewer>& ConnectionViewers = Priorities.Viewers;
+	const bool bLowNetBandwidth = Priorities.bLowNetBandwidth;
+	TArray<FActorPriority>& PriorityList = Priorities.PriorityList;
+
+	PriorityList.Reserve(Priorities.ConsiderList->Num() + Connection->DestroyedStartupOrDormantActors.Num() + Connection->OwnedConsiderList.Num());
+
+	for( AActor* Actor : *Priorities.ConsiderList )
+	{
+		UActorChannel* Channel = Connection->ActorChannels.FindRef(Actor);
+
+		// Skip Actor if dormant
+		if ( Priorities.bDormancyEnabled )
+		{
+			// If actor is already dormant on this channel, then skip replication entirely
+			if ( Connection->DormantActors.Contains( Actor ) )
+			{
+				// net.DormancyValidate can be set to 2 to validate dormant actor properties on every replicate
+				// (this could be moved to be done every tick instead of every net update if necessary, but seems excessive)
+				if ( Priorities.bValidateDormantActors )
+				{
+					TSharedRef< FObjectReplicator > * Replicator = Connection->DormantReplicatorMap.Find( Actor );
+
+					if ( Replicator != NULL )
+					{
+						Replicator->Get().ValidateAgainstState( Actor );
+					}
+				}
+
+				continue;
+			}
+
+			// If actor might need to go dormant on this channel, then check
+			if (Actor->NetDormancy > DORM_Awake && Channel && !Channel->bPendingDormancy && !Channel->Dormant )
+			{
+				bool ShouldGoDormant = true;
+				if (Actor->NetDormancy == DORM_DormantPartial)
+				{
+					for (int32 viewerIdx = 0; viewerIdx < ConnectionViewers.Num(); viewerIdx++)
+					{
+						if (!Actor->GetNetDormancy(ConnectionViewers[viewerIdx].ViewLocation, ConnectionViewers[viewerIdx].ViewDir, ConnectionViewers[viewerIdx].InViewer, ConnectionViewers[viewerIdx].ViewTarget, Channel, Time, bLowNetBandwidth))
+						{
+							ShouldGoDormant = false;
+							break;
+						}
+					}
+				}
+
+				if (ShouldGoDormant)
+				{
+					// Channel is marked to go dormant now once all properties have been replicated (but is not dormant yet)
+					Channel->StartBecomingDormant();
+				}
+			}
+		}
+
+
+		// Skip actor if not relevant and theres no channel already.
+		// Historically Relevancy checks were deferred until after prioritization because they were expensive (line traces).
+		// Relevancy is now cheap and we are dealing with larger lists of considered actors, so we want to keep the list of
+		// prioritized actors low.
+		if (!Channel)
+		{
+			if ( !IsLevelInitializedForActor(Actor, Connection) )
+			{
+				// If the level this actor belongs to isn't loaded on client, don't bother sending
+				continue;
+			}
+			bool Relevant = false;
+			for (int32 viewerIdx = 0; viewerIdx < ConnectionViewers.Num(); viewerIdx++)
+			{
+				if(Actor->IsNetRelevantFor(ConnectionViewers[viewerIdx].InViewer, ConnectionViewers[viewerIdx].ViewTarget, ConnectionViewers[viewerIdx].ViewLocation))
+				{
+					Relevant = true;
+					break;
+				}
+			}
+			if (!Relevant)
+			{
+				continue;
+			}
+		}
+
+		// Skip temporary actors that were already sent to this connection
+		if ( Actor->bNetTemporary && Connection->SentTemporaries.Contains(Actor) )
+		{
+			continue;
+		}
+
+		UE_LOG(LogNetTraffic, Log, TEXT("Consider %s alwaysrelevant %d frequency %f "),*Actor->GetName(), Actor->bAlwaysRelevant, Actor->NetUpdateFrequency);
+		new(PriorityList) FActorPriority(Connection, Channel, Actor, ConnectionViewers, bLowNetBandwidth);
+
+		if (DebugRelevantActors)
+		{
+			LastPrioritizedActors.Add(Actor);
+		}
+	}
+
+	// Add in deleted actors
+	for (auto It = Connection->DestroyedStartupOrDormantActors.CreateIterator(); It; ++It)
+	{
+		FActorDestructionInfo &DInfo = DestroyedStartupOrDormantActors.FindChecked(*It);
+		new(PriorityList) FActorPriority(Connection, &DInfo, ConnectionViewers);
+		Priorities.DeletedCount++;
+	}
+
+	// The owned lists are disjoint from the consider list, but with child connections an actor can be owned by more than one of them
+	TSet<AActor*> OwnedActors;
+	UNetConnection* NextConnection = Connection;
+	int32 ChildIndex = 0;
+	while (NextConnection != NULL)
+	{
+		for (AActor* Actor : NextConnection->OwnedConsiderList)
+		{
+			UE_LOG(LogNetTraffic, Log, TEXT("Consider owned %s always relevant %d frequency %f  "),*Actor->GetName(), Actor->bAlwaysRelevant,Actor->NetUpdateFrequency);
+			if ( Actor->bNetTemporary && Connection->SentTemporaries.Contains(Actor) )
+			{
+				continue;
+			}
+			if ( Connection->Children.Num() > 0 )
+			{
+				bool bAlreadyAdded = false;
+				OwnedActors.Add(Actor, &bAlreadyAdded);
+				if (bAlreadyAdded)
+				{
+					continue;
+				}
+			}
+
+			UActorChannel* Channel = Connection->ActorChannels.FindRef(Actor);
+			new(PriorityList) FActorPriority(NextConnection, Channel, Actor, ConnectionViewers, bLowNetBandwidth);
+
+			if (DebugRelevantActors)
+			{
+				LastPrioritizedActors.Add(Actor);
+			}
+		}
+		NextConnection->OwnedConsiderList.Empty();
+
+		NextConnection = (ChildIndex < Connection->Children.Num()) ? Connection->Children[ChildIndex++] : NULL;
+	}
+
+	// Sort by priority
+	struct FCompareFActorPriority
+	{
+		FORCEINLINE bool operator()( const FActorPriority& A, const FActorPriority& B ) const
+		{
+			return B.Priority < A.Priority;
+		}
+	};
+	PriorityList.Sort( FCompareFActorPriority() );
+}
+
 int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 {
 	SCOPE_CYCLE_COUNTER(STAT_NetServerRepActorsTime);
@@ -1951,6 +2241,47 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 	TArray<AActor*> ConsiderList;
 	ConsiderList.Reserve(NetRelevantActorCount);
 
+	// with the relevancy grid, the considered actors that have to be tested against every connection
+	const bool bUseRelevancyGrid = CVarNetRelevancyGrid.GetValueOnGameThread() != 0;
+	TArray<AActor*> UnculledConsiderList;
+	if (bUseRelevancyGrid)
+	{
+		const float CellSize = FMath::Max(CVarNetRelevancyGridCellSize.GetValueOnGameThread(), 100.f);
+		if (!RelevancyGrid.IsValid() || RelevancyGrid->GetCellSize() != CellSize)
+		{
+			RelevancyGrid = MakeShareable(new FNetRelevancyGrid(CellSize));
+		}
+		RelevancyGrid->BeginFrame(ReplicationFrame);
+	}
+	else
+	{
+		RelevancyGrid.Reset();
+	}
+
+	// with the actor schedule, the considered actors that go back in the schedule once they have been replicated
+	TArray<AActor*> ScheduledActors;
+	const bool bCanParkDormantActors = CVarSetNetDormancyEnabled.GetValueOnGameThread() == 1 && CVarNetDormancyValidate.GetValueOnGameThread() != 2;
+	if (CVarNetActorSchedule.GetValueOnGameThread() != 0)
+	{
+		if (!ActorSchedule.IsValid())
+		{
+			ActorSchedule = MakeShareable(new FNetActorSchedule());
+			for (AActor* Actor : World->NetworkActors)
+			{
+				ActorSchedule->AddActor(Actor, Actor->NetUpdateTime);
+			}
+		}
+		if (!bCanParkDormantActors)
+		{
+			ActorSchedule->WakeAllActors(World->TimeSeconds);
+		}
+		SET_DWORD_STAT(STAT_NumParkedNetActors, ActorSchedule->GetNumParkedActors());
+	}
+	else
+	{
+		ActorSchedule.Reset();
+	}
+
 	int32 NumInitiallyDormant = 0;
 
 	// Add WorldSettings to consider list if we have one
@@ -1962,6 +2293,10 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 			// For performance reasons, make sure we don't resize the array. It should already be appropriately sized above!
 			ensure(ConsiderList.Num() < ConsiderList.Max());
 			ConsiderList.Add(WorldSettings);
+			if (bUseRelevancyGrid)
+			{
+				UnculledConsiderList.Add(WorldSettings);
+			}
 		}
 	}
 
@@ -1983,34 +2318,31 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 
 		SET_DWORD_STAT( STAT_NumNetActors, World->NetworkActors.Num() );
 
-		for ( int i = World->NetworkActors.Num() - 1; i >= 0 ; i-- )		// Traverse list backwards so we can easily remove items
+		// Adds an actor to the consider lists if it is due for an update, and tells the caller what to do with it
+		auto ConsiderNetworkActor = [&](AActor* Actor) -> ENetworkActorConsideration::Type
 		{
-			AActor* Actor = World->NetworkActors[i];
-
 			if (Actor->IsPendingKill() )
 			{
-				World->NetworkActors.RemoveAtSwap( i );
-				continue;
+				return ENetworkActorConsideration::Remove;
 			}
 
 			if (Actor->GetRemoteRole()==ROLE_None)
 			{
-				World->NetworkActors.RemoveAtSwap( i );
-				continue;
+				return ENetworkActorConsideration::Remove;
 			}
 
 			// This actor may belong to a different net driver, make sure this is the correct one
 			// (this can happen when using beacon net drivers for example)
 			if ( Actor->NetDriverName != NetDriverName )
 			{
-				continue;
+				return ENetworkActorConsideration::Ignore;
 			}
 
 			// Don't send actors that may still be streaming in
 			ULevel* Level = Actor->GetLevel();
 			if ( Level->HasVisibilityRequestPending() || Level->bIsAssociatingLevel )
 			{
-				continue;
+				return ENetworkActorConsideration::Defer;
 			}
 
 			if ( Actor->NetDormancy == DORM_Initial && Actor->IsNetStartupActor() )
@@ -2019,9 +2351,8 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 				// We'll want to track initially dormant actors some other way to track them with stats
 				SCOPE_CYCLE_COUNTER(STAT_NetInitialDormantCheckTime);		
 				NumInitiallyDormant++;
-				World->NetworkActors.RemoveAtSwap( i );
 				//UE_LOG(LogNetTraffic, Log, TEXT("Skipping Actor %s - its initially dormant!"), *Actor->GetName() );
-				continue;
+				return ENetworkActorConsideration::Remove;
 			}
 
 			check( Actor->NeedsLoadForClient() );			// We have no business sending this unless the client can load
@@ -2058,6 +2389,18 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 					ensure(ConsiderList.Num() < ConsiderList.Max());
 					ConsiderList.Add(Actor);
 
+					if (bUseRelevancyGrid)
+					{
+						if (Actor->IsNetRelevancySpatial())
+						{
+							RelevancyGrid->UpdateActor(Actor);
+						}
+						else
+						{
+							UnculledConsiderList.Add(Actor);
+						}
+					}
+
 					bWasConsidered = true;
 				}
 				else
@@ -2117,6 +2460,8 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 				{
 					Actor->PreReplication( *FindOrCreateRepChangedPropertyTracker( Actor ).Get() );
 				}
+
+				return ENetworkActorConsideration::Due;
 			}
 			/*
 			else
@@ -2127,18 +2472,63 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 				}
 			}
 			*/
+
+			return ENetworkActorConsideration::NotDue;
+		};
+
+		if (ActorSchedule.IsValid())
+		{
+			// only look at the actors that are due, the others stay in the schedule
+			TArray<AActor*> DueActors;
+			ActorSchedule->PopDueActors(World->TimeSeconds, DueActors);
+			for (AActor* Actor : DueActors)
+			{
+				switch (ConsiderNetworkActor(Actor))
+				{
+				case ENetworkActorConsideration::Remove:
+					World->NetworkActors.RemoveSingleSwap(Actor);
+					ActorSchedule->RemoveActor(Actor);
+					break;
+				case ENetworkActorConsideration::Ignore:
+					ActorSchedule->RemoveActor(Actor);
+					break;
+				case ENetworkActorConsideration::Defer:
+					ActorSchedule->RescheduleActor(Actor, World->TimeSeconds);
+					break;
+				case ENetworkActorConsideration::NotDue:
+					ActorSchedule->RescheduleActor(Actor, Actor->NetUpdateTime);
+					break;
+				case ENetworkActorConsideration::Due:
+					// rescheduled once it has been replicated
+					ScheduledActors.Add(Actor);
+					break;
+				}
+			}
+		}
+		else
+		{
+			for ( int i = World->NetworkActors.Num() - 1; i >= 0 ; i-- )		// Traverse list backwards so we can easily remove items
+			{
+				if (ConsiderNetworkActor(World->NetworkActors[i]) == ENetworkActorConsideration::Remove)
+				{
+					World->NetworkActors.RemoveAtSwap( i );
+				}
+			}
 		}
 	}
 
 	SET_DWORD_STAT(STAT_NumInitiallyDormantActors,NumInitiallyDormant);
 	SET_DWORD_STAT(STAT_NumConsideredActors,ConsiderList.Num());
 
+	// Set up the connections to tick, then prioritize their actors, then replicate. Prioritizing only reads shared state,
+	// so with net.ParallelPrioritization the connections are prioritized in parallel; everything else stays on this thread.
+	TArray<FConnectionReplicationPriorities> ConnectionPriorities;
+	ConnectionPriorities.Reserve(NumClientsToTick);
+
 	for( int32 i=0; i < ClientConnections.Num(); i++ )
 	{
 		UNetConnection* Connection = ClientConnections[i];
 		check(Connection);
-		int32 ActorUpdatesThisConnection = 0;
-		int32 ActorUpdatesThisConnectionSent = 0;
 
 		// if this client shouldn't be ticked this frame
 		if (i >= NumClientsToTick)
@@ -2176,431 +2566,339 @@ int32 UNetDriver::ServerReplicateActors(float DeltaSeconds)
 		}
 		else if (Connection->ViewTarget)
 		{
-			int32 j;
-			int32 ConsiderCount	= 0;
-			int32 DeletedCount = 0;
-			
-			int32 NetRelevantCount = 0;
-			FActorPriority* PriorityList = NULL;
-			FActorPriority** PriorityActors = NULL;
-
-			TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
+			FConnectionReplicationPriorities& Priorities = *new(ConnectionPriorities) FConnectionReplicationPriorities(Connection);
+			TArray<FNetViewer>& ConnectionViewers = Priorities.Viewers;
 
-			float PruneActors = 0.f;
-			CLOCK_CYCLES(PruneActors);
-			FMemMark RelevantActorMark(FMemStack::Get());
-
-			// Prioritize actors for this connection
+			// send ClientAdjustment if necessary
+			// we do this here so that we send a maximum of one per packet to that client; there is no value in stacking additional corrections
+			if (Connection->PlayerController)
 			{
-				SCOPE_CYCLE_COUNTER(STAT_NetPrioritizeActorsTime);
-
-				// send ClientAdjustment if necessary
-				// we do this here so that we send a maximum of one per packet to that client; there is no value in stacking additional corrections
-				if (Connection->PlayerController)
-				{
-					Connection->PlayerController->SendClientAdjustment();
-				}
-				
-				for (int32 ChildIdx = 0; ChildIdx < Connection->Children.Num(); ChildIdx++)
+				Connection->PlayerController->SendClientAdjustment();
+			}
+			
+			for (int32 ChildIdx = 0; ChildIdx < Connection->Children.Num(); ChildIdx++)
+			{
+				if (Connection->Children[ChildIdx]->PlayerController != NULL)
 				{
-					if (Connection->Children[ChildIdx]->PlayerController != NULL)
-					{
-						Connection->Children[ChildIdx]->PlayerController->SendClientAdjustment();
-					}
+					Connection->Children[ChildIdx]->PlayerController->SendClientAdjustment();
 				}
+			}
 
-				// Get list of visible/relevant actors.
-				
-				NetTag++;
-				Connection->TickCount++;
-
-				// Set up to skip all sent temporary actors
-				for( j=0; j<Connection->SentTemporaries.Num(); j++ )
-				{
-					Connection->SentTemporaries[j]->NetTag = NetTag;
-				}
+			Connection->TickCount++;
 
-				// set the replication viewers to the current connection (and children) so that actors can determine who is currently being considered for relevancy checks
-				ConnectionViewers.Reset();
-				new(ConnectionViewers) FNetViewer(Connection, DeltaSeconds);
-				for (j = 0; j < Connection->Children.Num(); j++)
+			// the viewers of the connection (and children), which actors use to determine who is currently being considered for relevancy checks
+			new(ConnectionViewers) FNetViewer(Connection, DeltaSeconds);
+			for (int32 j = 0; j < Connection->Children.Num(); j++)
+			{
+				if (Connection->Children[j]->ViewTarget != NULL)
 				{
-					if (Connection->Children[j]->ViewTarget != NULL)
-					{
-						new(ConnectionViewers) FNetViewer(Connection->Children[j], DeltaSeconds);
-					}
+					new(ConnectionViewers) FNetViewer(Connection->Children[j], DeltaSeconds);
 				}
+			}
 
-				// Make list of all actors to consider.
-				check(World == Connection->OwningActor->GetWorld());
-				
-				NetRelevantCount = World->GetNetRelevantActorCount() + DestroyedStartupOrDormantActors.Num();
-				PriorityList = new(FMemStack::Get(),NetRelevantCount+2)FActorPriority;
-				PriorityActors = new(FMemStack::Get(),NetRelevantCount+2)FActorPriority*;
+			check(World == Connection->OwningActor->GetWorld());
 
-				// determine whether we should priority sort the list of relevant actors based on the saturation/bandwidth of the current connection
-				//@note - if the server is currently CPU saturated then do not sort until framerate improves
-				check(World == Connection->ViewTarget->GetWorld());
-				AGameMode const* const GameMode = World->GetAuthGameMode();
-				bool bLowNetBandwidth = !bCPUSaturated && (Connection->CurrentNetSpeed / float(GameMode->NumPlayers + GameMode->NumBots) < 500.f );
+			// determine whether we should priority sort the list of relevant actors based on the saturation/bandwidth of the current connection
+			//@note - if the server is currently CPU saturated then do not sort until framerate improves
+			check(World == Connection->ViewTarget->GetWorld());
+			AGameMode const* const GameMode = World->GetAuthGameMode();
+			Priorities.bLowNetBandwidth = !bCPUSaturated && (Connection->CurrentNetSpeed / float(GameMode->NumPlayers + GameMode->NumBots) < 500.f );
+			Priorities.bDormancyEnabled = CVarSetNetDormancyEnabled.GetValueOnGameThread() == 1;
+			Priorities.bValidateDormantActors = CVarNetDormancyValidate.GetValueOnGameThread() == 2;
 
-				for( AActor* Actor : ConsiderList )
+			// with the relevancy grid only consider the actors close to the viewers, the ones that already have a channel
+			// and the ones the grid can't cull, instead of every actor. The grid isn't thread safe, so gather here.
+			Priorities.ConsiderList = &ConsiderList;
+			if (bUseRelevancyGrid)
+			{
+				TArray<AActor*>& GridConsiderList = Priorities.GridConsiderList;
+				GridConsiderList.Append(UnculledConsiderList);
+				RelevancyGrid->BeginGather();
+				for (const FNetViewer& Viewer : ConnectionViewers)
 				{
-					UActorChannel* Channel = Connection->ActorChannels.FindRef(Actor);
+					RelevancyGrid->GatherRelevantActors(Viewer.ViewLocation, GridConsiderList);
 
-					// Skip Actor if dormant
-					if ( CVarSetNetDormancyEnabled.GetValueOnGameThread() == 1 )
+					// the view target and what it is attached to or standing on are relevant at any distance
+					for (AActor* ViewTarget = Viewer.ViewTarget; ViewTarget; ViewTarget = ViewTarget->GetAttachParentActor())
 					{
-						// If actor is already dormant on this channel, then skip replication entirely
-						if ( Connection->DormantActors.Contains( Actor ) )
+						RelevancyGrid->GatherActor(ViewTarget, GridConsiderList);
+						if (APawn* ViewPawn = Cast<APawn>(ViewTarget))
 						{
-							// net.DormancyValidate can be set to 2 to validate dormant actor properties on every replicate
-							// (this could be moved to be done every tick instead of every net update if necessary, but seems excessive)
-							if ( CVarNetDormancyValidate.GetValueOnGameThread() == 2 )
+							if (AActor* BaseActor = APawn::GetMovementBaseActor(ViewPawn))
 							{
-								TSharedRef< FObjectReplicator > * Replicator = Connection->DormantReplicatorMap.Find( Actor );
-
-								if ( Replicator != NULL )
-								{
-									Replicator->Get().ValidateAgainstState( Actor );
-								}
-							}
-
-							continue;
-						}
-
-						// If actor might need to go dormant on this channel, then check
-						if (Actor->NetDormancy > DORM_Awake && Channel && !Channel->bPendingDormancy && !Channel->Dormant )
-						{
-							bool ShouldGoDormant = true;
-							if (Actor->NetDormancy == DORM_DormantPartial)
-							{
-								float LastReplicationTime  = Channel ? (Connection->Driver->Time - Channel->LastUpdateTime) : Connection->Driver->SpawnPrioritySeconds;
-								for (int32 viewerIdx = 0; viewerIdx < ConnectionViewers.Num(); viewerIdx++)
-								{
-									if (!Actor->GetNetDormancy(ConnectionViewers[viewerIdx].ViewLocation, ConnectionViewers[viewerIdx].ViewDir, ConnectionViewers[viewerIdx].InViewer, ConnectionViewers[viewerIdx].ViewTarget, Channel, Time, bLowNetBandwidth))
-									{
-										ShouldGoDormant = false;
-										break;
-									}
-								}
-							}
-
-							if (ShouldGoDormant)
-							{
-								// Channel is marked to go dormant now once all properties have been replicated (but is not dormant yet)
-								Channel->StartBecomingDormant();
+								RelevancyGrid->GatherActor(BaseActor, GridConsiderList);
 							}
 						}
 					}
-
-
-					// Skip actor if not relevant and theres no channel already.
-					// Historically Relevancy checks were deferred until after prioritization because they were expensive (line traces).
-					// Relevancy is now cheap and we are dealing with larger lists of considered actors, so we want to keep the list of
-					// prioritized actors low.
-					if (!Channel)
-					{
-						if ( !IsLevelInitializedForActor(Actor, Connection) )
-						{
-							// If the level this actor belongs to isn't loaded on client, don't bother sending
-							continue;
-						}
-						bool Relevant = false;
-						for (int32 viewerIdx = 0; viewerIdx < ConnectionViewers.Num(); viewerIdx++)
-						{
-							if(Actor->IsNetRelevantFor(ConnectionViewers[viewerIdx].InViewer, ConnectionViewers[viewerIdx].ViewTarget, ConnectionViewers[viewerIdx].ViewLocation))
-							{
-								Relevant = true;
-								break;
-							}
-						}
-						if (!Relevant)
-						{
-							continue;
-						}
-					}
-
-					if( Actor->NetTag!=NetTag ) // Do not consider actor for this connection if this connection has it marked dormant
-					{
-						UE_LOG(LogNetTraffic, Log, TEXT("Consider %s alwaysrelevant %d frequency %f "),*Actor->GetName(), Actor->bAlwaysRelevant, Actor->NetUpdateFrequency);
-						Actor->NetTag                 = NetTag;
-						PriorityList  [ConsiderCount] = FActorPriority(Connection, Channel, Actor, ConnectionViewers, bLowNetBandwidth);
-						PriorityActors[ConsiderCount] = PriorityList + ConsiderCount;
-						ConsiderCount++;
-
-						if (DebugRelevantActors)
-						{
-							LastPrioritizedActors.Add(Actor);
-						}
-					}
-				}
-
-				// Add in deleted actors
-				for (auto It = Connection->DestroyedStartupOrDormantActors.CreateIterator(); It; ++It)
-				{
-					FActorDestructionInfo &DInfo = DestroyedStartupOrDormantActors.FindChecked(*It);
-					PriorityList  [ConsiderCount] = FActorPriority(Connection, &DInfo, ConnectionViewers);
-					PriorityActors[ConsiderCount] = PriorityList + ConsiderCount;
-					ConsiderCount++;
-					DeletedCount++;
 				}
-
-				UNetConnection* NextConnection = Connection;
-				int32 ChildIndex = 0;
-				while (NextConnection != NULL)
+				for (auto It = Connection->ActorChannels.CreateIterator(); It; ++It)
 				{
-					for (AActor* Actor : NextConnection->OwnedConsiderList)
+					if (AActor* ChannelActor = It.Key().Get())
 					{
-						UE_LOG(LogNetTraffic, Log, TEXT("Consider owned %s always relevant %d frequency %f  "),*Actor->GetName(), Actor->bAlwaysRelevant,Actor->NetUpdateFrequency);
-						if (Actor->NetTag != NetTag)
-						{
-							UActorChannel* Channel = Connection->ActorChannels.FindRef(Actor);
-							Actor->NetTag                 = NetTag;
-							PriorityList  [ConsiderCount] = FActorPriority(NextConnection, Channel, Actor, ConnectionViewers, bLowNetBandwidth);
-							PriorityActors[ConsiderCount] = PriorityList + ConsiderCount;
-							ConsiderCount++;
-
-							if (DebugRelevantActors)
-							{
-								LastPrioritizedActors.Add(Actor);
-							}
-						}
+						RelevancyGrid->GatherActor(ChannelActor, GridConsiderList);
 					}
-					NextConnection->OwnedConsiderList.Empty();
-
-					NextConnection = (ChildIndex < Connection->Children.Num()) ? Connection->Children[ChildIndex++] : NULL;
 				}
+				Priorities.ConsiderList = &GridConsiderList;
+				SET_DWORD_STAT(STAT_NumGridGatheredActors, GridConsiderList.Num() - UnculledConsiderList.Num());
+			}
+		}
+	}
 
-				SET_DWORD_STAT(STAT_PrioritizedActors,ConsiderCount);
-				SET_DWORD_STAT(STAT_NumRelevantDeletedActors,DeletedCount);
+	// Prioritize actors for each connection. The debug lists of relevant actors are shared, so don't go parallel while they are in use.
+	const bool bParallelPrioritization = CVarNetParallelPrioritization.GetValueOnGameThread() != 0 && !DebugRelevantActors;
+	ParallelFor(ConnectionPriorities.Num(), [this, &ConnectionPriorities](int32 PriorityIndex)
+	{
+		PrioritizeActorsForConnection(ConnectionPriorities[PriorityIndex]);
+	}, !bParallelPrioritization);
 
-				// Sort by priority
-				struct FCompareFActorPriority
-				{
-					FORCEINLINE bool operator()( const FActorPriority& A, const FActorPriority& B ) const
-					{
-						return B.Priority < A.Priority;
-					}
-				};
-				Sort( PriorityActors, ConsiderCount, FCompareFActorPriority() );
+	for (FConnectionReplicationPriorities& Priorities : ConnectionPriorities)
+	{
+		UNetConnection* Connection = Priorities.Connection;
+		TArray<FActorPriority>& PriorityList = Priorities.PriorityList;
+		const int32 ConsiderCount = PriorityList.Num();
+		int32 ActorUpdatesThisConnection = 0;
+		int32 ActorUpdatesThisConnectionSent = 0;
+		int32 j;
 
-			} // END PRIORITIZE
+		// set the replication viewers to the current connection (and children) so that actors can determine who is currently being considered for relevancy checks
+		TArray<FNetViewer>& ConnectionViewers = WorldSettings->ReplicationViewers;
+		ConnectionViewers = Priorities.Viewers;
 
-			// Update all relevant actors in sorted order.
-			bool bNewSaturated = !Connection->IsNetReady(0);
-			if (bNewSaturated)
-			{
-				j = 0;
-			}
-			else
+		SET_DWORD_STAT(STAT_PrioritizedActors,ConsiderCount);
+		SET_DWORD_STAT(STAT_NumRelevantDeletedActors,Priorities.DeletedCount);
+
+		// Update all relevant actors in sorted order.
+		bool bNewSaturated = !Connection->IsNetReady(0);
+		if (bNewSaturated)
+		{
+			j = 0;
+		}
+		else
+		{
+			UE_LOG(LogNetTraffic, Log, TEXT("START"));
+			int32 FinalRelevantCount = 0;
+			for (j = 0; j < ConsiderCount; j++)
 			{
-				UE_LOG(LogNetTraffic, Log, TEXT("START"));
-				int32 FinalRelevantCount = 0;
-				for (j = 0; j < ConsiderCount; j++)
+				// Deletion entry
+				if (PriorityList[j].Actor == NULL && PriorityList[j].DestructionInfo)
 				{
-					// Deletion entry
-					if (PriorityActors[j]->Actor == NULL && PriorityActors[j]->DestructionInfo)
+					// Make sure client has streaming level loaded
+					if (PriorityList[j].DestructionInfo->StreamingLevelName != NAME_None && !Connection->ClientVisibleLevelNames.Contains(PriorityList[j].DestructionInfo->StreamingLevelName))
 					{
-						// Make sure client has streaming level loaded
-						if (PriorityActors[j]->DestructionInfo->StreamingLevelName != NAME_None && !Connection->ClientVisibleLevelNames.Contains(PriorityActors[j]->DestructionInfo->StreamingLevelName))
-						{
-							// This deletion entry is for an actor in a streaming level the connection doesn't have loaded, so skip it
-							continue;
-						}
-
-						UActorChannel* Channel = (UActorChannel*)Connection->CreateChannel( CHTYPE_Actor, 1 );
-						if (Channel)
-						{
-							FinalRelevantCount++;
-							UE_LOG(LogNetTraffic, Log, TEXT("Server replicate actor creating destroy channel for NetGUID <%s,%s> Priority: %d"), *PriorityActors[j]->DestructionInfo->NetGUID.ToString(), *PriorityActors[j]->DestructionInfo->PathName, PriorityActors[j]->Priority );
-
-							Channel->SetChannelActorForDestroy( PriorityActors[j]->DestructionInfo ); // Send a close bunch on the new channel
-							Connection->DestroyedStartupOrDormantActors.Remove( PriorityActors[j]->DestructionInfo->NetGUID ); // Remove from connections to-be-destroyed list (close bunch of reliable, so it will make it there)
-						}
+						// This deletion entry is for an actor in a streaming level the connection doesn't have loaded, so skip it
 						continue;
 					}
 
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-					static IConsoleVariable* DebugObjectCvar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.PackageMap.DebugObject"));
-					if (DebugObjectCvar && !DebugObjectCvar->GetString().IsEmpty() && PriorityActors[j]->Actor && PriorityActors[j]->Actor->GetName().Contains(DebugObjectCvar->GetString()) )
+					UActorChannel* Channel = (UActorChannel*)Connection->CreateChannel( CHTYPE_Actor, 1 );
+					if (Channel)
 					{
-						UE_LOG(LogNetPackageMap, Log, TEXT("Evaluating actor for replication %s"), *PriorityActors[j]->Actor->GetName());
+						FinalRelevantCount++;
+						UE_LOG(LogNetTraffic, Log, TEXT("Server replicate actor creating destroy channel for NetGUID <%s,%s> Priority: %d"), *PriorityList[j].DestructionInfo->NetGUID.ToString(), *PriorityList[j].DestructionInfo->PathName, PriorityList[j].Priority );
+
+						Channel->SetChannelActorForDestroy( PriorityList[j].DestructionInfo ); // Send a close bunch on the new channel
+						Connection->DestroyedStartupOrDormantActors.Remove( PriorityList[j].DestructionInfo->NetGUID ); // Remove from connections to-be-destroyed list (close bunch of reliable, so it will make it there)
 					}
+					continue;
+				}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+				static IConsoleVariable* DebugObjectCvar = IConsoleManager::Get().FindConsoleVariable(TEXT("net.PackageMap.DebugObject"));
+				if (DebugObjectCvar && !DebugObjectCvar->GetString().IsEmpty() && PriorityList[j].Actor && PriorityList[j].Actor->GetName().Contains(DebugObjectCvar->GetString()) )
+				{
+					UE_LOG(LogNetPackageMap, Log, TEXT("Evaluating actor for replication %s"), *PriorityList[j].Actor->GetName());
+				}
 #endif
 
-					// Normal actor replication
-					UActorChannel* Channel     = PriorityActors[j]->Channel;
-					UE_LOG(LogNetTraffic, Log, TEXT(" Maybe Replicate %s"),*PriorityActors[j]->Actor->GetName());
-					if ( !Channel || Channel->Actor ) //make sure didn't just close this channel
-					{ 
-						AActor*		Actor       = PriorityActors[j]->Actor;
-						bool		bIsRelevant = false;
+				// Normal actor replication
+				UActorChannel* Channel     = PriorityList[j].Channel;
+				UE_LOG(LogNetTraffic, Log, TEXT(" Maybe Replicate %s"),*PriorityList[j].Actor->GetName());
+				if ( !Channel || Channel->Actor ) //make sure didn't just close this channel
+				{ 
+					AActor*		Actor       = PriorityList[j].Actor;
+					bool		bIsRelevant = false;
 
-						const bool bLevelInitializedForActor = IsLevelInitializedForActor(Actor, Connection);
+					const bool bLevelInitializedForActor = IsLevelInitializedForActor(Actor, Connection);
 
-						// only check visibility on already visible actors every 1.0 + 0.5R seconds
-						// bTearOff actors should never be checked
-						if ( bLevelInitializedForActor )
+					// only check visibility on already visible actors every 1.0 + 0.5R seconds
+					// bTearOff actors should never be checked
+					if ( bLevelInitializedForActor )
+					{
+						if (!Actor->bTearOff && (!Channel || Time - Channel->RelevantTime > 1.f))
 						{
-							if (!Actor->bTearOff && (!Channel || Time - Channel->RelevantTime > 1.f))
+							for (int32 k = 0; k < ConnectionViewers.Num(); k++)
 							{
-								for (int32 k = 0; k < ConnectionViewers.Num(); k++)
+								if (Actor->IsNetRelevantFor(ConnectionViewers[k].InViewer, ConnectionViewers[k].ViewTarget, ConnectionViewers[k].ViewLocation))
 								{
-									if (Actor->IsNetRelevantFor(ConnectionViewers[k].InViewer, ConnectionViewers[k].ViewTarget, ConnectionViewers[k].ViewLocation))
-									{
-										bIsRelevant = true;
-										break;
-									}
-									else
+									bIsRelevant = true;
+									break;
+								}
+								else
+								{
+									//UE_LOG(LogNetPackageMap, Warning, TEXT("Actor NonRelevant: %s"), *Actor->GetName() );
+									if (DebugRelevantActors)
 									{
-										//UE_LOG(LogNetPackageMap, Warning, TEXT("Actor NonRelevant: %s"), *Actor->GetName() );
-										if (DebugRelevantActors)
-										{
-											LastNonRelevantActors.Add(Actor);
-										}
+										LastNonRelevantActors.Add(Actor);
 									}
 								}
 							}
 						}
-						else
+					}
+					else
+					{
+						// Actor is no longer relevant because the world it is/was in is not loaded by client
+						// exception: player controllers should never show up here
+						UE_LOG(LogNetTraffic, Log, TEXT("- Level not initialized for actor %s"), *Actor->GetName());
+					}
+					
+					// if the actor is now relevant or was recently relevant
+					if( bIsRelevant || (Channel && Time - Channel->RelevantTime < RelevantTimeout) )
+					{	
+						FinalRelevantCount++;
+
+						// Find or create the channel for this actor.
+						// we can't create the channel if the client is in a different world than we are
+						// or the package map doesn't support the actor's class/archetype (or the actor itself in the case of serializable actors)
+						// or it's an editor placed actor and the client hasn't initialized the level it's in
+						if ( Channel == NULL && GuidCache->SupportsObject(Actor->GetClass()) &&
+								GuidCache->SupportsObject(Actor->IsNetStartupActor() ? Actor : Actor->GetArchetype()) )
 						{
-							// Actor is no longer relevant because the world it is/was in is not loaded by client
-							// exception: player controllers should never show up here
-							UE_LOG(LogNetTraffic, Log, TEXT("- Level not initialized for actor %s"), *Actor->GetName());
-						}
-						
-						// if the actor is now relevant or was recently relevant
-						if( bIsRelevant || (Channel && Time - Channel->RelevantTime < RelevantTimeout) )
-						{	
-							FinalRelevantCount++;
-
-							// Find or create the channel for this actor.
-							// we can't create the channel if the client is in a different world than we are
-							// or the package map doesn't support the actor's class/archetype (or the actor itself in the case of serializable actors)
-							// or it's an editor placed actor and the client hasn't initialized the level it's in
-							if ( Channel == NULL && GuidCache->SupportsObject(Actor->GetClass()) &&
-									GuidCache->SupportsObject(Actor->IsNetStartupActor() ? Actor : Actor->GetArchetype()) )
+							if (bLevelInitializedForActor)
 							{
-								if (bLevelInitializedForActor)
-								{
-									// Create a new channel for this actor.
-									Channel = (UActorChannel*)Connection->CreateChannel( CHTYPE_Actor, 1 );
-									if( Channel )
-									{
-										Channel->SetChannelActor( Actor );
-									}
-								}
-								// if we couldn't replicate it for a reason that should be temporary, and this Actor is updated very infrequently, make sure we update it again soon
-								else if (Actor->NetUpdateFrequency < 1.0f)
+								// Create a new channel for this actor.
+								Channel = (UActorChannel*)Connection->CreateChannel( CHTYPE_Actor, 1 );
+								if( Channel )
 								{
-									UE_LOG(LogNetTraffic, Log, TEXT("Unable to replicate %s"),*Actor->GetName());
-									Actor->NetUpdateTime = Actor->GetWorld()->TimeSeconds + 0.2f * FMath::FRand();
+									Channel->SetChannelActor( Actor );
 								}
 							}
+							// if we couldn't replicate it for a reason that should be temporary, and this Actor is updated very infrequently, make sure we update it again soon
+							else if (Actor->NetUpdateFrequency < 1.0f)
+							{
+								UE_LOG(LogNetTraffic, Log, TEXT("Unable to replicate %s"),*Actor->GetName());
+								Actor->NetUpdateTime = Actor->GetWorld()->TimeSeconds + 0.2f * FMath::FRand();
+							}
+						}
 
-							if( Channel )
+						if( Channel )
+						{
+							// if it is relevant then mark the channel as relevant for a short amount of time
+							if( bIsRelevant )
+							{
+								Channel->RelevantTime = Time + 0.5f * FMath::SRand();
+							}
+							// if the channel isn't saturated
+							if( Channel->IsNetReady(0) )
 							{
-								// if it is relevant then mark the channel as relevant for a short amount of time
-								if( bIsRelevant )
+								// replicate the actor
+								UE_LOG(LogNetTraffic, Log, TEXT("- Replicate %s. %d"),*Actor->GetName(), PriorityList[j].Priority);
+								if (DebugRelevantActors)
 								{
-									Channel->RelevantTime = Time + 0.5f * FMath::SRand();
+									LastRelevantActors.Add( Actor );
 								}
-								// if the channel isn't saturated
-								if( Channel->IsNetReady(0) )
+
+								if (Channel->ReplicateActor())
 								{
-									// replicate the actor
-									UE_LOG(LogNetTraffic, Log, TEXT("- Replicate %s. %d"),*Actor->GetName(), PriorityActors[j]->Priority);
+									ActorUpdatesThisConnectionSent++;
 									if (DebugRelevantActors)
 									{
-										LastRelevantActors.Add( Actor );
-									}
-
-									if (Channel->ReplicateActor())
-									{
-										ActorUpdatesThisConnectionSent++;
-										if (DebugRelevantActors)
-										{
-											LastSentActors.Add( Actor );
-										}
+										LastSentActors.Add( Actor );
 									}
-									ActorUpdatesThisConnection++;
-									Updated++;
-								}
-								else
-								{							
-									UE_LOG(LogNetTraffic, Log, TEXT("- Channel saturated, forcing pending update for %s"),*Actor->GetName());
-									// otherwise force this actor to be considered in the next tick again
-									Actor->ForceNetUpdate();
-								}
-								// second check for channel saturation
-								if (!Connection->IsNetReady(0))
-								{
-									bNewSaturated = true;
-									break;
 								}
+								ActorUpdatesThisConnection++;
+								Updated++;
 							}
-						}
-						// otherwise close the actor channel if it exists for this connection
-						else if ( Channel != NULL )
-						{
-							// Non startup (map) actors have their channels closed immediately, which destroys them.
-							// Startup actors get to keep their channels open.
-
-							// Fixme: this should be a setting
-							if ( !bLevelInitializedForActor || !Actor->IsNetStartupActor() )
+							else
+							{							
+								UE_LOG(LogNetTraffic, Log, TEXT("- Channel saturated, forcing pending update for %s"),*Actor->GetName());
+								// otherwise force this actor to be considered in the next tick again
+								Actor->ForceNetUpdate();
+							}
+							// second check for channel saturation
+							if (!Connection->IsNetReady(0))
 							{
-								UE_LOG(LogNetTraffic, Log, TEXT("- Closing channel for no longer relevant actor %s"),*Actor->GetName());
-								Channel->Close();
+								bNewSaturated = true;
+								break;
 							}
 						}
 					}
-				}
+					// otherwise close the actor channel if it exists for this connection
+					else if ( Channel != NULL )
+					{
+						// Non startup (map) actors have their channels closed immediately, which destroys them.
+						// Startup actors get to keep their channels open.
 
-				SET_DWORD_STAT(STAT_NumRelevantActors,FinalRelevantCount);
+						// Fixme: this should be a setting
+						if ( !bLevelInitializedForActor || !Actor->IsNetStartupActor() )
+						{
+							UE_LOG(LogNetTraffic, Log, TEXT("- Closing channel for no longer relevant actor %s"),*Actor->GetName());
+							Channel->Close();
+						}
+					}
+				}
 			}
 
-			// relevant actors that could not be processed this frame are marked to be considered for next frame
-			for ( int32 k=j; k<ConsiderCount; k++ )
+			SET_DWORD_STAT(STAT_NumRelevantActors,FinalRelevantCount);
+		}
+
+		// relevant actors that could not be processed this frame are marked to be considered for next frame
+		for ( int32 k=j; k<ConsiderCount; k++ )
+		{
+			AActor* Actor = PriorityList[k].Actor;
+			if (!Actor)
 			{
-				AActor* Actor = PriorityActors[k]->Actor;
-				if (!Actor)
-				{
-					// A deletion entry, skip it because we dont have anywhere to store a 'better give higher priority next time'
-					continue;
-				}
+				// A deletion entry, skip it because we dont have anywhere to store a 'better give higher priority next time'
+				continue;
+			}
 
-				UActorChannel* Channel = PriorityActors[k]->Channel;
-				
-				UE_LOG(LogNetTraffic, Verbose, TEXT("Saturated. %s"), *Actor->GetName());
-				if (Channel != NULL && Time - Channel->RelevantTime <= 1.f)
-				{
-					UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
-					Actor->bPendingNetUpdate = true;
-				}
-				else
+			UActorChannel* Channel = PriorityList[k].Channel;
+			
+			UE_LOG(LogNetTraffic, Verbose, TEXT("Saturated. %s"), *Actor->GetName());
+			if (Channel != NULL && Time - Channel->RelevantTime <= 1.f)
+			{
+				UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
+				Actor->bPendingNetUpdate = true;
+			}
+			else
+			{
+				for (int32 h = 0; h < ConnectionViewers.Num(); h++)
 				{
-					for (int32 h = 0; h < ConnectionViewers.Num(); h++)
+					if (Actor->IsNetRelevantFor(ConnectionViewers[h].InViewer, ConnectionViewers[h].ViewTarget, ConnectionViewers[h].ViewLocation))
 					{
-						if (Actor->IsNetRelevantFor(ConnectionViewers[h].InViewer, ConnectionViewers[h].ViewTarget, ConnectionViewers[h].ViewLocation))
+						UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
+						Actor->bPendingNetUpdate = true;
+						if (Channel != NULL)
 						{
-							UE_LOG(LogNetTraffic, Log, TEXT(" Saturated. Mark %s NetUpdateTime to be checked for next tick"), *Actor->GetName());
-							Actor->bPendingNetUpdate = true;
-							if (Channel != NULL)
-							{
-								Channel->RelevantTime = Time + 0.5f * FMath::SRand();
-							}
-							break;
+							Channel->RelevantTime = Time + 0.5f * FMath::SRand();
 						}
+						break;
 					}
 				}
 			}
-			RelevantActorMark.Pop();
-			UE_LOG(LogNetTraffic, Log, TEXT("Potential %04i ConsiderList %03i ConsiderCount %03i Prune=%01.4f "),NetRelevantCount, 
-						ConsiderList.Num(), ConsiderCount, FPlatformTime::ToMilliseconds(PruneActors) );
+		}
+		UE_LOG(LogNetTraffic, Log, TEXT("ConsiderList %03i ConsiderCount %03i"), Priorities.ConsiderList->Num(), ConsiderCount);
 
-			SET_DWORD_STAT(STAT_NumReplicatedActorAttempts,ActorUpdatesThisConnection);
-			SET_DWORD_STAT(STAT_NumReplicatedActors,ActorUpdatesThisConnectionSent);
+		SET_DWORD_STAT(STAT_NumReplicatedActorAttempts,ActorUpdatesThisConnection);
+		SET_DWORD_STAT(STAT_NumReplicatedActors,ActorUpdatesThisConnectionSent);
+	}
+
+	// put the considered actors back in the schedule: right away if a connection still has to replicate them, out of the way
+	// if they are dormant on every connection, otherwise for when they are next due
+	if (ActorSchedule.IsValid())
+	{
+		for (AActor* Actor : ScheduledActors)
+		{
+			if (Actor->bPendingNetUpdate)
+			{
+				ActorSchedule->RescheduleActor(Actor, World->TimeSeconds);
+			}
+			else if (bCanParkDormantActors && Actor->NetDormancy > DORM_Awake && IsActorDormantOnAllConnections(Actor))
+			{
+				ActorSchedule->ParkActor(Actor);
+			}
+			else
+			{
+				ActorSchedule->RescheduleActor(Actor, Actor->NetUpdateTime);
+			}
 		}
 	}
 
@@ -2779,6 +3077,12 @@ void UNetDriver::AddClientConnection(UNetConnection * NewConnection)
 
 	ClientConnections.Add(NewConnection);
 
+	// the new connection needs to receive the actors that are dormant on every other connection
+	if (ActorSchedule.IsValid() && World)
+	{
+		ActorSchedule->WakeAllActors(World->TimeSeconds);
+	}
+
 	for (auto It = DestroyedStartupOrDormantActors.CreateIterator(); It; ++It)
 	{
 		if (It.Key().IsStatic())
@@ -2795,6 +3099,7 @@ void UNetDriver::SetWorld(class UWorld* InWorld)
 	{
 		// Remove old world association
 		UnregisterTickEvents(World);
+		ActorSchedule.Reset();
 		World = NULL;
 		Notify = NULL;
 	}
@@ -0,0 +1,203 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NullNetDriver.cpp: Server network driver without sockets, for measuring replication.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "Engine/NullNetDriver.h"
+#include "Engine/NullNetConnection.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogNullNet, Log, All );
+
+/** Same packet size and overhead as a UDP connection, so that the bandwidth of a simulated client is spent the same way */
+static const int32 NULL_NET_MAX_PACKET		= 512;
+static const int32 NULL_NET_PACKET_OVERHEAD	= 32;
+
+/*-----------------------------------------------------------------------------
+	UNullNetDriver.
+-----------------------------------------------------------------------------*/
+
+UNullNetDriver::UNullNetDriver(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
+
+bool UNullNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const FURL& URL, bool bReuseAddressAndPort, FString& Error )
+{
+	if ( !Super::InitBase( bInitAsClient, InNotify, URL, bReuseAddressAndPort, Error ) )
+	{
+		return false;
+	}
+
+	ResetTotals();
+
+	return true;
+}
+
+bool UNullNetDriver::InitConnect( FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error )
+{
+	Error = TEXT( "The null net driver can only listen" );
+	return false;
+}
+
+bool UNullNetDriver::InitListen( FNetworkNotify* InNotify, FURL& ListenURL, bool bReuseAddressAndPort, FString& Error )
+{
+	if ( !InitBase( false, InNotify, ListenURL, bReuseAddressAndPort, Error ) )
+	{
+		return false;
+	}
+
+	UE_LOG( LogNullNet, Log, TEXT( "%s listening for simulated clients" ), *GetDescription() );
+
+	return true;
+}
+
+FString UNullNetDriver::LowLevelGetNetworkNumber()
+{
+	return FString( TEXT( "" ) );
+}
+
+void UNullNetDriver::TickFlush( float DeltaSeconds )
+{
+	// The connections ack internally, so like for demo recording the base class leaves replicating the actors to us
+	if ( ClientConnections.Num() > 0 )
+	{
+		const uint32 OutBunchesBefore	= OutBunches;
+		const uint32 StartCycles		= FPlatformTime::Cycles();
+
+		TotalReplicatedActors += ServerReplicateActors( DeltaSeconds );
+
+		TotalReplicateActorsCycles	+= FPlatformTime::Cycles() - StartCycles;
+		TotalOutBunches				+= OutBunches - OutBunchesBefore;
+	}
+
+	// Ticks the connections, which flushes what was just replicated
+	Super::TickFlush( DeltaSeconds );
+}
+
+void UNullNetDriver::ProcessRemoteFunction( class AActor* Actor, class UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, struct FFrame* Stack, class UObject* SubObject )
+{
+	if ( Function->FunctionFlags & FUNC_NetMulticast )
+	{
+		// Multicast functions go to every client the actor is relevant to, reliable ones go out regardless, see UIpNetDriver
+		for ( int32 i = 0; i < ClientConnections.Num(); i++ )
+		{
+			UNetConnection* Connection = ClientConnections[i];
+
+			if ( Connection->ViewTarget == NULL )
+			{
+				continue;
+			}
+
+			if ( ( Function->FunctionFlags & FUNC_NetReliable ) == 0 )
+			{
+				FNetViewer Viewer( Connection, 0.f );
+
+				if ( !Actor->IsNetRelevantFor( Viewer.InViewer, Viewer.ViewTarget, Viewer.ViewLocation ) )
+				{
+					continue;
+				}
+			}
+
+			InternalProcessRemoteFunction( Actor, SubObject, Connection, Function, Parameters, OutParms, Stack, true );
+		}
+
+		return;
+	}
+
+	UNetConnection* Connection = Actor->GetNetConnection();
+
+	if ( Connection != NULL )
+	{
+		InternalProcessRemoteFunction( Actor, SubObject, Connection, Function, Parameters, OutParms, Stack, true );
+	}
+}
+
+UNullNetConnection* UNullNetDriver::AddSimulatedClient( UClass* PlayerControllerClass, int32 ConnectionSpeed )
+{
+	check( World != NULL );
+	check( ServerConnection == NULL );
+
+	FActorSpawnParameters SpawnInfo;
+	SpawnInfo.ObjectFlags |= RF_Transient;
+	APlayerController* Controller = World->SpawnActor<APlayerController>( PlayerControllerClass, SpawnInfo );
+
+	if ( Controller == NULL )
+	{
+		UE_LOG( LogNullNet, Error, TEXT( "UNullNetDriver::AddSimulatedClient: Failed to spawn a %s." ), *GetNameSafe( PlayerControllerClass ) );
+		return NULL;
+	}
+
+	UNullNetConnection* Connection = NewObject<UNullNetConnection>( GetTransientPackage(), NetConnectionClass );
+	Connection->InitConnection( this, USOCK_Open, World->URL, ConnectionSpeed );
+
+	// As if the client had joined and loaded the map
+	Connection->ClientWorldPackageName = World->GetOutermost()->GetFName();
+
+	ClientConnections.Add( Connection );
+
+	Controller->SetReplicates( true );
+	Controller->SetAutonomousProxy( true );
+	Controller->SetPlayer( Connection );
+
+	return Connection;
+}
+
+void UNullNetDriver::ResetTotals()
+{
+	TotalOutBunches				= 0;
+	TotalReplicatedActors		= 0;
+	TotalReplicateActorsCycles	= 0;
+
+	for ( int32 i = 0; i < ClientConnections.Num(); i++ )
+	{
+		UNullNetConnection* Connection = Cast<UNullNetConnection>( ClientConnections[i] );
+
+		if ( Connection != NULL )
+		{
+			Connection->TotalOutPackets	= 0;
+			Connection->TotalOutBytes	= 0;
+		}
+	}
+}
+
+/*-----------------------------------------------------------------------------
+	UNullNetConnection.
+-----------------------------------------------------------------------------*/
+
+UNullNetConnection::UNullNetConnection( const FObjectInitializer& ObjectInitializer )
+	: Super( ObjectInitializer )
+	, TotalOutPackets( 0 )
+	, TotalOutBytes( 0 )
+{
+	InternalAck = true;
+}
+
+void UNullNetConnection::InitConnection( UNetDriver* InDriver, EConnectionState InState, const FURL& InURL, int32 InConnectionSpeed )
+{
+	InitBase( InDriver, NULL, InURL, InState, NULL_NET_MAX_PACKET, NULL_NET_PACKET_OVERHEAD );
+
+	if ( InConnectionSpeed )
+	{
+		CurrentNetSpeed = InConnectionSpeed;
+	}
+
+	InitSendBuffer();
+}
+
+FString UNullNetConnection::LowLevelGetRemoteAddress( bool bAppendPort )
+{
+	return TEXT( "UNullNetConnection" );
+}
+
+FString UNullNetConnection::LowLevelDescribe()
+{
+	return TEXT( "Simulated client connection" );
+}
+
+void UNullNetConnection::LowLevelSend( void* Data, int32 Count )
+{
+	TotalOutPackets++;
+	TotalOutBytes += Count + PacketOverhead;
+}
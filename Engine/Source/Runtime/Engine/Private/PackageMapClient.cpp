@@ -1046,6 +1046,22 @@ void UPackageMapClient::HandleUnAssignedObject(const UObject* Obj)
 	}
 }
 
+void UPackageMapClient::ExportNetGUIDsFrom( const UPackageMapClient* Other )
+{
+	for ( auto It = Other->NetGUIDAckStatus.CreateConstIterator(); It; ++It )
+	{
+		const FNetworkGUID& NetGUID = It.Key();
+		const FNetGuidCacheObject* CacheObject = GuidCache->ObjectLookup.Find( NetGUID );
+		const UObject* Obj = CacheObject != NULL ? CacheObject->Object.Get() : NULL;
+
+		// Dynamic objects are never exported by path, their NetGUID goes out with their actor channel
+		if ( Obj != NULL && !NetGUID.IsDefault() && ShouldSendFullPath( Obj, NetGUID ) )
+		{
+			ExportNetGUID( NetGUID, Obj, TEXT( "" ), NULL );
+		}
+	}
+}
+
 //--------------------------------------------------------------------
 //
 //	Misc
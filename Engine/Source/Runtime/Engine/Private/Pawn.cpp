@@ -1041,6 +1041,25 @@ bool APawn::IsNetRelevantFor(const APlayerController* RealViewer, const AActor*
 	return ((SrcLocation - GetActorLocation()).SizeSquared() < NetCullDistanceSquared);
 }
 
+bool APawn::IsNetRelevancySpatial() const
+{
+	// AI pawns are owned by their controller, player controllers are viewers themselves.
+	if (bAlwaysRelevant || bOnlyRelevantToOwner || Instigator != NULL || Cast<APlayerController>(Controller) != NULL || !GetRootComponent() || GetRootComponent()->AttachParent != NULL)
+	{
+		return false;
+	}
+	if (GetOwner() != NULL && (GetOwner() != Controller || Controller->GetOwner() != NULL))
+	{
+		return false;
+	}
+
+	// Pawns are relevant to what they are based on, and inherit the relevancy of skeletal mesh bases.
+	// Bases that don't replicate can't be view targets.
+	UPrimitiveComponent* MovementBase = GetMovementBase();
+	AActor* BaseActor = MovementBase ? MovementBase->GetOwner() : NULL;
+	return BaseActor == NULL || (BaseActor->GetRemoteRole() == ROLE_None && !Cast<USkeletalMeshComponent>(MovementBase));
+}
+
 void APawn::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
@@ -586,6 +586,11 @@ void APlayerController::ForceSingleNetUpdateFor(AActor* Target)
 			if (Channel != NULL)
 			{
 				Target->bPendingNetUpdate = true; // will cause some other clients to do lesser checks too, but that's unavoidable with the current functionality
+				// the net driver only looks at actors when they are due, so have it look at the target on its next update
+				if (Conn->Driver != NULL)
+				{
+					Conn->Driver->NotifyActorNetUpdateTimeLowered(Target, GetWorld()->TimeSeconds);
+				}
 			}
 		}
 	}
@@ -552,3 +552,61 @@ void FPrimitiveSceneProxy::DrawArrowHead(FPrimitiveDrawInterface* PDI, const FVe
 		, FVector(Tip.X + Ay.X*Size - Ax.X*Size/3, Tip.Y + Ay.Y*Size - Ax.Y*Size/3, Tip.Z + Ay.Z*Size - Ax.Z*Size/3)
 		, Color, SDPG_World, Thickness, bScreenSpace);
 }
+
+void FOccluderMeshData::BuildAdjacency()
+{
+	const int32 NumTriangles = Indices.Num() / 3;
+	AdjacentTriangles.Init(INDEX_NONE, NumTriangles * 3);
+
+	// Vertices split for UVs or normals still join their triangles
+	TMap<FVector, uint32> WeldedIndices;
+	TArray<uint32> Welded;
+	Welded.Empty(Vertices.Num());
+	for (int32 VertexIndex = 0; VertexIndex < Vertices.Num(); VertexIndex++)
+	{
+		const uint32* Existing = WeldedIndices.Find(Vertices[VertexIndex]);
+		Welded.Add(Existing ? *Existing : WeldedIndices.Add(Vertices[VertexIndex], VertexIndex));
+	}
+
+	// First triangle edge seen for each edge, or INDEX_NONE once an edge turned out to have more than two triangles
+	TMap<uint64, int32> FirstEdges;
+	for (int32 EdgeIndex = 0; EdgeIndex < NumTriangles * 3; EdgeIndex++)
+	{
+		const int32 NextEdgeIndex = EdgeIndex % 3 == 2 ? EdgeIndex - 2 : EdgeIndex + 1;
+		const uint32 Start = Welded[Indices[EdgeIndex]];
+		const uint32 End = Welded[Indices[NextEdgeIndex]];
+		if (Start == End)
+		{
+			continue;
+		}
+		const uint64 Key = (uint64(FMath::Min(Start, End)) << 32) | FMath::Max(Start, End);
+
+		int32* FirstEdge = FirstEdges.Find(Key);
+		if (!FirstEdge)
+		{
+			FirstEdges.Add(Key, EdgeIndex);
+		}
+		else if (*FirstEdge != INDEX_NONE && AdjacentTriangles[*FirstEdge] == INDEX_NONE)
+		{
+			AdjacentTriangles[*FirstEdge] = EdgeIndex / 3;
+			AdjacentTriangles[EdgeIndex] = *FirstEdge / 3;
+		}
+		else
+		{
+			// A third triangle, the edge doesn't separate two triangles
+			if (*FirstEdge != INDEX_NONE)
+			{
+				for (int32 Edge = 0; Edge < 3; Edge++)
+				{
+					const int32 OtherEdgeIndex = AdjacentTriangles[*FirstEdge] * 3 + Edge;
+					if (AdjacentTriangles[OtherEdgeIndex] == *FirstEdge / 3)
+					{
+						AdjacentTriangles[OtherEdgeIndex] = INDEX_NONE;
+					}
+				}
+				AdjacentTriangles[*FirstEdge] = INDEX_NONE;
+				*FirstEdge = INDEX_NONE;
+			}
+		}
+	}
+}
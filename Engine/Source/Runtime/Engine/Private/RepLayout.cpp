@@ -10,7 +10,7 @@
 #include "Net/NetworkProfiler.h"
 #include "Engine/ActorChannel.h"
 
-static TAutoConsoleVariable<int32> CVarAllowPropertySkipping( TEXT( "net.AllowPropertySkipping" ), 1, TEXT( "Allow skipping of properties that haven't changed for other clients" ) );
+static TAutoConsoleVariable<int32> CVarAllowPropertySkipping( TEXT( "net.AllowPropertySkipping" ), 1, TEXT( "Compare properties once a frame and share the change lists across connections, instead of comparing them for every connection" ) );
 
 static TAutoConsoleVariable<int32> CVarDoPropertyChecksum( TEXT( "net.DoPropertyChecksum" ), 0, TEXT( "" ) );
 
@@ -484,107 +484,6 @@ bool FRepLayout::CompareProperties(
 	return PropertyChanged;
 }
 
-void FRepLayout::LogChangeListMismatches( 
-	const uint8* 						Data, 
-	UActorChannel *						OwningChannel, 
-	const TArray< uint16 > &			PropertyList,
-	FRepState *							RepState1, 
-	FRepState * 						RepState2, 
-	const TArray< FRepChangedParent > & ChangedParents1,
-	const TArray< FRepChangedParent > & ChangedParents2 ) const
-{
-	FRepChangedPropertyTracker *	ChangeTracker	= RepState1->RepChangedPropertyTracker.Get();
-	UObject *						Object			= (UObject*)Data;
-	const UNetDriver *				NetDriver		= OwningChannel->Connection->Driver;
-
-	UE_LOG( LogNet, Warning, TEXT( "LogChangeListMismatches: %s" ), *Object->GetName() );
-
-	UE_LOG( LogNet, Warning, TEXT( "  %i, %i, %i, %i" ), NetDriver->ReplicationFrame, ChangeTracker->LastReplicationFrame, ChangeTracker->LastReplicationGroupFrame, RepState1->LastReplicationFrame );
-
-	for ( int32 i = 0; i < PropertyList.Num(); i++ )
-	{
-		const int32 Index		= PropertyList[i];
-		const int32 Changed1	= ChangedParents1[Index].Changed.Num();
-		const int32 Changed2	= ChangedParents2[Index].Changed.Num();
-
-		if ( Changed1 || Changed2 )
-		{
-			FString Changed1Str = Changed1 ? TEXT( "TRUE" ) : TEXT( "FALSE" );
-			FString Changed2Str = Changed2 ? TEXT( "TRUE" ) : TEXT( "FALSE" );
-			FString ExtraStr	= Changed1 != Changed2 ? TEXT( "<--- MISMATCH!" ) : TEXT( "<--- SAME" );
-
-			UE_LOG( LogNet, Warning, TEXT( "    Property changed: %s (%s / %s) %s" ), *Parents[Index].Property->GetName(), *Changed1Str, *Changed2Str, *ExtraStr );
-
-			FString StringValue1;
-			FString StringValue2;
-			FString StringValue3;
-
-			Parents[Index].Property->ExportText_InContainer( Parents[Index].ArrayIndex, StringValue1, Data, NULL, NULL, PPF_DebugDump );
-			Parents[Index].Property->ExportText_InContainer( Parents[Index].ArrayIndex, StringValue2, RepState1->StaticBuffer.GetData(), NULL, NULL, PPF_DebugDump );
-			Parents[Index].Property->ExportText_InContainer( Parents[Index].ArrayIndex, StringValue3, RepState2->StaticBuffer.GetData(), NULL, NULL, PPF_DebugDump );
-
-			UE_LOG( LogNet, Warning, TEXT( "      Values: %s, %s, %s" ), *StringValue1, *StringValue2, *StringValue3 );
-		}
-	}
-}
-
-static bool ChangedParentsHasChanged( const TArray< uint16 > & PropertyList, const TArray< FRepChangedParent > & ChangedParents )
-{
-	for ( int32 i = 0; i < PropertyList.Num(); i++ )
-	{
-		if ( ChangedParents[PropertyList[i]].Changed.Num() )
-		{
-			return true;
-		}
-	}
-
-	return false;
-}
-
-void FRepLayout::SanityCheckShadowStateAgainstChangeList( 
-	FRepState *							RepState, 
-	const uint8 *						Data, 
-	UActorChannel *						OwningChannel, 
-	const TArray< uint16 > &			PropertyList,
-	FRepState *							OtherRepState,
-	const TArray< FRepChangedParent > & OtherChangedParents ) const
-{
-	const uint8 *	CompareData	= RepState->StaticBuffer.GetData();
-	UObject *		Object		= (UObject*)Data;
-
-	TArray< FRepChangedParent > LocalChangedParents;
-	LocalChangedParents.SetNum( OtherChangedParents.Num() );
-
-	// Do an actual check to see which properties are different from our internal shadow state, and make sure the passed in change list matches
-	const bool Result = CompareProperties( RepState, CompareData, Data, LocalChangedParents, PropertyList );
-
-	if ( Result != ChangedParentsHasChanged( PropertyList, OtherChangedParents ) )
-	{
-		LogChangeListMismatches( Data, OwningChannel, PropertyList, RepState, OtherRepState, LocalChangedParents, OtherChangedParents );
-		UE_LOG( LogNet, Fatal, TEXT( "ReplicateProperties: Compare result mismatch: %s" ), *Object->GetName() );
-	}
-
-	for ( int32 i = 0; i < PropertyList.Num(); i++ )
-	{
-		const int32 Index = PropertyList[i];
-
-		if ( OtherChangedParents[Index].Changed.Num() != LocalChangedParents[Index].Changed.Num() )
-		{
-			LogChangeListMismatches( Data, OwningChannel, PropertyList, RepState, OtherRepState, LocalChangedParents, OtherChangedParents );
-			UE_LOG( LogNet, Fatal, TEXT( "ReplicateProperties: Compare count mismatch: %s" ), *Object->GetName() );
-		}
-
-		for ( int32 j = 0; j < OtherChangedParents[Index].Changed.Num(); j++ )
-		{
-			if ( OtherChangedParents[Index].Changed[j] != LocalChangedParents[Index].Changed[j] )
-			{
-				LogChangeListMismatches( Data, OwningChannel, PropertyList, RepState, OtherRepState, LocalChangedParents, OtherChangedParents );
-				UE_LOG( LogNet, Fatal, TEXT( "ReplicateProperties: Compare changelist value mismatch: %s" ), *Object->GetName() );
-			}
-		}
-	}
-}
-
 bool FRepLayout::ReplicateProperties( 
 	FRepState * RESTRICT		RepState, 
 	const uint8* RESTRICT		Data, 
@@ -599,7 +498,6 @@ bool FRepLayout::ReplicateProperties(
 
 	check( ObjectClass == Owner );
 
-	UObject *						Object			= (UObject*)Data;
 	const UNetDriver *				NetDriver		= OwningChannel->Connection->Driver;
 	FRepChangedPropertyTracker *	ChangeTracker	= RepState->RepChangedPropertyTracker.Get();
 	const uint8 *					CompareData		= RepState->StaticBuffer.GetData();
@@ -615,59 +513,53 @@ bool FRepLayout::ReplicateProperties(
 
 	bool PropertyChanged = false;
 
+	// Unconditional properties that changed since this FRepState last compared, merged from the change lists shared by all connections
+	TArray< uint16 > & SharedChanged = RepState->SharedChanged;
+	SharedChanged.Reset();
+
 #ifdef ENABLE_SUPER_CHECKSUMS
 	const bool bIsAllAcked = AllAcked( RepState );
 
 	if ( bIsAllAcked || !RepState->OpenAckedCalled )
 #endif
 	{
-		const int32	AllowSkipping = CVarAllowPropertySkipping.GetValueOnGameThread();
-		
-		const bool bCanSkip =	AllowSkipping > 0 && 
-								RepState->LastReplicationFrame != 0 &&
-								ChangeTracker->LastReplicationFrame == NetDriver->ReplicationFrame &&
-								ChangeTracker->LastReplicationGroupFrame == RepState->LastReplicationFrame;
-
-		if ( bCanSkip )
+		if ( CVarAllowPropertySkipping.GetValueOnGameThread() > 0 )
 		{
-			INC_DWORD_STAT_BY( STAT_NetSkippedDynamicProps, UnconditionalLifetime.Num() );
+			// Compare the unconditional properties once a frame, no matter how many connections replicate this object
+			UpdateSharedChangelist( RepState, ChangeTracker, Data, NetDriver->ReplicationFrame );
 
-			if ( AllowSkipping == 2 )
+			if ( RepState->LastChangelistIndex != INDEX_NONE && ChangeTracker->ChangelistHistoryEnd - RepState->LastChangelistIndex <= FRepChangedPropertyTracker::MAX_CHANGELIST_HISTORY )
 			{
-				// Sanity check results
-				check( ChangeTracker->UnconditionalPropChanged == ChangedParentsHasChanged( UnconditionalLifetime, ChangeTracker->Parents ) );
-
-				SanityCheckShadowStateAgainstChangeList( RepState, Data, OwningChannel, UnconditionalLifetime, ChangeTracker->LastRepState, ChangeTracker->Parents );
-			}
-		}
-		else
-		{
-			// FRepState group changed, force this group to compare again this frame
-			// This happens either once a frame, which is normal, or multiple times a frame 
-			// when multiple connections of the same actor aren't updated at the same time
-			ChangeTracker->LastReplicationFrame			= NetDriver->ReplicationFrame;
-			ChangeTracker->LastReplicationGroupFrame	= RepState->LastReplicationFrame;
-			ChangeTracker->LastRepState					= RepState;
+				INC_DWORD_STAT_BY( STAT_NetSkippedDynamicProps, UnconditionalLifetime.Num() );
 
-			// Reset changed list if anything changed last time
-			if ( ChangeTracker->UnconditionalPropChanged )
-			{
-				for ( int32 i = UnconditionalLifetime.Num() - 1; i >= 0; i-- )
+				for ( int32 i = RepState->LastChangelistIndex; i < ChangeTracker->ChangelistHistoryEnd; i++ )
 				{
-					ChangeTracker->Parents[UnconditionalLifetime[i]].Changed.Empty();
+					const TArray< uint16 > & Changelist = ChangeTracker->ChangelistHistory[ i % FRepChangedPropertyTracker::MAX_CHANGELIST_HISTORY ];
+
+					if ( SharedChanged.Num() == 0 )
+					{
+						SharedChanged.Append( Changelist );
+					}
+					else
+					{
+						MergeDirtyListInPlace( RepState, Data, SharedChanged, Changelist );
+					}
 				}
+
+				PropertyChanged = SharedChanged.Num() > 0;
+			}
+			else
+			{
+				// First compare, or the shared history has moved on too far, so compare against what was sent to this connection
+				PropertyChanged = CompareProperties( RepState, CompareData, Data, ChangeTracker->Parents, UnconditionalLifetime );
 			}
 
-			// Loop over all unconditional lifetime properties
-			ChangeTracker->UnconditionalPropChanged = CompareProperties( RepState, CompareData, Data, ChangeTracker->Parents, UnconditionalLifetime );
+			RepState->LastChangelistIndex = ChangeTracker->ChangelistHistoryEnd;
 		}
-
-		// Remember the last frame this FRepState was replicated, so we can note above when the FRepState replication group changes
-		RepState->LastReplicationFrame = NetDriver->ReplicationFrame;
-
-		if ( ChangeTracker->UnconditionalPropChanged )
+		else
 		{
-			PropertyChanged	= true;
+			PropertyChanged = CompareProperties( RepState, CompareData, Data, ChangeTracker->Parents, UnconditionalLifetime );
+			RepState->LastChangelistIndex = INDEX_NONE;
 		}
 
 		// Loop over all the conditional properties
@@ -679,9 +571,9 @@ bool FRepLayout::ReplicateProperties(
 #ifdef ENABLE_SUPER_CHECKSUMS
 	else
 	{
-		// If we didn't compare this frame, make sure to reset out replication frame
+		// If we didn't compare this frame, the shared change lists since the last compare were skipped
 		// This is to force a compare next time it comes up
-		RepState->LastReplicationFrame = 0;		
+		RepState->LastChangelistIndex = INDEX_NONE;
 	}
 #endif
 
@@ -711,17 +603,26 @@ bool FRepLayout::ReplicateProperties(
 				if ( ChangeTracker->Parents[i].Changed.Num() > 0 )
 				{
 					Changed.Append( ChangeTracker->Parents[i].Changed );
-
-					if ( Parents[i].Flags & PARENT_IsConditional )
-					{
-						// Reset properties that don't share information across connections
-						ChangeTracker->Parents[i].Changed.Empty();
-					}
+					ChangeTracker->Parents[i].Changed.Reset();
 				}
 			}
 
 			Changed.Add( 0 );
 
+			// Merge in the shared change lists
+			if ( SharedChanged.Num() > 0 )
+			{
+				if ( Changed.Num() == 1 )
+				{
+					Changed.Reset();
+					Changed.Append( SharedChanged );
+				}
+				else
+				{
+					MergeDirtyListInPlace( RepState, Data, Changed, SharedChanged );
+				}
+			}
+
 #ifdef SANITY_CHECK_MERGES
 			SanityCheckChangeList( Data, Changed );
 #endif
@@ -735,9 +636,7 @@ bool FRepLayout::ReplicateProperties(
 		{
 			for ( int32 i = 0; i < RepState->PreOpenAckHistory.Num(); i++ )
 			{
-				TArray< uint16 > Temp = Changed;
-				Changed.Empty();
-				MergeDirtyList( RepState, (void*)Data, Temp, RepState->PreOpenAckHistory[i].Changed, Changed );
+				MergeDirtyListInPlace( RepState, Data, Changed, RepState->PreOpenAckHistory[i].Changed );
 			}
 			RepState->PreOpenAckHistory.Empty();
 		}
@@ -773,6 +672,59 @@ bool FRepLayout::ReplicateProperties(
 	return false;
 }
 
+void FRepLayout::UpdateSharedChangelist( FRepState * RESTRICT RepState, FRepChangedPropertyTracker * ChangeTracker, const uint8* RESTRICT Data, const uint32 ReplicationFrame ) const
+{
+	if ( ChangeTracker->StaticBuffer.Num() > 0 && ChangeTracker->LastCompareFrame == ReplicationFrame )
+	{
+		return;		// Already compared this frame
+	}
+
+	ChangeTracker->LastCompareFrame = ReplicationFrame;
+
+	if ( ChangeTracker->StaticBuffer.Num() == 0 )
+	{
+		// Start out with the current state, connections compare against their own state until their first shared change list
+		ChangeTracker->StaticBuffer.AddZeroed( RepState->StaticBuffer.Num() );
+		ConstructProperties( ChangeTracker->StaticBuffer );
+		InitProperties( ChangeTracker->StaticBuffer, Data );
+		ChangeTracker->RepLayout = RepState->RepLayout;
+		return;
+	}
+
+	uint8* StoredData = ChangeTracker->StaticBuffer.GetData();
+
+	if ( !CompareProperties( RepState, StoredData, Data, ChangeTracker->Parents, UnconditionalLifetime ) )
+	{
+		return;
+	}
+
+	TArray< uint16 > & Changelist = ChangeTracker->ChangelistHistory[ ChangeTracker->ChangelistHistoryEnd % FRepChangedPropertyTracker::MAX_CHANGELIST_HISTORY ];
+	Changelist.Reset();
+
+	// Build the change list in the order of the parents so it is sorted, and remember the new values for the next compare
+	for ( int32 i = 0; i < Parents.Num(); i++ )
+	{
+		TArray< uint16 > & Changed = ChangeTracker->Parents[i].Changed;
+
+		if ( Changed.Num() > 0 )
+		{
+			Changelist.Append( Changed );
+			Changed.Reset();
+
+			const FRepParentCmd & Parent = Parents[i];
+			Parent.Property->CopySingleValue( Parent.Property->ContainerPtrToValuePtr< uint8 >( StoredData, Parent.ArrayIndex ), Parent.Property->ContainerPtrToValuePtr< uint8 >( Data, Parent.ArrayIndex ) );
+		}
+	}
+
+	Changelist.Add( 0 );
+
+#ifdef SANITY_CHECK_MERGES
+	SanityCheckChangeList( Data, Changelist );
+#endif
+
+	ChangeTracker->ChangelistHistoryEnd++;
+}
+
 void FRepLayout::UpdateChangelistHistory( FRepState * RepState, UClass * ObjectClass, const uint8* RESTRICT Data, const int32 AckPacketId, TArray< uint16 > * OutMerged ) const
 {
 	check( RepState->HistoryEnd >= RepState->HistoryStart );
@@ -805,9 +757,7 @@ void FRepLayout::UpdateChangelistHistory( FRepState * RepState, UClass * ObjectC
 			{
 				// Merge in nak'd change lists
 				check( OutMerged != NULL );
-				TArray< uint16 > Temp = *OutMerged;
-				OutMerged->Empty();
-				MergeDirtyList( RepState, (void*)Data, Temp, HistoryItem.Changed, *OutMerged );
+				MergeDirtyListInPlace( RepState, Data, *OutMerged, HistoryItem.Changed );
 				HistoryItem.Changed.Empty();
 
 #ifdef SANITY_CHECK_MERGES
@@ -1782,8 +1732,9 @@ public:
 void FRepLayout::MergeDirtyList( FRepState * RepState, const void* RESTRICT Data, const TArray< uint16 > & Dirty1, const TArray< uint16 > & Dirty2, TArray< uint16 > & MergedDirty ) const
 {
 	check( Dirty1.Num() > 0 || Dirty2.Num() > 0 );
+	check( &MergedDirty != &Dirty1 && &MergedDirty != &Dirty2 );
 
-	MergedDirty.Empty();
+	MergedDirty.Reset();
 
 	FMergeDirtyListImpl MergePropertiesImpl( Dirty1, Dirty2, MergedDirty, Parents, Cmds );
 
@@ -1797,6 +1748,13 @@ void FRepLayout::MergeDirtyList( FRepState * RepState, const void* RESTRICT Data
 	MergePropertiesImpl.MergedDirtyList.Add( 0 );
 }
 
+void FRepLayout::MergeDirtyListInPlace( FRepState * RepState, const void* RESTRICT Data, TArray< uint16 > & InOutDirty, const TArray< uint16 > & OtherDirty ) const
+{
+	// Move the current list into the scratch list and merge back into the original, so both allocations are reused instead of copying into a temporary
+	Exchange( InOutDirty, RepState->MergeScratch );
+	MergeDirtyList( RepState, Data, RepState->MergeScratch, OtherDirty, InOutDirty );
+}
+
 void FRepLayout::SanityCheckChangeList_DynamicArray_r( 
 	const int32				CmdIndex, 
 	const uint8* RESTRICT	Data, 
@@ -2598,10 +2556,10 @@ void FRepLayout::InitRepState(
 	RepState->StaticBuffer.AddZeroed( InObjectClass->GetDefaultsCount() );
 
 	// Construct the properties
-	ConstructProperties( RepState );
+	ConstructProperties( RepState->StaticBuffer );
 
 	// Init the properties
-	InitProperties( RepState, Src );
+	InitProperties( RepState->StaticBuffer, Src );
 	
 	RepState->RepChangedPropertyTracker = InRepChangedPropertyTracker;
 
@@ -2612,9 +2570,9 @@ void FRepLayout::InitRepState(
 	RebuildConditionalProperties( RepState, *InRepChangedPropertyTracker.Get(), FReplicationFlags() );
 }
 
-void FRepLayout::ConstructProperties( FRepState * RepState ) const
+void FRepLayout::ConstructProperties( TArray< uint8 > & ShadowData ) const
 {
-	uint8* StoredData = RepState->StaticBuffer.GetData();
+	uint8* StoredData = ShadowData.GetData();
 
 	// Construct all items
 	for ( int32 i = 0; i < Parents.Num(); i++ )
@@ -2623,16 +2581,16 @@ void FRepLayout::ConstructProperties( FRepState * RepState ) const
 		if ( Parents[i].ArrayIndex == 0 )
 		{
 			PTRINT Offset = Parents[i].Property->ContainerPtrToValuePtr<uint8>( StoredData ) - StoredData;
-			check( Offset >= 0 && Offset < RepState->StaticBuffer.Num() );
+			check( Offset >= 0 && Offset < ShadowData.Num() );
 
 			Parents[i].Property->InitializeValue( StoredData + Offset );
 		}
 	}
 }
 
-void FRepLayout::InitProperties( FRepState * RepState, uint8* Src ) const
+void FRepLayout::InitProperties( TArray< uint8 > & ShadowData, const uint8* Src ) const
 {
-	uint8* StoredData = RepState->StaticBuffer.GetData();
+	uint8* StoredData = ShadowData.GetData();
 
 	// Init all items
 	for ( int32 i = 0; i < Parents.Num(); i++ )
@@ -2641,16 +2599,16 @@ void FRepLayout::InitProperties( FRepState * RepState, uint8* Src ) const
 		if ( Parents[i].ArrayIndex == 0 )
 		{
 			PTRINT Offset = Parents[i].Property->ContainerPtrToValuePtr<uint8>( StoredData ) - StoredData;
-			check( Offset >= 0 && Offset < RepState->StaticBuffer.Num() );
+			check( Offset >= 0 && Offset < ShadowData.Num() );
 
 			Parents[i].Property->CopyCompleteValue( StoredData + Offset, Src + Offset );
 		}
 	}
 }
 
-void FRepLayout::DestructProperties( FRepState * RepState ) const
+void FRepLayout::DestructProperties( TArray< uint8 > & ShadowData ) const
 {
-	uint8* StoredData = RepState->StaticBuffer.GetData();
+	uint8* StoredData = ShadowData.GetData();
 
 	// Destruct all items
 	for ( int32 i = 0; i < Parents.Num(); i++ )
@@ -2659,13 +2617,13 @@ void FRepLayout::DestructProperties( FRepState * RepState ) const
 		if ( Parents[i].ArrayIndex == 0 )
 		{
 			PTRINT Offset = Parents[i].Property->ContainerPtrToValuePtr<uint8>( StoredData ) - StoredData;
-			check( Offset >= 0 && Offset < RepState->StaticBuffer.Num() );
+			check( Offset >= 0 && Offset < ShadowData.Num() );
 
 			Parents[i].Property->DestroyValue( StoredData + Offset );
 		}
 	}
 
-	RepState->StaticBuffer.Empty();
+	ShadowData.Empty();
 }
 
 void FRepLayout::GetLifetimeCustomDeltaProperties(TArray< int32 > & OutCustom, TArray< ELifetimeCondition >	& OutConditions)
@@ -2689,6 +2647,14 @@ FRepState::~FRepState()
 {
 	if (RepLayout.IsValid() && StaticBuffer.Num() > 0)
 	{	
-		RepLayout->DestructProperties( this );
+		RepLayout->DestructProperties( StaticBuffer );
+	}
+}
+
+FRepChangedPropertyTracker::~FRepChangedPropertyTracker()
+{
+	if ( RepLayout.IsValid() && StaticBuffer.Num() > 0 )
+	{
+		RepLayout->DestructProperties( StaticBuffer );
 	}
 }
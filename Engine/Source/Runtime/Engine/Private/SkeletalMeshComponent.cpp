@@ -654,30 +654,38 @@ void USkeletalMeshComponent::FillSpaceBases(const USkeletalMesh* InSkeletalMesh,
 #endif
 	}
 
-	for(int32 i=1; i<RequiredBones.Num(); i++)
+	// Convert a whole level of the hierarchy at a time if the levels are up to date. Building them checked that parents come first.
+	if (RequiredBoneDepthLevels.IsBuiltFor(RequiredBones, InSkeletalMesh->RefSkeleton))
 	{
-		const int32 BoneIndex = RequiredBones[i];
-		FTransform* SpaceBase = SpaceBasesData + BoneIndex;
+		RequiredBoneDepthLevels.ConvertToComponentSpace(LocalTransformsData, SpaceBasesData);
+	}
+	else
+	{
+		for(int32 i=1; i<RequiredBones.Num(); i++)
+		{
+			const int32 BoneIndex = RequiredBones[i];
+			FTransform* SpaceBase = SpaceBasesData + BoneIndex;
 
-		FPlatformMisc::Prefetch(SpaceBase);
+			FPlatformMisc::Prefetch(SpaceBase);
 
 #if (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT)
-		// Mark bone as processed
-		BoneProcessed[BoneIndex] = 1;
+			// Mark bone as processed
+			BoneProcessed[BoneIndex] = 1;
 #endif
-		// For all bones below the root, final component-space transform is relative transform * component-space transform of parent.
-		const int32 ParentIndex = InSkeletalMesh->RefSkeleton.GetParentIndex(BoneIndex);
-		FTransform* ParentSpaceBase = SpaceBasesData + ParentIndex;
-		FPlatformMisc::Prefetch(ParentSpaceBase);
+			// For all bones below the root, final component-space transform is relative transform * component-space transform of parent.
+			const int32 ParentIndex = InSkeletalMesh->RefSkeleton.GetParentIndex(BoneIndex);
+			FTransform* ParentSpaceBase = SpaceBasesData + ParentIndex;
+			FPlatformMisc::Prefetch(ParentSpaceBase);
 
 #if (UE_BUILD_DEBUG || UE_BUILD_DEVELOPMENT)
-		// Check the precondition that Parents occur before Children in the RequiredBones array.
-		checkSlow(BoneProcessed[ParentIndex] == 1);
+			// Check the precondition that Parents occur before Children in the RequiredBones array.
+			checkSlow(BoneProcessed[ParentIndex] == 1);
 #endif
-		FTransform::Multiply(SpaceBase, LocalTransformsData + BoneIndex, ParentSpaceBase);
+			FTransform::Multiply(SpaceBase, LocalTransformsData + BoneIndex, ParentSpaceBase);
 
-		checkSlow(SpaceBase->IsRotationNormalized());
-		checkSlow(!SpaceBase->ContainsNaN());
+			checkSlow(SpaceBase->IsRotationNormalized());
+			checkSlow(!SpaceBase->ContainsNaN());
+		}
 	}
 
 	/**
@@ -840,6 +848,8 @@ void USkeletalMeshComponent::RecalcRequiredBones(int32 LODIndex)
 		AnimScriptInstance->RecalcRequiredBones();
 	}
 
+	RequiredBoneDepthLevels.Build(RequiredBones, SkeletalMesh->RefSkeleton);
+
 	bRequiredBonesUpToDate = true;
 
 	// Invalidate cached bones.
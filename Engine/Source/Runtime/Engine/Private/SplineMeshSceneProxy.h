@@ -167,6 +167,12 @@ public:
 		return FStaticMeshSceneProxy::GetViewRelevance(View);
 	}
 
+	/** The occluder mesh is not deformed along the spline, so spline meshes are never used as software occluders. */
+	virtual const FOccluderMeshData* GetOccluderMeshData() const override
+	{
+		return NULL;
+	}
+
 	// 	  virtual uint32 GetMemoryFootprint( void ) const { return 0; }
 
 	/** Parameters that define the spline, used to deform mesh */
@@ -682,6 +682,40 @@ void FStaticMeshRenderData::InitResources(UStaticMesh* Owner)
 	ResolveSectionInfo(Owner);
 #endif // #if WITH_EDITOR
 
+	// Copy the occluder LOD before its resources are initialized, which may discard the CPU copy of its buffers
+	OccluderMesh.Vertices.Empty();
+	OccluderMesh.Indices.Empty();
+	if (LODResources.IsValidIndex(Owner->LODForOccluderMesh))
+	{
+		const FStaticMeshLODResources& OccluderLOD = LODResources[Owner->LODForOccluderMesh];
+		TArray<uint32> LODIndices;
+		OccluderLOD.IndexBuffer.GetCopy(LODIndices);
+
+		// Only opaque sections hide what is behind them, translucent and masked ones can be seen through
+		for (int32 SectionIndex = 0; SectionIndex < OccluderLOD.Sections.Num(); ++SectionIndex)
+		{
+			const FStaticMeshSection& Section = OccluderLOD.Sections[SectionIndex];
+			const UMaterialInterface* Material = Owner->GetMaterial(Section.MaterialIndex);
+			const bool bOpaque = Material ? Material->GetBlendMode() == BLEND_Opaque : true;
+			const uint32 LastIndex = Section.FirstIndex + Section.NumTriangles * 3;
+			if (bOpaque && LastIndex <= (uint32)LODIndices.Num())
+			{
+				OccluderMesh.Indices.Append(LODIndices.GetData() + Section.FirstIndex, Section.NumTriangles * 3);
+			}
+		}
+
+		if (OccluderMesh.Indices.Num() > 0)
+		{
+			const uint32 NumVertices = OccluderLOD.PositionVertexBuffer.GetNumVertices();
+			OccluderMesh.Vertices.Empty(NumVertices);
+			for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+			{
+				OccluderMesh.Vertices.Add(OccluderLOD.PositionVertexBuffer.VertexPosition(VertexIndex));
+			}
+			OccluderMesh.BuildAdjacency();
+		}
+	}
+
 	for (int32 LODIndex = 0; LODIndex < LODResources.Num(); ++LODIndex)
 	{
 		LODResources[LODIndex].InitResources(Owner);
@@ -1224,6 +1258,7 @@ UStaticMesh::UStaticMesh(const FObjectInitializer& ObjectInitializer)
 	LightMapResolution = 4;
 	LpvBiasMultiplier = 1.0f;
 	MinLOD = 0;
+	LODForOccluderMesh = -1;
 }
 
 /**
@@ -1288,6 +1323,7 @@ SIZE_T FStaticMeshRenderData::GetResourceSize() const
 
 	// Count dynamic arrays.
 	ResourceSize += LODResources.GetAllocatedSize();
+	ResourceSize += OccluderMesh.Vertices.GetAllocatedSize() + OccluderMesh.Indices.GetAllocatedSize();
 #if WITH_EDITORONLY_DATA
 	ResourceSize += DerivedDataKey.GetAllocatedSize();
 	ResourceSize += WedgeMap.GetAllocatedSize();
@@ -991,6 +991,11 @@ bool FStaticMeshSceneProxy::HasDistanceFieldRepresentation() const
 	return CastsDynamicShadow() && AffectsDistanceFieldLighting() && DistanceFieldData && DistanceFieldData->VolumeTexture.IsValidDistanceFieldVolume();
 }
 
+const FOccluderMeshData* FStaticMeshSceneProxy::GetOccluderMeshData() const
+{
+	return RenderData->OccluderMesh.Indices.Num() > 0 ? &RenderData->OccluderMesh : NULL;
+}
+
 /** Initialization constructor. */
 FStaticMeshSceneProxy::FLODInfo::FLODInfo(const UStaticMeshComponent* InComponent,int32 LODIndex):
 	OverrideColorVertexBuffer(0),
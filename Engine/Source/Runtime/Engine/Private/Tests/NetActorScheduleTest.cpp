@@ -0,0 +1,83 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "Net/NetActorSchedule.h"
+#include "AutomationTest.h"
+
+/**
+ * Moves actors through the states of an FNetActorSchedule the way UNetDriver::ServerReplicateActors does, and checks
+ * which actor, if any, comes up each time the due ones are popped.
+ */
+namespace NetActorScheduleTest
+{
+	/** Returns whether popping the actors due at Time gives just Expected, or nothing if Expected is NULL. */
+	bool PopsOnly(FNetActorSchedule& Schedule, float Time, AActor* Expected)
+	{
+		TArray<AActor*> Due;
+		Schedule.PopDueActors(Time, Due);
+		return Expected ? (Due.Num() == 1 && Due[0] == Expected) : Due.Num() == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNetActorScheduleTest, "Network.ActorSchedule", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FNetActorScheduleTest::RunTest(const FString& Parameters)
+{
+	using namespace NetActorScheduleTest;
+
+	AActor* A = NewObject<AActor>(GetTransientPackage(), NAME_None, RF_Transient);
+	AActor* B = NewObject<AActor>(GetTransientPackage(), NAME_None, RF_Transient);
+	AActor* C = NewObject<AActor>(GetTransientPackage(), NAME_None, RF_Transient);
+
+	FNetActorSchedule Schedule;
+	Schedule.AddActor(A, 1.0f);
+	Schedule.AddActor(B, 2.0f);
+	Schedule.AddActor(C, 3.0f);
+	TestEqual(TEXT("Added actors are in the schedule"), Schedule.GetNumActors(), 3);
+
+	TestTrue(TEXT("Only actors that are due are popped"), PopsOnly(Schedule, 1.5f, A));
+	TestTrue(TEXT("Popped actors don't come up again until they are rescheduled"), PopsOnly(Schedule, 1.5f, NULL));
+
+	// Reschedule
+	Schedule.RescheduleActor(A, 4.0f);
+	TestTrue(TEXT("Rescheduled actors aren't popped before their new time"), PopsOnly(Schedule, 2.5f, B));
+	Schedule.UpdateActor(C, 2.5f);
+	TestTrue(TEXT("Actors moved up by UpdateActor are popped at their new time"), PopsOnly(Schedule, 2.5f, C));
+	Schedule.UpdateActor(A, 10.0f);
+	TestTrue(TEXT("UpdateActor doesn't push actors back"), PopsOnly(Schedule, 4.0f, A));
+
+	// Park
+	Schedule.ParkActor(B);
+	Schedule.ParkActor(C);
+	Schedule.RescheduleActor(A, 5.0f);
+	TestEqual(TEXT("Parked actors are counted"), Schedule.GetNumParkedActors(), 2);
+	TestEqual(TEXT("Parked actors stay in the schedule"), Schedule.GetNumActors(), 3);
+	TestTrue(TEXT("Parked actors aren't popped"), PopsOnly(Schedule, 100.0f, A));
+	Schedule.UpdateActor(B, 0.0f);
+	TestTrue(TEXT("UpdateActor leaves parked actors parked"), PopsOnly(Schedule, 100.0f, NULL));
+	Schedule.WakeActor(B, 6.0f);
+	TestEqual(TEXT("Woken actors are no longer parked"), Schedule.GetNumParkedActors(), 1);
+	TestTrue(TEXT("Woken actors are popped when due"), PopsOnly(Schedule, 100.0f, B));
+	Schedule.AddActor(C, 7.0f);
+	TestEqual(TEXT("Adding a parked actor again wakes it"), Schedule.GetNumParkedActors(), 0);
+	TestTrue(TEXT("Actors woken by AddActor are popped when due"), PopsOnly(Schedule, 100.0f, C));
+
+	// Remove
+	Schedule.RescheduleActor(A, 8.0f);
+	Schedule.ParkActor(B);
+	Schedule.RemoveActor(A);
+	Schedule.RemoveActor(B);
+	TestEqual(TEXT("Removed actors leave the schedule"), Schedule.GetNumActors(), 1);
+	TestEqual(TEXT("Removed parked actors are no longer counted"), Schedule.GetNumParkedActors(), 0);
+	TestTrue(TEXT("Removed actors aren't popped"), PopsOnly(Schedule, 100.0f, NULL));
+	Schedule.RescheduleActor(A, 9.0f);
+	TestTrue(TEXT("Removed actors can't be rescheduled"), PopsOnly(Schedule, 100.0f, NULL));
+	Schedule.AddActor(A, 10.0f);
+	TestTrue(TEXT("Removed actors can be added again"), PopsOnly(Schedule, 100.0f, A));
+
+	A->MarkPendingKill();
+	B->MarkPendingKill();
+	C->MarkPendingKill();
+
+	return true;
+}
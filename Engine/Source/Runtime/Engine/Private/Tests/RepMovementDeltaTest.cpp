@@ -0,0 +1,159 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "AutomationTest.h"
+
+/**
+ * Runs FRepMovement::NetDeltaSerialize between a sender and a receiver over a lossy link, handling the base states
+ * the way FObjectReplicator does: the state of the oldest update in flight is the acked one, and a lost update
+ * restores the state it was made from. Every movement that arrives has to read back exactly like NetSerialize.
+ */
+namespace RepMovementDeltaTest
+{
+	/** An update in flight */
+	struct FSentUpdate
+	{
+		/** The sender's state before the update, restored if it is lost */
+		TSharedPtr<INetDeltaBaseState> StateBefore;
+		bool bDelivered;
+		int32 Step;
+	};
+
+	/** Returns the movement a receiver reads from NetSerialize. */
+	FRepMovement NetSerializeRoundTrip(FRepMovement Movement)
+	{
+		bool bSuccess = true;
+		FBitWriter Writer(0, true);
+		Movement.NetSerialize(Writer, NULL, bSuccess);
+
+		FRepMovement Received;
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		Received.NetSerialize(Reader, NULL, bSuccess);
+		return Received;
+	}
+
+	bool IsSameMovement(const FRepMovement& A, const FRepMovement& B)
+	{
+		return A.Location == B.Location && A.Rotation == B.Rotation && A.LinearVelocity == B.LinearVelocity
+			&& A.bRepPhysics == B.bRepPhysics && A.bSimulatedPhysicSleep == B.bSimulatedPhysicSleep
+			&& (!A.bRepPhysics || A.AngularVelocity == B.AngularVelocity);
+	}
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRepMovementDeltaTest, "Engine.Networking.RepMovementDelta", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FRepMovementDeltaTest::RunTest(const FString& Parameters)
+{
+	using namespace RepMovementDeltaTest;
+
+	const int32 NumSteps = 2000;
+	const int32 AckDelay = 6;
+	const float LossRate = 0.2f;
+
+	FRandomStream RandomStream(0x2b0d);
+
+	FRepMovement Movement;
+	Movement.Location = FVector(1000.0f, -2000.0f, 100.0f);
+	FRepMovement Received;
+
+	TSharedPtr<INetDeltaBaseState> SenderState;
+	TSharedPtr<INetDeltaBaseState> ReceiverState;
+	TArray<FSentUpdate> InFlight;
+
+	// The initial state, like FObjectReplicator::InitRecentProperties
+	{
+		FBitWriter Writer(0, true);
+		FNetDeltaSerializeInfo Parms;
+		Parms.Writer = &Writer;
+		Parms.NewState = &SenderState;
+		Movement.NetDeltaSerialize(Parms);
+	}
+
+	int32 NumSent = 0;
+	int64 DeltaBits = 0;
+	int64 FullBits = 0;
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		// Acks and naks come back in order
+		while (InFlight.Num() > 0 && InFlight[0].Step <= Step - AckDelay)
+		{
+			if (InFlight[0].bDelivered)
+			{
+				InFlight.RemoveAt(0);
+			}
+			else
+			{
+				SenderState = InFlight[0].StateBefore;
+				InFlight.Empty();
+			}
+		}
+
+		// Walk around, with the odd teleport and physics update, and stand still at the end so the receiver has to catch up
+		if (Step < NumSteps - 100)
+		{
+			if (RandomStream.FRand() < 0.02f)
+			{
+				Movement.Location = RandomStream.GetUnitVector() * 200000.0f;
+			}
+			else
+			{
+				Movement.Location += RandomStream.GetUnitVector() * RandomStream.FRandRange(0.0f, 20.0f);
+			}
+			Movement.Rotation.Yaw = FRotator::ClampAxis(Movement.Rotation.Yaw + RandomStream.FRandRange(-10.0f, 10.0f));
+			Movement.LinearVelocity = RandomStream.GetUnitVector() * 600.0f;
+			Movement.bRepPhysics = RandomStream.FRand() < 0.1f;
+			Movement.AngularVelocity = RandomStream.GetUnitVector() * 90.0f;
+		}
+
+		FBitWriter Writer(0, true);
+		TSharedPtr<INetDeltaBaseState> NewState;
+		FNetDeltaSerializeInfo Parms;
+		Parms.Writer = &Writer;
+		Parms.OldState = SenderState.Get();
+		Parms.AckedState = InFlight.Num() > 0 ? InFlight[0].StateBefore.Get() : SenderState.Get();
+		Parms.NewState = &NewState;
+		if (!Movement.NetDeltaSerialize(Parms))
+		{
+			continue;
+		}
+
+		FSentUpdate& Update = InFlight[InFlight.AddZeroed()];
+		Update.StateBefore = SenderState;
+		Update.bDelivered = RandomStream.FRand() >= LossRate;
+		Update.Step = Step;
+		SenderState = NewState;
+
+		NumSent++;
+		DeltaBits += Writer.GetNumBits();
+		{
+			bool bSuccess = true;
+			FBitWriter FullWriter(0, true);
+			Movement.NetSerialize(FullWriter, NULL, bSuccess);
+			FullBits += FullWriter.GetNumBits();
+		}
+
+		if (Update.bDelivered)
+		{
+			FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+			FNetDeltaSerializeInfo ReadParms;
+			ReadParms.Reader = &Reader;
+			ReadParms.OldState = ReceiverState.Get();
+			ReadParms.NewState = &ReceiverState;
+			Received.NetDeltaSerialize(ReadParms);
+
+			if (!IsSameMovement(Received, NetSerializeRoundTrip(Movement)))
+			{
+				AddError(FString::Printf(TEXT("Step %d: received movement differs from the one sent"), Step));
+				return false;
+			}
+		}
+	}
+
+	TestTrue(TEXT("Receiver has the final movement"), IsSameMovement(Received, NetSerializeRoundTrip(Movement)));
+
+	AddLogItem(FString::Printf(TEXT("%d updates, %.1f bits per update with deltas, %.1f bits per update with NetSerialize"),
+		NumSent, (double)DeltaBits / FMath::Max(NumSent, 1), (double)FullBits / FMath::Max(NumSent, 1)));
+
+	return true;
+}
@@ -2496,6 +2496,10 @@ bool UWorld::Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar )
 	{		
 		return HandleDemoStopCommand( Cmd, Ar, InWorld );
 	}
+	else if( FParse::Command( &Cmd, TEXT("DEMOSCRUB") ) )
+	{		
+		return HandleDemoScrubCommand( Cmd, Ar, InWorld );
+	}
 	else if( ExecPhysCommands( Cmd, &Ar, InWorld ) )
 	{
 		return HandleLogActorCountsCommand( Cmd, Ar, InWorld );
@@ -2643,6 +2647,24 @@ bool UWorld::HandleDemoStopCommand( const TCHAR* Cmd, FOutputDevice& Ar, UWorld*
 	return true;
 }
 
+bool UWorld::HandleDemoScrubCommand( const TCHAR* Cmd, FOutputDevice& Ar, UWorld* InWorld )
+{
+	FString TimeString;
+
+	if ( !FParse::Token( Cmd, TimeString, 0 ) )
+	{
+		Ar.Logf( TEXT( "Missing time in seconds." ) );
+		return true;
+	}
+
+	if ( DemoNetDriver == NULL || !DemoNetDriver->GotoTimeInSeconds( FCString::Atof( *TimeString ) ) )
+	{
+		Ar.Logf( TEXT( "No demo is playing back, or it is already going to another time." ) );
+	}
+
+	return true;
+}
+
 void UWorld::DestroyDemoNetDriver()
 {
 	if ( DemoNetDriver != NULL )
@@ -3157,6 +3179,19 @@ void UWorld::AddNetworkActor( AActor* Actor )
 	}
 
 	NetworkActors.AddUnique( Actor );
+
+	// Let the net drivers schedule the actor for replication
+	FWorldContext* Context = GEngine ? GEngine->GetWorldContextFromWorld( this ) : NULL;
+	if ( Context )
+	{
+		for ( FNamedNetDriver& NamedNetDriver : Context->ActiveNetDrivers )
+		{
+			if ( NamedNetDriver.NetDriver )
+			{
+				NamedNetDriver.NetDriver->NotifyNetworkActorAdded( Actor );
+			}
+		}
+	}
 }
 
 void UWorld::RemoveNetworkActor( AActor* Actor )
@@ -3167,6 +3202,18 @@ void UWorld::RemoveNetworkActor( AActor* Actor )
 	}
 
 	NetworkActors.RemoveSingleSwap( Actor );
+
+	FWorldContext* Context = GEngine ? GEngine->GetWorldContextFromWorld( this ) : NULL;
+	if ( Context )
+	{
+		for ( FNamedNetDriver& NamedNetDriver : Context->ActiveNetDrivers )
+		{
+			if ( NamedNetDriver.NetDriver )
+			{
+				NamedNetDriver.NetDriver->NotifyNetworkActorRemoved( Actor );
+			}
+		}
+	}
 }
 
 FDelegateHandle UWorld::AddOnActorSpawnedHandler( const FOnActorSpawned::FDelegate& InHandler )
@@ -4,6 +4,63 @@
 
 class USkeleton;
 
+/**
+ * Required bones below the root, sorted by their depth in the hierarchy.
+ * Bones of one depth only depend on bones of lower depths, so each depth level can be converted
+ * to component space as one FTransformBatch::MultiplyIndexed call instead of one bone at a time.
+ */
+struct FBoneDepthLevels
+{
+public:
+
+	FBoneDepthLevels()
+		: RefSkeleton(nullptr)
+	{ }
+
+	/**
+	 * Sorts the required bones by depth.
+	 * Leaves the levels empty if a parent doesn't come before its children in RequiredBoneIndices.
+	 */
+	ENGINE_API void Build(const TArray<FBoneIndexType>& RequiredBoneIndices, const FReferenceSkeleton& InRefSkeleton);
+
+	/** Empties the levels. */
+	void Reset()
+	{
+		RequiredBones.Reset();
+		BoneIndices.Reset();
+		ParentIndices.Reset();
+		LevelOffsets.Reset();
+		RefSkeleton = nullptr;
+	}
+
+	/** Returns true if the levels were built for these required bones, they aren't rebuilt automatically. */
+	bool IsBuiltFor(const TArray<FBoneIndexType>& RequiredBoneIndices, const FReferenceSkeleton& InRefSkeleton) const
+	{
+		return RefSkeleton == &InRefSkeleton && LevelOffsets.Num() > 0 && RequiredBones == RequiredBoneIndices;
+	}
+
+	/**
+	 * Converts the required bones below the root to component space, the root must already be set.
+	 *
+	 * @param LocalTransforms Local space transforms, indexed by bone.
+	 * @param ComponentSpaceTransforms Receives the component space transforms, indexed by bone.
+	 */
+	ENGINE_API void ConvertToComponentSpace(const FTransform* LocalTransforms, FTransform* ComponentSpaceTransforms) const;
+
+private:
+
+	/** Required bones the levels were built for. */
+	TArray<FBoneIndexType> RequiredBones;
+	/** Required bones below the root, sorted by depth. */
+	TArray<int32> BoneIndices;
+	/** Parent of every entry of BoneIndices. */
+	TArray<int32> ParentIndices;
+	/** Start of every level in BoneIndices, followed by the number of bones. */
+	TArray<int32> LevelOffsets;
+	/** Skeleton the levels were built for. */
+	const FReferenceSkeleton* RefSkeleton;
+};
+
 /**
 * This is a native transient structure.
 * Contains:
@@ -34,6 +91,9 @@ private:
 	/** Mapping table between Pose Bone Indices and Skeleton Bone Indices. */
 	TArray<int32> PoseToSkeletonBoneIndexArray;
 
+	/** BoneIndicesArray sorted by depth, for converting poses to component space. */
+	FBoneDepthLevels BoneDepthLevels;
+
 	/** For debugging. */
 	/** Disable Retargeting. Extract animation, but do not retarget it. */
 	bool bDisableRetargeting;
@@ -119,6 +179,12 @@ public:
 		return BoneIndicesArray;
 	}
 
+	/** Required bones sorted by depth. Not serialized, check IsBuiltFor before using them. */
+	const FBoneDepthLevels& GetBoneDepthLevels() const
+	{
+		return BoneDepthLevels;
+	}
+
 	/**
 	* returns Bone Switch Array. BitMask for RequiredBoneIndex array.
 	*/
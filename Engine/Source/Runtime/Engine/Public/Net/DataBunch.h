@@ -58,6 +58,10 @@ public:
 	ENGINE_API FOutBunch( class UChannel* InChannel, bool bClose );
 	ENGINE_API FOutBunch( UPackageMap * PackageMap, int64 InMaxBits = 1024 );
 
+	/** Empties the bunch to reuse it, leaving it as if it had just been constructed with the same arguments. */
+	ENGINE_API void Reinit( class UChannel* InChannel, bool bClose );
+	ENGINE_API void Reinit( UPackageMap * PackageMap, int64 InMaxBits );
+
 
 	FString	ToString()
 	{
@@ -82,6 +86,39 @@ public:
 	}
 };
 
+/**
+ * An outgoing bunch taken from a connection's pool (see UNetConnection::AllocOutBunch), and given back when this goes out of scope.
+ * Use instead of an FOutBunch on the stack where bunches are built often, so that building them doesn't allocate.
+ */
+class ENGINE_API FScopedOutBunch
+{
+public:
+	/** Takes a bunch for a channel, like FOutBunch( InChannel, bClose ). */
+	FScopedOutBunch( class UChannel* InChannel, bool bClose );
+
+	/** Takes a resizable bunch to write into through a connection's package map, like FOutBunch( Connection->PackageMap, InMaxBits ). */
+	FScopedOutBunch( class UNetConnection* InConnection, int64 InMaxBits );
+
+	~FScopedOutBunch();
+
+	FOutBunch& operator*() const
+	{
+		return *Bunch;
+	}
+
+	FOutBunch* operator->() const
+	{
+		return Bunch;
+	}
+
+private:
+	FScopedOutBunch( const FScopedOutBunch& );
+	FScopedOutBunch& operator=( const FScopedOutBunch& );
+
+	class UNetConnection* Connection;
+	FOutBunch* Bunch;
+};
+
 //
 // A bunch of data received from a channel.
 //
@@ -0,0 +1,121 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NetActorSchedule.h: Replication schedule of a net driver's network actors.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Queue of the network actors of a net driver ordered by their next update time (see AActor::NetUpdateTime), so that
+ * UNetDriver::ServerReplicateActors only looks at the actors that are due instead of at every network actor on every frame.
+ *
+ * Actors that are due are popped off the queue and have to be rescheduled, or parked, once they have been replicated.
+ * Parked actors are dormant on every connection and stay out of the queue until they are woken up, because their dormancy
+ * was flushed or a connection joined, so they cost nothing while they don't change.
+ *
+ * The schedule is kept in sync with UWorld::NetworkActors by the net driver. It only holds weak references, so an actor
+ * that is garbage collected without being removed is dropped when it comes up.
+ */
+class ENGINE_API FNetActorSchedule
+{
+public:
+
+	FNetActorSchedule();
+
+	/**
+	 * Adds an actor due at UpdateTime. If the actor is already in the schedule it is woken up if parked, or moved up
+	 * to UpdateTime if it is due later.
+	 */
+	void AddActor(AActor* Actor, float UpdateTime);
+
+	/** Moves an actor that is waiting in the queue up to UpdateTime, if it is due later. Parked actors stay parked. */
+	void UpdateActor(AActor* Actor, float UpdateTime);
+
+	/** Removes an actor from the schedule, e.g. when it is removed from the world's network actors. */
+	void RemoveActor(AActor* Actor);
+
+	/**
+	 * Pops the actors which are due, in the order of their update times.
+	 *
+	 * @param Time Current world time.
+	 * @param OutActors Receives the due actors, which stay in the schedule until they are rescheduled, parked or removed.
+	 */
+	void PopDueActors(float Time, TArray<AActor*>& OutActors);
+
+	/** Puts an actor which was returned by PopDueActors back in the queue, due at UpdateTime. */
+	void RescheduleActor(AActor* Actor, float UpdateTime);
+
+	/** Parks an actor which was returned by PopDueActors, until WakeActor or WakeAllActors is called. */
+	void ParkActor(AActor* Actor);
+
+	/** Puts a parked actor back in the queue, due at UpdateTime. */
+	void WakeActor(AActor* Actor, float UpdateTime);
+
+	/** Puts every parked actor back in the queue, due at UpdateTime. */
+	void WakeAllActors(float UpdateTime);
+
+	/** Returns the number of actors in the schedule, including the parked ones. */
+	int32 GetNumActors() const
+	{
+		return Actors.Num();
+	}
+
+	/** Returns the number of parked actors. */
+	int32 GetNumParkedActors() const
+	{
+		return NumParkedActors;
+	}
+
+private:
+
+	/** Where an actor is in the schedule. */
+	enum class EActorState : uint8
+	{
+		/** In the queue. */
+		Queued,
+		/** Returned by PopDueActors and not rescheduled yet. */
+		Popped,
+		/** Dormant, out of the queue. */
+		Parked,
+	};
+
+	/** An actor in the schedule. */
+	struct FActorEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		/** Time the actor is due, when queued. */
+		float UpdateTime;
+		/** Matches the queue entry which is current, older ones for the same actor are skipped. */
+		uint32 QueueSerial;
+		EActorState State;
+	};
+
+	/** An entry in the queue. */
+	struct FQueuedActor
+	{
+		float UpdateTime;
+		uint32 QueueSerial;
+		AActor* Actor;
+
+		bool operator<(const FQueuedActor& Other) const
+		{
+			return UpdateTime < Other.UpdateTime;
+		}
+	};
+
+	/** Queues an actor due at UpdateTime, replacing any queue entry it already has. */
+	void Enqueue(AActor* Actor, FActorEntry& Entry, float UpdateTime);
+
+	/** Rebuilds the queue without the entries that were replaced or removed, once they make up most of it. */
+	void CompactQueue();
+
+	/** Every actor in the schedule. */
+	TMap<AActor*, FActorEntry> Actors;
+	/** Heap of the queued actors, plus stale entries of actors that have been moved or removed since. */
+	TArray<FQueuedActor> Queue;
+	/** Serial of the next queue entry. */
+	uint32 NextQueueSerial;
+	/** Number of actors in the Parked state. */
+	int32 NumParkedActors;
+};
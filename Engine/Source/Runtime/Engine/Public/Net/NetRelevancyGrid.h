@@ -0,0 +1,131 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	NetRelevancyGrid.h: Spatial hash of replicated actors for relevancy checks.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Spatial hash of the replicated actors whose relevancy is a plain distance check (see AActor::IsNetRelevancySpatial),
+ * so that UNetDriver::ServerReplicateActors only has to test each connection against the actors around its viewers
+ * instead of against every considered actor.
+ *
+ * The grid is a cache that is kept up to date incrementally: actors are added, or moved to another cell, when they are
+ * considered for replication, and only actors considered in the current replication frame are gathered. Actors that
+ * haven't been considered for a while are dropped, so the grid doesn't need to be told about every actor that goes away.
+ */
+class ENGINE_API FNetRelevancyGrid
+{
+public:
+
+	/**
+	 * Creates an empty grid.
+	 *
+	 * @param InCellSize Size of a cell in world units, best close to the common cull distances.
+	 */
+	explicit FNetRelevancyGrid(float InCellSize);
+
+	/**
+	 * Starts a new replication frame, actors considered in previous frames won't be gathered until they are updated again.
+	 *
+	 * @param InFrame The net driver's replication frame.
+	 */
+	void BeginFrame(uint32 InFrame);
+
+	/**
+	 * Adds an actor that is considered for replication this frame, or moves it to the cell of its current location.
+	 *
+	 * @param Actor An actor for which IsNetRelevancySpatial is true.
+	 */
+	void UpdateActor(AActor* Actor);
+
+	/** Removes an actor from the grid, e.g. when it is destroyed. */
+	void RemoveActor(AActor* Actor);
+
+	/** Starts gathering the actors for a new connection, every actor is only gathered once per connection. */
+	void BeginGather();
+
+	/**
+	 * Gathers the actors considered this frame which are within their cull distance of a viewer.
+	 *
+	 * @param ViewLocation Location of the viewer.
+	 * @param OutActors Receives the actors which weren't gathered for the current connection yet.
+	 */
+	void GatherRelevantActors(const FVector& ViewLocation, TArray<AActor*>& OutActors);
+
+	/**
+	 * Gathers an actor regardless of its distance, if it is in the grid and considered this frame.
+	 * Used for actors that already have a channel, which need to be checked whether they are still relevant.
+	 *
+	 * @param Actor The actor to gather.
+	 * @param OutActors Receives the actor if it wasn't gathered for the current connection yet.
+	 */
+	void GatherActor(AActor* Actor, TArray<AActor*>& OutActors);
+
+	/** Returns the size of a cell in world units. */
+	float GetCellSize() const
+	{
+		return CellSize;
+	}
+
+	/** Returns the number of actors in the grid, including the ones that weren't considered this frame. */
+	int32 GetNumActors() const
+	{
+		return ActorCells.Num();
+	}
+
+private:
+
+	/** An actor in a cell. */
+	struct FCellEntry
+	{
+		AActor* Actor;
+		/** Location of the actor when it was last updated. */
+		FVector Location;
+		/** NetCullDistanceSquared of the actor when it was last updated. */
+		float CullDistanceSquared;
+		/** Replication frame in which the actor was last updated. */
+		uint32 Frame;
+		/** Gather pass which last gathered the actor. */
+		uint32 GatherTag;
+	};
+
+	/** Where an actor is stored. */
+	struct FActorCell
+	{
+		FIntPoint Cell;
+		/** Index in the cell's array. */
+		int32 Index;
+	};
+
+	/** Returns the cell containing a location. */
+	FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+	}
+
+	/** Removes the entry at Index from its cell, fixing up the index of the entry that moves into its place. */
+	void RemoveFromCell(const FIntPoint& Cell, int32 Index);
+
+	/** Drops the actors which haven't been considered for a while and recomputes MaxCullDistance. */
+	void Prune();
+
+	/** Size of a cell in world units. */
+	float CellSize;
+	/** 1 / CellSize. */
+	float InvCellSize;
+	/** Largest cull distance of the actors in the grid, which is how far around the viewers to look. */
+	float MaxCullDistance;
+	/** Current replication frame. */
+	uint32 Frame;
+	/** Replication frame of the last prune. */
+	uint32 LastPruneFrame;
+	/** Current gather pass. */
+	uint32 GatherTag;
+
+	/** Actors in each non-empty cell. Cells are 2D, columns of the world along the Z axis. */
+	TMap<FIntPoint, TArray<FCellEntry>> Cells;
+	/** Cell and index within the cell of every actor. */
+	TMap<AActor*, FActorCell> ActorCells;
+};
@@ -23,6 +23,8 @@ public:
 	uint32				IsConditional	: 1;
 };
 
+class FRepLayout;
+
 /** FRepChangedPropertyTracker
  * This class is used to store the change list for a group of properties of a particular actor/object
  * This information is shared across connections when possible
@@ -30,8 +32,8 @@ public:
 class FRepChangedPropertyTracker : public IRepChangedPropertyTracker
 {
 public:
-	FRepChangedPropertyTracker() : LastReplicationGroupFrame( 0 ), LastReplicationFrame( 0 ), ActiveStatusChanged( false ), UnconditionalPropChanged( false ) { }
-	virtual ~FRepChangedPropertyTracker() { }
+	FRepChangedPropertyTracker() : ActiveStatusChanged( false ), ChangelistHistoryEnd( 0 ), LastCompareFrame( 0 ) { }
+	virtual ~FRepChangedPropertyTracker();
 
 	virtual void SetCustomIsActiveOverride( const uint16 RepIndex, const bool bIsActive ) override
 	{
@@ -49,17 +51,18 @@ public:
 		Parent.OldActive = Parent.Active;
 	}
 
-	uint32						LastReplicationGroupFrame;		// Most recent frame number of the last FRepState that was compared this frame
-	uint32						LastReplicationFrame;
-	class FRepState *			LastRepState;
-
 	TArray< FRepChangedParent >	Parents;
 
 	uint32						ActiveStatusChanged;
-	bool						UnconditionalPropChanged;
-};
 
-class FRepLayout;
+	static const int32 MAX_CHANGELIST_HISTORY = 32;
+
+	TArray< uint8 >				StaticBuffer;									// Unconditional properties as of the last compare, shared by all connections
+	TSharedPtr< FRepLayout >	RepLayout;										// Layout StaticBuffer was constructed with
+	TArray< uint16 >			ChangelistHistory[MAX_CHANGELIST_HISTORY];		// Change lists of the unconditional properties, one for each compare that found a change
+	int32						ChangelistHistoryEnd;							// Number of change lists ever added, the latest is at ( ChangelistHistoryEnd - 1 ) % MAX_CHANGELIST_HISTORY
+	uint32						LastCompareFrame;								// ReplicationFrame of the last compare
+};
 
 class FRepChangedHistory
 {
@@ -108,7 +111,7 @@ public:
 	FRepState() : 
 		HistoryStart( 0 ), 
 		HistoryEnd( 0 ),
-		LastReplicationFrame( 0 ),
+		LastChangelistIndex( INDEX_NONE ),
 		NumNaks( 0 ),
 		OpenAckedCalled( false ),
 		AwakeFromDormancy( false ),
@@ -133,7 +136,7 @@ public:
 	int32						HistoryStart;
 	int32						HistoryEnd;
 
-	uint32						LastReplicationFrame;
+	int32						LastChangelistIndex;		// ChangelistHistoryEnd of the tracker when this state last compared, INDEX_NONE to compare against StaticBuffer instead
 	int32						NumNaks;
 
 	TArray< FRepChangedHistory >	PreOpenAckHistory;
@@ -144,6 +147,9 @@ public:
 	TArray< uint16 >				ConditionalLifetime;		// Properties the need to be checked conditionally (based on net initial, role, etc)
 	FReplicationFlags				RepFlags;
 	uint32							ActiveStatusChanged;
+
+	TArray< uint16 >				SharedChanged;				// Scratch list for the shared change lists merged in ReplicateProperties, kept to reuse its allocation
+	TArray< uint16 >				MergeScratch;				// Scratch list swapped with the list being merged into, kept to reuse its allocation
 };
 
 enum ERepLayoutCmdType
@@ -241,6 +247,7 @@ public:
 class FRepLayout
 {
 	friend class FRepState;
+	friend class FRepChangedPropertyTracker;
 
 public:
 	FRepLayout() : FirstNonCustomParent( 0 ), RoleIndex( -1 ), RemoteRoleIndex( -1 ), Owner( NULL ) {}
@@ -301,6 +308,7 @@ public:
 	uint32 GenerateChecksum( const FRepState* RepState ) const;
 
 	void MergeDirtyList( FRepState * RepState, const void* RESTRICT Data, const TArray< uint16 > & Dirty1, const TArray< uint16 > & Dirty2, TArray< uint16 > & MergedDirty ) const;
+	void MergeDirtyListInPlace( FRepState * RepState, const void* RESTRICT Data, TArray< uint16 > & InOutDirty, const TArray< uint16 > & OtherDirty ) const;
 
 	bool DiffProperties( FRepState * RepState, const void* RESTRICT Data, const bool bSync ) const;
 
@@ -321,22 +329,7 @@ public:
 private:
 	void RebuildConditionalProperties( FRepState * RESTRICT	RepState, const FRepChangedPropertyTracker& ChangedTracker, const FReplicationFlags& RepFlags ) const;
 
-	void LogChangeListMismatches( 
-		const uint8* 						Data, 
-		UActorChannel *						OwningChannel, 
-		const TArray< uint16 > &			PropertyList,
-		FRepState *							RepState1, 
-		FRepState * 						RepState2, 
-		const TArray< FRepChangedParent > & ChangedParents1,
-		const TArray< FRepChangedParent > & ChangedParents2 ) const;
-
-	void SanityCheckShadowStateAgainstChangeList(
-		FRepState * 						RepState, 
-		const uint8* 						Data, 
-		UActorChannel *						OwningChannel, 
-		const TArray< uint16 > &			PropertyList,
-		FRepState *							OtherRepState,
-		const TArray< FRepChangedParent > & OtherChangedParents ) const;
+	void UpdateSharedChangelist( FRepState * RESTRICT RepState, FRepChangedPropertyTracker * ChangeTracker, const uint8* RESTRICT Data, const uint32 ReplicationFrame ) const;
 
 	void UpdateChangelistHistory( FRepState * RepState, UClass * ObjectClass, const uint8* RESTRICT Data, const int32 AckPacketId, TArray< uint16 > * OutMerged ) const;
 
@@ -434,9 +427,9 @@ private:
 		void *				Data,
 		bool &				bHasUnmapped ) const;
 
-	void ConstructProperties( FRepState * RepState ) const;
-	void InitProperties( FRepState * RepState, uint8* Src ) const;
-	void DestructProperties( FRepState * RepState ) const;
+	void ConstructProperties( TArray< uint8 > & ShadowData ) const;
+	void InitProperties( TArray< uint8 > & ShadowData, const uint8* Src ) const;
+	void DestructProperties( TArray< uint8 > & ShadowData ) const;
 
 	TArray< FRepParentCmd >		Parents;
 	TArray< FRepLayoutCmd >		Cmds;
@@ -47,6 +47,23 @@ public:
 	uint32 bHasPerViewData;
 };
 
+/** Triangles in the local space of a primitive, which the renderer can draw into its software occlusion buffer. */
+class FOccluderMeshData
+{
+public:
+	TArray<FVector> Vertices;
+	/** Triangle list indices into Vertices. */
+	TArray<uint32> Indices;
+	/**
+	 * For each edge of each triangle, from its first to its second vertex and so on, the triangle on the other side of it, or
+	 * INDEX_NONE on open edges and edges shared by more than two triangles. Vertices at the same position are the same vertex.
+	 */
+	TArray<int32> AdjacentTriangles;
+
+	/** Builds AdjacentTriangles from Vertices and Indices. */
+	ENGINE_API void BuildAdjacency();
+};
+
 /** Data pertaining to a set of simple dynamic lights */
 class FSimpleLightArray
 {
@@ -438,6 +455,15 @@ public:
 		return false;
 	}
 
+	/**
+	 * Returns the triangles the renderer draws into its software occlusion buffer to cull what is behind the primitive, or
+	 * NULL if it has none. Only used when ShouldUseAsOccluder() is true. Called in the rendering thread.
+	 */
+	virtual const FOccluderMeshData* GetOccluderMeshData() const
+	{
+		return NULL;
+	}
+
 	/** 
 	 * Drawing helper. Draws nice bouncy line.
 	 */
@@ -623,6 +623,9 @@ public:
 	/** True if the mesh or LODs were reduced using Simplygon. */
 	bool bReducedBySimplygon;
 
+	/** Copy of UStaticMesh::LODForOccluderMesh for the software occlusion buffer, empty if the mesh doesn't occlude. */
+	FOccluderMeshData OccluderMesh;
+
 #if WITH_EDITORONLY_DATA
 	/** The derived data key associated with this render data. */
 	FString DerivedDataKey;
@@ -778,6 +781,7 @@ public:
 	virtual void GetDistancefieldAtlasData(FBox& LocalVolumeBounds, FIntVector& OutBlockMin, FIntVector& OutBlockSize, bool& bOutBuiltAsIfTwoSided, bool& bMeshWasPlane, TArray<FMatrix>& ObjectLocalToWorldTransforms) const override;
 	virtual void GetDistanceFieldInstanceInfo(int32& NumInstances, float& BoundsSurfaceArea) const override;
 	virtual bool HasDistanceFieldRepresentation() const override;
+	virtual const FOccluderMeshData* GetOccluderMeshData() const override;
 	virtual uint32 GetMemoryFootprint( void ) const override { return( sizeof( *this ) + GetAllocatedSize() ); }
 	uint32 GetAllocatedSize( void ) const { return( FPrimitiveSceneProxy::GetAllocatedSize() + LODs.GetAllocatedSize() ); }
 
@@ -27,6 +27,12 @@ public:
 		OutFoliageNormalizedRotationAxisAndAngle = FoliageNormalizedRotationAxisAndAngle;
 	}
 
+	/** The occluder mesh doesn't bend with the foliage, so interactive foliage is never used as a software occluder. */
+	virtual const FOccluderMeshData* GetOccluderMeshData() const override
+	{
+		return NULL;
+	}
+
 	/** Updates the scene proxy with new foliage parameters from the game thread. */
 	void UpdateParameters_GameThread(const FVector& NewFoliageImpluseDirection, const FVector4& NewFoliageNormalizedRotationAxisAndAngle)
 	{
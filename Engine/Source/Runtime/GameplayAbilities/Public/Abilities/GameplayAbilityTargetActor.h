@@ -65,6 +65,7 @@ public:
 	FAbilityTargetData	CanceledDelegate;
 
 	virtual bool IsNetRelevantFor(const APlayerController* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+	virtual bool IsNetRelevancySpatial() const override { return false; }
 
 	UPROPERTY(BlueprintReadOnly, Category = "Targeting")
 	APlayerController* MasterPC;
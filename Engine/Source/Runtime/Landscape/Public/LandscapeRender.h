@@ -440,6 +440,12 @@ public:
 	virtual ~FLandscapeMeshProxySceneProxy();
 	virtual void CreateRenderThreadResources() override;
 	virtual void OnLevelAddedToWorld() override;
+
+	/** Landscape mesh proxies are LOD stand-ins stitched to neighboring components and are never used as software occluders. */
+	virtual const FOccluderMeshData* GetOccluderMeshData() const override
+	{
+		return NULL;
+	}
 };
 
 
@@ -381,6 +381,12 @@ bool FHttpNetworkReplayStreamer::IsDataAvailable() const
 	return false;
 }
 
+void FHttpNetworkReplayStreamer::GotoTimeInMS( uint32 TimeInMS, const FOnCheckpointReady& Delegate )
+{
+	// The replay server doesn't store checkpoints yet
+	Delegate.ExecuteIfBound( false, 0 );
+}
+
 bool FHttpNetworkReplayStreamer::IsLive(const FString& StreamName) const 
 {
 	return bStreamIsLive;
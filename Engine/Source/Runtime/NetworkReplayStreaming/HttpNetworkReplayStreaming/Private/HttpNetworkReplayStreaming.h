@@ -39,6 +39,9 @@ public:
 	virtual void		UpdateTotalDemoTime( uint32 TimeInMS ) override;
 	virtual uint32		GetTotalDemoTime() const override { return DemoTimeInMS; }
 	virtual bool		IsDataAvailable() const override;
+	virtual FArchive*	GetCheckpointArchive() override { return NULL; }
+	virtual void		FlushCheckpoint( uint32 TimeInMS ) override { }
+	virtual void		GotoTimeInMS( uint32 TimeInMS, const FOnCheckpointReady& Delegate ) override;
 	virtual bool		IsLive( const FString& StreamName ) const override;
 	virtual void		DeleteFinishedStream( const FString& StreamName, const FOnDeleteFinishedStreamComplete& Delegate ) const override;
 	virtual void		EnumerateStreams( const FString& VersionString, const FOnEnumerateStreamsComplete& Delegate ) override;
@@ -47,6 +47,14 @@ DECLARE_DELEGATE_OneParam( FOnDeleteFinishedStreamComplete, bool );
  */
 DECLARE_DELEGATE_OneParam( FOnEnumerateStreamsComplete, const TArray<FNetworkReplayStreamInfo>& );
 
+/**
+ * Delegate called when GotoTimeInMS() completes.
+ *
+ * @param bWasSuccessful Whether a checkpoint was found and loaded.
+ * @param CheckpointTimeInMS Time of the checkpoint, the streaming archive continues with the data recorded right after it.
+ */
+DECLARE_DELEGATE_TwoParams( FOnCheckpointReady, bool, uint32 );
+
 /** Generic interface for network replay streaming */
 class INetworkReplayStreamer 
 {
@@ -61,6 +69,28 @@ public:
 	virtual void UpdateTotalDemoTime( uint32 TimeInMS ) = 0;
 	virtual uint32 GetTotalDemoTime() const = 0;
 	virtual bool IsDataAvailable() const = 0;
+
+	/**
+	 * Returns the archive the next checkpoint is written to when recording, or the archive of the checkpoint loaded by
+	 * GotoTimeInMS() when playing back. Returns NULL if the streamer doesn't support checkpoints.
+	 */
+	virtual FArchive* GetCheckpointArchive() = 0;
+
+	/**
+	 * Adds the checkpoint written to the checkpoint archive to the stream's time index, at the current position of the streaming archive.
+	 *
+	 * @param TimeInMS Demo time of the checkpoint
+	 */
+	virtual void FlushCheckpoint( uint32 TimeInMS ) = 0;
+
+	/**
+	 * Loads the last checkpoint at or before TimeInMS, or the first one if they are all later, and moves the streaming archive to the
+	 * data recorded right after it. May execute asynchronously.
+	 *
+	 * @param TimeInMS Demo time to go to
+	 * @param Delegate A delegate that will be executed if bound when the checkpoint is ready
+	 */
+	virtual void GotoTimeInMS( uint32 TimeInMS, const FOnCheckpointReady& Delegate ) = 0;
 	
 	/** Returns true if the given StreamName is a game currently in progress */
 	virtual bool IsLive( const FString& StreamName ) const = 0;
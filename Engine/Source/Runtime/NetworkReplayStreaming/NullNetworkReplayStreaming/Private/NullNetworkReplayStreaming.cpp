@@ -65,6 +65,25 @@ static FString GetMetadataFilename(const FString& StreamName)
 	return GetStreamFullBaseFilename(StreamName) + TEXT(".metadata");
 }
 
+static FString GetCheckpointFilename(const FString& StreamName)
+{
+	return GetStreamFullBaseFilename(StreamName) + TEXT(".checkpoints");
+}
+
+/**
+ * The checkpoint file starts with a magic and version, followed by the checkpoints in the order they were recorded:
+ *	uint32	TimeInMS
+ *	int64	StreamOffset	(position in the demo file where the stream continues after the checkpoint)
+ *	int32	DataSize
+ *	uint8	Data[DataSize]
+ * The entries double as the time index, which is rebuilt by hopping from one entry header to the next when the stream is opened.
+ */
+static const uint32 NULL_REPLAY_CHECKPOINT_MAGIC	= 0x1C4E9F3B;
+static const uint32 NULL_REPLAY_CHECKPOINT_VERSION	= 1;
+
+/** Size of the header of each checkpoint in the checkpoint file */
+static const int64 NULL_REPLAY_CHECKPOINT_HEADER_SIZE = sizeof( uint32 ) + sizeof( int64 ) + sizeof( int32 );
+
 void FNullNetworkReplayStreamer::StartStreaming( const FString& StreamName, bool bRecord, const FString& VersionString, const FOnStreamReadyDelegate& Delegate )
 {
 	// Create a directory for this demo
@@ -90,6 +109,11 @@ void FNullNetworkReplayStreamer::StartStreaming( const FString& StreamName, bool
 		StreamerState = EStreamerState::Recording;
 	}
 
+	if ( FileAr.IsValid() )
+	{
+		OpenCheckpointFile( bRecord );
+	}
+
 	// Notify immediately
 	Delegate.ExecuteIfBound( FileAr.Get() != NULL, bRecord );
 }
@@ -98,6 +122,10 @@ void FNullNetworkReplayStreamer::StopStreaming()
 {
 	FileAr.Reset();
 	MetadataFileAr.Reset();
+	CheckpointFileAr.Reset();
+	CheckpointAr.Reset();
+	CheckpointData.Empty();
+	CheckpointIndex.Empty();
 
 	CurrentStreamName.Empty();
 	StreamerState = EStreamerState::Idle;
@@ -138,6 +166,142 @@ FArchive* FNullNetworkReplayStreamer::GetMetadataArchive()
 	return MetadataFileAr.Get();
 }
 
+void FNullNetworkReplayStreamer::OpenCheckpointFile( bool bRecord )
+{
+	const FString FullCheckpointFilename = GetCheckpointFilename( CurrentStreamName );
+
+	uint32 Magic	= NULL_REPLAY_CHECKPOINT_MAGIC;
+	uint32 Version	= NULL_REPLAY_CHECKPOINT_VERSION;
+
+	if ( bRecord )
+	{
+		CheckpointFileAr.Reset( IFileManager::Get().CreateFileWriter( *FullCheckpointFilename, FILEWRITE_AllowRead ) );
+
+		if ( CheckpointFileAr.IsValid() )
+		{
+			*CheckpointFileAr << Magic;
+			*CheckpointFileAr << Version;
+
+			CheckpointAr.Reset( new FMemoryWriter( CheckpointData ) );
+		}
+		return;
+	}
+
+	// Replays recorded without checkpoints don't have this file, and can't be scrubbed
+	CheckpointFileAr.Reset( IFileManager::Get().CreateFileReader( *FullCheckpointFilename, FILEREAD_Silent ) );
+
+	if ( !CheckpointFileAr.IsValid() )
+	{
+		return;
+	}
+
+	*CheckpointFileAr << Magic;
+	*CheckpointFileAr << Version;
+
+	if ( CheckpointFileAr->IsError() || Magic != NULL_REPLAY_CHECKPOINT_MAGIC || Version != NULL_REPLAY_CHECKPOINT_VERSION )
+	{
+		UE_LOG( LogNullReplay, Warning, TEXT( "Ignoring checkpoint file %s, it is corrupt or from another version" ), *FullCheckpointFilename );
+		CheckpointFileAr.Reset();
+		return;
+	}
+
+	// Build the time index. A recording that didn't finish may end with a partially written checkpoint, which is left out.
+	const int64 TotalSize = CheckpointFileAr->TotalSize();
+
+	while ( CheckpointFileAr->Tell() + NULL_REPLAY_CHECKPOINT_HEADER_SIZE <= TotalSize )
+	{
+		FCheckpointIndexEntry Entry;
+
+		*CheckpointFileAr << Entry.TimeInMS;
+		*CheckpointFileAr << Entry.StreamOffset;
+		*CheckpointFileAr << Entry.DataSize;
+
+		Entry.DataOffset = CheckpointFileAr->Tell();
+
+		if ( CheckpointFileAr->IsError() || Entry.DataSize < 0 || Entry.DataOffset + Entry.DataSize > TotalSize )
+		{
+			break;
+		}
+
+		CheckpointIndex.Add( Entry );
+		CheckpointFileAr->Seek( Entry.DataOffset + Entry.DataSize );
+	}
+
+	UE_LOG( LogNullReplay, Log, TEXT( "Found %i checkpoints in %s" ), CheckpointIndex.Num(), *FullCheckpointFilename );
+}
+
+FArchive* FNullNetworkReplayStreamer::GetCheckpointArchive()
+{
+	return CheckpointAr.Get();
+}
+
+void FNullNetworkReplayStreamer::FlushCheckpoint( uint32 TimeInMS )
+{
+	if ( StreamerState != EStreamerState::Recording || !CheckpointFileAr.IsValid() || !FileAr.IsValid() )
+	{
+		return;
+	}
+
+	FCheckpointIndexEntry Entry;
+	Entry.TimeInMS		= TimeInMS;
+	Entry.StreamOffset	= FileAr->Tell();
+	Entry.DataSize		= CheckpointData.Num();
+
+	*CheckpointFileAr << Entry.TimeInMS;
+	*CheckpointFileAr << Entry.StreamOffset;
+	*CheckpointFileAr << Entry.DataSize;
+
+	Entry.DataOffset = CheckpointFileAr->Tell();
+
+	CheckpointFileAr->Serialize( CheckpointData.GetData(), CheckpointData.Num() );
+	CheckpointFileAr->Flush();
+
+	CheckpointIndex.Add( Entry );
+
+	// Start over for the next checkpoint
+	CheckpointData.Reset();
+	CheckpointAr->Seek( 0 );
+}
+
+void FNullNetworkReplayStreamer::GotoTimeInMS( uint32 TimeInMS, const FOnCheckpointReady& Delegate )
+{
+	if ( StreamerState != EStreamerState::Playback || !CheckpointFileAr.IsValid() || CheckpointIndex.Num() == 0 )
+	{
+		Delegate.ExecuteIfBound( false, 0 );
+		return;
+	}
+
+	// Checkpoints are recorded in time order
+	int32 Index = 0;
+
+	while ( Index + 1 < CheckpointIndex.Num() && CheckpointIndex[Index + 1].TimeInMS <= TimeInMS )
+	{
+		Index++;
+	}
+
+	const FCheckpointIndexEntry& Entry = CheckpointIndex[Index];
+
+	CheckpointAr.Reset();
+	CheckpointData.Reset( Entry.DataSize );
+	CheckpointData.AddUninitialized( Entry.DataSize );
+
+	CheckpointFileAr->Seek( Entry.DataOffset );
+	CheckpointFileAr->Serialize( CheckpointData.GetData(), Entry.DataSize );
+
+	if ( CheckpointFileAr->IsError() )
+	{
+		UE_LOG( LogNullReplay, Warning, TEXT( "Failed to read checkpoint %i of %s" ), Index, *CurrentStreamName );
+		CheckpointData.Empty();
+		Delegate.ExecuteIfBound( false, 0 );
+		return;
+	}
+
+	CheckpointAr.Reset( new FMemoryReader( CheckpointData ) );
+	FileAr->Seek( Entry.StreamOffset );
+
+	Delegate.ExecuteIfBound( true, Entry.TimeInMS );
+}
+
 bool FNullNetworkReplayStreamer::IsLive( const FString& StreamName ) const
 {
 	// If the directory for this stream doesn't exist, it can't possibly be live.
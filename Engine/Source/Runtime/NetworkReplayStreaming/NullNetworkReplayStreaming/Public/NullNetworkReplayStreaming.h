@@ -24,6 +24,9 @@ public:
 	virtual void UpdateTotalDemoTime( uint32 TimeInMS ) override { }
 	virtual uint32 GetTotalDemoTime() const override { return 0; }
 	virtual bool IsDataAvailable() const override { return true; }
+	virtual FArchive* GetCheckpointArchive() override;
+	virtual void FlushCheckpoint( uint32 TimeInMS ) override;
+	virtual void GotoTimeInMS( uint32 TimeInMS, const FOnCheckpointReady& Delegate ) override;
 	virtual bool IsLive( const FString& StreamName ) const override;
 	virtual void DeleteFinishedStream( const FString& StreamName, const FOnDeleteFinishedStreamComplete& Delegate) const override;
 	virtual void EnumerateStreams( const FString& VersionString, const FOnEnumerateStreamsComplete& Delegate ) override;
@@ -35,6 +38,30 @@ private:
 	/* Handle to the archive that will read/write metadata */
 	TUniquePtr<FArchive> MetadataFileAr;
 
+	/** Handle to the archive that will read/write checkpoints */
+	TUniquePtr<FArchive> CheckpointFileAr;
+
+	/** Where a checkpoint is in the checkpoint file, and where the demo stream continues after it */
+	struct FCheckpointIndexEntry
+	{
+		uint32	TimeInMS;
+		int64	StreamOffset;
+		int64	DataOffset;
+		int32	DataSize;
+	};
+
+	/** Time index of the checkpoints in the checkpoint file, in the order they were recorded */
+	TArray<FCheckpointIndexEntry> CheckpointIndex;
+
+	/** Data of the checkpoint being recorded, or of the checkpoint loaded by GotoTimeInMS */
+	TArray<uint8> CheckpointData;
+
+	/** Archive writing or reading CheckpointData, handed out by GetCheckpointArchive */
+	TUniquePtr<FArchive> CheckpointAr;
+
+	/** Opens the checkpoint file of the current stream, and reads its time index when playing back */
+	void OpenCheckpointFile( bool bRecord );
+
 	/** EStreamerState - Overall state of the streamer */
 	enum class EStreamerState
 	{
@@ -7,6 +7,17 @@
 #pragma once
 #include "IpNetDriver.generated.h"
 
+/** A packet queued by UIpNetDriver::QueueSend, until the packets of the frame are sent in a batch */
+struct FIpPendingSend
+{
+	/** Offset of the packet in UIpNetDriver::PendingSendData */
+	int32 Offset;
+	/** Size of the packet */
+	int32 Count;
+	/** The address to send to */
+	TSharedPtr<FInternetAddr> Destination;
+};
+
 UCLASS(transient, config=Engine)
 class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 {
@@ -30,6 +41,21 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	/** Underlying socket communication */
 	FSocket* Socket;
 
+	/** Buffer the incoming packets are read into, a batch at a time */
+	TArray<uint8> RecvBuffer;
+
+	/** Addresses of the senders of the packets in RecvBuffer */
+	TArray<TSharedPtr<FInternetAddr>> RecvAddresses;
+
+	/** Data of the packets queued by QueueSend */
+	TArray<uint8> PendingSendData;
+
+	/** Packets queued by QueueSend */
+	TArray<FIpPendingSend> PendingSends;
+
+	/** Threads receiving and sending the packets of Socket, if net.IpNetDriverIOThread is enabled */
+	class FIpNetIOThread* IOThread;
+
 	// Begin UNetDriver interface.
 	virtual bool IsAvailable() const override;
 	virtual bool InitBase(bool bInitAsClient, FNetworkNotify* InNotify, const FURL& URL, bool bReuseAddressAndPort, FString& Error) override;
@@ -37,6 +63,7 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	virtual bool InitListen( FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error ) override;
 	virtual void ProcessRemoteFunction(class AActor* Actor, class UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, struct FFrame* Stack, class UObject* SubObject = NULL) override;
 	virtual void TickDispatch( float DeltaTime ) override;
+	virtual void TickFlush( float DeltaSeconds ) override;
 	virtual FString LowLevelGetNetworkNumber() override;
 	virtual void LowLevelDestroy() override;
 	virtual class ISocketSubsystem* GetSocketSubsystem() override;
@@ -59,6 +86,19 @@ class ONLINESUBSYSTEMUTILS_API UIpNetDriver : public UNetDriver
 	virtual int GetClientPort();
 	// End UIpNetDriver interface.
 
+	/**
+	 * Queues a packet to be sent by the I/O thread, or with the other packets of this frame by FlushPendingSends if net.IpNetDriverBatchSends is enabled.
+	 *
+	 * @param Data the packet to send, it is copied
+	 * @param Count the size of the packet
+	 * @param Destination the address to send to
+	 * @return true if the packet was queued, false if it should be sent right away
+	 */
+	bool QueueSend( const uint8* Data, int32 Count, const TSharedPtr<FInternetAddr>& Destination );
+
+	/** Sends the packets queued by QueueSend, with as few system calls as the socket allows */
+	void FlushPendingSends();
+
 	// Begin FExec Interface
 	virtual bool Exec( UWorld* InWorld, const TCHAR* Cmd, FOutputDevice& Ar=*GLog ) override;
 	// End FExec Interface
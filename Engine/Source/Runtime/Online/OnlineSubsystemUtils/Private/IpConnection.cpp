@@ -128,11 +128,15 @@ void UIpConnection::LowLevelSend( void* Data, int32 Count )
 			ResolveInfo = NULL;
 		}
 	}
-	// Send to remote.
-	int32 BytesSent = 0;
-	CLOCK_CYCLES(Driver->SendCycles);
-	Socket->SendTo((uint8*)Data, Count, BytesSent, *RemoteAddr);
-	UNCLOCK_CYCLES(Driver->SendCycles);
+	// Send to remote, or let the driver send it with the other packets of this frame.
+	int32 BytesSent = Count;
+	UIpNetDriver* IpDriver = Cast<UIpNetDriver>(Driver);
+	if (!IpDriver || IpDriver->Socket != Socket || !IpDriver->QueueSend((uint8*)Data, Count, RemoteAddr))
+	{
+		CLOCK_CYCLES(Driver->SendCycles);
+		Socket->SendTo((uint8*)Data, Count, BytesSent, *RemoteAddr);
+		UNCLOCK_CYCLES(Driver->SendCycles);
+	}
 	NETWORK_PROFILER(GNetworkProfiler.FlushOutgoingBunches(this));
 	NETWORK_PROFILER(GNetworkProfiler.TrackSocketSendTo(Socket->GetDescription(),Data,BytesSent,NumPacketIdBits,NumBunchBits,NumAckBits,NumPaddingBits,*RemoteAddr));
 }
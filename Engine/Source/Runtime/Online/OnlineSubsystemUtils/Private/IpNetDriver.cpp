@@ -20,6 +20,422 @@ Notes:
 /** Size of the network recv buffer */
 #define NETWORK_MAX_PACKET (576)
 
+/** Number of packets read from the socket at a time */
+#define NETWORK_RECV_BATCH (32)
+
+static TAutoConsoleVariable<int32> CVarNetIpNetDriverBatchSends(
+	TEXT("net.IpNetDriverBatchSends"),
+	1,
+	TEXT("Queues the packets of all connections and sends them together at the end of TickFlush, with as few system calls as the socket allows.\n")
+	TEXT("1 Enables batched sends. 0 sends every packet right away."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarNetIpNetDriverIOThread(
+	TEXT("net.IpNetDriverIOThread"),
+	0,
+	TEXT("Receives and sends the packets of IP net drivers on a thread, which timestamps packets as they arrive so lag is measured without the frame time.\n")
+	TEXT("1 Uses a thread for the net drivers created from now on. 0 receives and sends on the game thread."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarNetIpNetDriverIOThreadMaxReceived(
+	TEXT("net.IpNetDriverIOThreadMaxReceived"),
+	4096,
+	TEXT("Number of received packets the I/O thread queues for the game thread before it drops new packets, for the net drivers created from now on."),
+	ECVF_Default);
+
+/** Number of packets the I/O thread sends at a time */
+#define NETWORK_SEND_BATCH (64)
+
+/** A packet received or to be sent by FIpNetIOThread */
+struct FIpNetIOPacket
+{
+	uint8 Data[NETWORK_MAX_PACKET];
+	/** Size of the packet */
+	int32 Count;
+	/** The address the packet came from or goes to */
+	TSharedRef<FInternetAddr> Address;
+	/** FPlatformTime::Seconds() the packet was received at */
+	double Timestamp;
+	/** Error the socket returned instead of a packet, SE_NO_ERROR for packets */
+	ESocketErrors Error;
+
+	explicit FIpNetIOPacket( const TSharedRef<FInternetAddr>& InAddress )
+		: Count(0)
+		, Address(InAddress)
+		, Timestamp(0.0)
+		, Error(SE_NO_ERROR)
+	{
+	}
+};
+
+/**
+ * Sends the packets a UIpNetDriver queues. The thread sleeps on an event until the game thread queues a packet, so
+ * packets go out as soon as they are queued.
+ */
+class FIpNetSendThread : public FRunnable
+{
+public:
+
+	FIpNetSendThread( FSocket* InSocket, ISocketSubsystem* InSocketSubsystem )
+		: Socket(InSocket)
+		, SocketSubsystem(InSocketSubsystem)
+		, SendEvent(FPlatformProcess::CreateSynchEvent())
+		, bWakePending(0)
+		, bStopping(false)
+	{
+		Thread = FRunnableThread::Create(this, TEXT("IpNetDriverSend"), 64 * 1024, TPri_AboveNormal);
+	}
+
+	~FIpNetSendThread()
+	{
+		if (Thread != NULL)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+		delete SendEvent;
+
+		FIpNetIOPacket* Packet;
+		while (ToSend.Dequeue(Packet))
+		{
+			delete Packet;
+		}
+		while (FreeSent.Dequeue(Packet))
+		{
+			delete Packet;
+		}
+	}
+
+	/** @return true if the thread could be created */
+	bool IsRunning() const
+	{
+		return Thread != NULL;
+	}
+
+	/**
+	 * Queues a packet to be sent by the thread, and wakes it up. Game thread only.
+	 *
+	 * @return false if the packet is too big to be queued
+	 */
+	bool Send( const uint8* Data, int32 Count, const FInternetAddr& Destination )
+	{
+		if (Count > NETWORK_MAX_PACKET)
+		{
+			return false;
+		}
+
+		FIpNetIOPacket* Packet = NULL;
+		if (!FreeSent.Dequeue(Packet))
+		{
+			Packet = new FIpNetIOPacket(SocketSubsystem->CreateInternetAddr());
+		}
+		FMemory::Memcpy(Packet->Data, Data, Count);
+		Packet->Count = Count;
+		// Copy the address, the connection may change or free its own while the packet is queued
+		uint32 Ip = 0;
+		Destination.GetIp(Ip);
+		Packet->Address->SetIp(Ip);
+		Packet->Address->SetPort(Destination.GetPort());
+		ToSend.Enqueue(Packet);
+
+		// Only the first packet queued since the thread woke up has to trigger the event
+		if (FPlatformAtomics::InterlockedExchange(&bWakePending, 1) == 0)
+		{
+			SendEvent->Trigger();
+		}
+		return true;
+	}
+
+	// Begin FRunnable interface.
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			SendEvent->Wait();
+			// Clear the flag before draining, so a packet queued from now on triggers the event again
+			FPlatformAtomics::InterlockedExchange(&bWakePending, 0);
+			SendQueued();
+		}
+
+		// Send what was queued before the thread was stopped.
+		SendQueued();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		SendEvent->Trigger();
+	}
+	// End FRunnable interface
+
+private:
+
+	/** Sends the packets the game thread queued. */
+	void SendQueued()
+	{
+		for (;;)
+		{
+			FIpNetIOPacket* Packets[NETWORK_SEND_BATCH];
+			FSocketDatagram Datagrams[NETWORK_SEND_BATCH];
+			int32 NumPackets = 0;
+			while (NumPackets < NETWORK_SEND_BATCH && ToSend.Dequeue(Packets[NumPackets]))
+			{
+				Datagrams[NumPackets].Data = Packets[NumPackets]->Data;
+				Datagrams[NumPackets].Count = Packets[NumPackets]->Count;
+				Datagrams[NumPackets].BytesTransferred = 0;
+				Datagrams[NumPackets].Address = &Packets[NumPackets]->Address.Get();
+				NumPackets++;
+			}
+			if (NumPackets == 0)
+			{
+				break;
+			}
+
+			int32 NumDone = 0;
+			while (NumDone < NumPackets)
+			{
+				int32 NumSent = 0;
+				Socket->SendToMulti(Datagrams + NumDone, NumPackets - NumDone, NumSent);
+				// Like a single sendto that fails, drop a packet that can't be sent and go on with the rest
+				NumDone += NumSent + (NumDone + NumSent < NumPackets ? 1 : 0);
+			}
+
+			for (int32 i = 0; i < NumPackets; i++)
+			{
+				FreeSent.Enqueue(Packets[i]);
+			}
+		}
+	}
+
+	/** The driver's socket */
+	FSocket* Socket;
+	/** Subsystem of the socket */
+	ISocketSubsystem* SocketSubsystem;
+	/** The thread running this */
+	FRunnableThread* Thread;
+	/** Triggered when packets are queued, or the thread has to exit */
+	FEvent* SendEvent;
+	/** Set when SendEvent was triggered and the thread hasn't woken up yet */
+	volatile int32 bWakePending;
+	/** Set when the thread has to exit */
+	volatile bool bStopping;
+
+	/** Packets the game thread queued to be sent */
+	TQueue<FIpNetIOPacket*, EQueueMode::Spsc> ToSend;
+	/** Sent packets, for the game thread to reuse */
+	TQueue<FIpNetIOPacket*, EQueueMode::Spsc> FreeSent;
+};
+
+/**
+ * Receives the packets of a UIpNetDriver's socket as soon as they arrive and queues them for TickDispatch, and sends
+ * the packets the game thread queues on a FIpNetSendThread. Every queue has a single producer and a single consumer so
+ * neither thread locks, and the packets go back to the thread that fills them through another queue to be reused.
+ */
+class FIpNetIOThread : public FRunnable
+{
+public:
+
+	FIpNetIOThread( FSocket* InSocket, ISocketSubsystem* InSocketSubsystem )
+		: Socket(InSocket)
+		, SocketSubsystem(InSocketSubsystem)
+		, SendThread(InSocket, InSocketSubsystem)
+		, WaitTime(FTimespan::FromMilliseconds(10.0))
+		, MaxReceived(FMath::Max(CVarNetIpNetDriverIOThreadMaxReceived.GetValueOnGameThread(), 1))
+		, NumReceived(0)
+		, NumDropped(0)
+		, bStopping(false)
+	{
+		RecvPackets.AddZeroed(NETWORK_RECV_BATCH);
+		Thread = SendThread.IsRunning() ? FRunnableThread::Create(this, TEXT("IpNetDriverIO"), 128 * 1024, TPri_AboveNormal) : NULL;
+	}
+
+	~FIpNetIOThread()
+	{
+		if (Thread != NULL)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+
+		FIpNetIOPacket* Packet;
+		while (Received.Dequeue(Packet))
+		{
+			delete Packet;
+		}
+		while (FreeReceived.Dequeue(Packet))
+		{
+			delete Packet;
+		}
+		for (FIpNetIOPacket* RecvPacket : RecvPackets)
+		{
+			delete RecvPacket;
+		}
+	}
+
+	/** @return true if the threads could be created */
+	bool IsRunning() const
+	{
+		return Thread != NULL;
+	}
+
+	/**
+	 * Returns the next received packet or socket error, which has to be given back with Release. Game thread only.
+	 *
+	 * @return the packet, or NULL if nothing was received since the last call
+	 */
+	FIpNetIOPacket* Dequeue()
+	{
+		FIpNetIOPacket* Packet = NULL;
+		if (!Received.Dequeue(Packet))
+		{
+			return NULL;
+		}
+		FPlatformAtomics::InterlockedDecrement(&NumReceived);
+		return Packet;
+	}
+
+	/** Gives back a packet returned by Dequeue. Game thread only. */
+	void Release( FIpNetIOPacket* Packet )
+	{
+		FreeReceived.Enqueue(Packet);
+	}
+
+	/** @return the number of packets dropped because the game thread fell behind since the last call. Game thread only. */
+	int32 TakeNumDropped()
+	{
+		return FPlatformAtomics::InterlockedExchange(&NumDropped, 0);
+	}
+
+	/**
+	 * Queues a packet to be sent right away. Game thread only.
+	 *
+	 * @return false if the packet is too big to be queued
+	 */
+	bool Send( const uint8* Data, int32 Count, const FInternetAddr& Destination )
+	{
+		return SendThread.Send(Data, Count, Destination);
+	}
+
+	// Begin FRunnable interface.
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			if (Socket->Wait(ESocketWaitConditions::WaitForRead, WaitTime) && !ReceivePending())
+			{
+				// Don't spin on an error that doesn't go away
+				FPlatformProcess::Sleep(0.001f);
+			}
+		}
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+	}
+	// End FRunnable interface
+
+private:
+
+	/**
+	 * Reads the packets waiting in the socket and queues them for the game thread.
+	 *
+	 * @return false if the socket returned an unexpected error
+	 */
+	bool ReceivePending()
+	{
+		for (;;)
+		{
+			FSocketDatagram Datagrams[NETWORK_RECV_BATCH];
+			for (int32 i = 0; i < NETWORK_RECV_BATCH; i++)
+			{
+				if (RecvPackets[i] == NULL && !FreeReceived.Dequeue(RecvPackets[i]))
+				{
+					RecvPackets[i] = new FIpNetIOPacket(SocketSubsystem->CreateInternetAddr());
+				}
+				Datagrams[i].Data = RecvPackets[i]->Data;
+				Datagrams[i].Count = NETWORK_MAX_PACKET;
+				Datagrams[i].BytesTransferred = 0;
+				Datagrams[i].Address = &RecvPackets[i]->Address.Get();
+			}
+
+			int32 NumRead = 0;
+			const bool bOk = Socket->RecvFromMulti(Datagrams, NETWORK_RECV_BATCH, NumRead);
+			const ESocketErrors Error = bOk ? SE_NO_ERROR : SocketSubsystem->GetLastErrorCode();
+			const double Timestamp = FPlatformTime::Seconds();
+
+			// Datagrams read before an error are still good
+			for (int32 i = 0; i < NumRead; i++)
+			{
+				QueueReceived(i, Datagrams[i].BytesTransferred, Timestamp, SE_NO_ERROR);
+			}
+
+			if (!bOk)
+			{
+				if (Error == SE_EWOULDBLOCK || Error == SE_NO_ERROR)
+				{
+					// The socket is drained
+					return true;
+				}
+
+				// Let the game thread log the error, or close the connection it came from.
+				QueueReceived(NumRead, 0, Timestamp, Error);
+				if (Error != SE_ECONNRESET && Error != SE_UDP_ERR_PORT_UNREACH)
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	/** Queues RecvPackets[Index] for the game thread, or drops it if the game thread has too many packets to process. */
+	void QueueReceived( int32 Index, int32 Count, double Timestamp, ESocketErrors Error )
+	{
+		if (NumReceived >= MaxReceived)
+		{
+			// Keep the packet in RecvPackets to read the next one into
+			FPlatformAtomics::InterlockedIncrement(&NumDropped);
+			return;
+		}
+
+		FIpNetIOPacket* Packet = RecvPackets[Index];
+		Packet->Count = Count;
+		Packet->Timestamp = Timestamp;
+		Packet->Error = Error;
+		FPlatformAtomics::InterlockedIncrement(&NumReceived);
+		Received.Enqueue(Packet);
+		RecvPackets[Index] = NULL;
+	}
+
+	/** The driver's socket */
+	FSocket* Socket;
+	/** Subsystem of the socket */
+	ISocketSubsystem* SocketSubsystem;
+	/** Sends the packets the game thread queues, stopped after this thread */
+	FIpNetSendThread SendThread;
+	/** The thread running this */
+	FRunnableThread* Thread;
+	/** How long to wait for packets before checking if the thread has to exit */
+	FTimespan WaitTime;
+	/** Number of packets Received can hold before new packets are dropped */
+	const int32 MaxReceived;
+	/** Number of packets in Received */
+	volatile int32 NumReceived;
+	/** Number of packets dropped because Received was full, since the game thread last checked */
+	volatile int32 NumDropped;
+	/** Set when the thread has to exit */
+	volatile bool bStopping;
+
+	/** Packets the next receive is read into, owned by the thread */
+	TArray<FIpNetIOPacket*> RecvPackets;
+	/** Received packets, for the game thread */
+	TQueue<FIpNetIOPacket*, EQueueMode::Spsc> Received;
+	/** Received packets the game thread is done with */
+	TQueue<FIpNetIOPacket*, EQueueMode::Spsc> FreeReceived;
+};
+
 UIpNetDriver::UIpNetDriver(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -125,6 +541,17 @@ bool UIpNetDriver::InitBase( bool bInitAsClient, FNetworkNotify* InNotify, const
 		return false;
 	}
 
+	if (CVarNetIpNetDriverIOThread.GetValueOnGameThread() != 0 && FPlatformProcess::SupportsMultithreading())
+	{
+		IOThread = new FIpNetIOThread(Socket, SocketSubsystem);
+		if (!IOThread->IsRunning())
+		{
+			UE_LOG(LogNet, Warning, TEXT("%s: Unable to create the I/O thread, receiving on the game thread"), *GetDescription());
+			delete IOThread;
+			IOThread = NULL;
+		}
+	}
+
 	// Success.
 	return true;
 }
@@ -170,117 +597,245 @@ void UIpNetDriver::TickDispatch( float DeltaTime )
 
 	ISocketSubsystem* SocketSubsystem = GetSocketSubsystem();
 
-	// Process all incoming packets.
-	uint8 Data[NETWORK_MAX_PACKET];
-	TSharedRef<FInternetAddr> FromAddr = SocketSubsystem->CreateInternetAddr();
-	for( ; Socket != NULL; )
+	// Figure out which connection received data came from.
+	auto FindConnection = [this]( const FInternetAddr& FromAddr ) -> UIpConnection*
 	{
-		int32 BytesRead = 0;
-		// Get data, if any.
-		CLOCK_CYCLES(RecvCycles);
-		bool bOk = Socket->RecvFrom(Data, sizeof(Data), BytesRead, *FromAddr);
-		UNCLOCK_CYCLES(RecvCycles);
-		// Handle result.
-		if( bOk == false )
+		if (GetServerConnection() && (*GetServerConnection()->RemoteAddr == FromAddr))
 		{
-			ESocketErrors Error = SocketSubsystem->GetLastErrorCode();
-			if(Error == SE_EWOULDBLOCK ||
-			   Error == SE_NO_ERROR)
-			{
-				// No data or no error?
-				break;
-			}
-			else
+			return GetServerConnection();
+		}
+		for( int32 i=0; i<ClientConnections.Num(); i++ )
+		{
+			UIpConnection* TestConnection = (UIpConnection*)ClientConnections[i]; 
+			check(TestConnection);
+			if(*TestConnection->RemoteAddr == FromAddr)
 			{
-				if( Error != SE_ECONNRESET && Error != SE_UDP_ERR_PORT_UNREACH )
-				{
-					UE_LOG(LogNet, Warning, TEXT("UDP recvfrom error: %i (%s) from %s"),
-						(int32)Error,
-						SocketSubsystem->GetSocketError(Error),
-						*FromAddr->ToString(true));
-					break;
-				}
+				return TestConnection;
 			}
 		}
-		// Figure out which socket the received data came from.
-		UIpConnection* Connection = NULL;
-		if (GetServerConnection() && (*GetServerConnection()->RemoteAddr == *FromAddr))
+		return NULL;
+	};
+
+	// Handle a receive error, returns false if no more packets should be read this frame.
+	auto HandleRecvError = [&]( ESocketErrors Error, const FInternetAddr& FromAddr ) -> bool
+	{
+		if(Error == SE_EWOULDBLOCK ||
+		   Error == SE_NO_ERROR)
 		{
-			Connection = GetServerConnection();
+			// No data or no error?
+			return false;
 		}
-		for( int32 i=0; i<ClientConnections.Num() && !Connection; i++ )
+		else
 		{
-			UIpConnection* TestConnection = (UIpConnection*)ClientConnections[i]; 
-            check(TestConnection);
-			if(*TestConnection->RemoteAddr == *FromAddr)
+			if( Error != SE_ECONNRESET && Error != SE_UDP_ERR_PORT_UNREACH )
 			{
-				Connection = TestConnection;
+				UE_LOG(LogNet, Warning, TEXT("UDP recvfrom error: %i (%s) from %s"),
+					(int32)Error,
+					SocketSubsystem->GetSocketError(Error),
+					*FromAddr.ToString(true));
+				return false;
 			}
 		}
 
-		if( bOk == false )
+		UIpConnection* Connection = FindConnection(FromAddr);
+		if( Connection )
 		{
-			if( Connection )
+			if( Connection != GetServerConnection() )
 			{
-				if( Connection != GetServerConnection() )
+				// We received an ICMP port unreachable from the client, meaning the client is no longer running the game
+				// (or someone is trying to perform a DoS attack on the client)
+
+				// rcg08182002 Some buggy firewalls get occasional ICMP port
+				// unreachable messages from legitimate players. Still, this code
+				// will drop them unceremoniously, so there's an option in the .INI
+				// file for servers with such flakey connections to let these
+				// players slide...which means if the client's game crashes, they
+				// might get flooded to some degree with packets until they timeout.
+				// Either way, this should close up the usual DoS attacks.
+				if ((Connection->State != USOCK_Open) || (!AllowPlayerPortUnreach))
 				{
-					// We received an ICMP port unreachable from the client, meaning the client is no longer running the game
-					// (or someone is trying to perform a DoS attack on the client)
-
-					// rcg08182002 Some buggy firewalls get occasional ICMP port
-					// unreachable messages from legitimate players. Still, this code
-					// will drop them unceremoniously, so there's an option in the .INI
-					// file for servers with such flakey connections to let these
-					// players slide...which means if the client's game crashes, they
-					// might get flooded to some degree with packets until they timeout.
-					// Either way, this should close up the usual DoS attacks.
-					if ((Connection->State != USOCK_Open) || (!AllowPlayerPortUnreach))
+					if (LogPortUnreach)
 					{
-						if (LogPortUnreach)
-						{
-							UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from client %s.  Disconnecting."),
-								*FromAddr->ToString(true));
-						}
-						Connection->CleanUp();
+						UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from client %s.  Disconnecting."),
+							*FromAddr.ToString(true));
 					}
+					Connection->CleanUp();
 				}
 			}
-			else
+		}
+		else
+		{
+			if (LogPortUnreach)
 			{
-				if (LogPortUnreach)
-				{
-					UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from %s.  No matching connection found."),
-						*FromAddr->ToString(true));
-				}
+				UE_LOG(LogNet, Log, TEXT("Received ICMP port unreachable from %s.  No matching connection found."),
+					*FromAddr.ToString(true));
 			}
 		}
-		else
+		return true;
+	};
+
+	// Give a packet to its connection, a timestamp of 0 means the packet wasn't timestamped when it arrived.
+	auto ReceivePacket = [&]( uint8* Data, int32 Count, const FInternetAddr& FromAddr, double Timestamp )
+	{
+		UIpConnection* Connection = FindConnection(FromAddr);
+
+		// If we didn't find a client connection, maybe create a new one.
+		if( !Connection )
 		{
-			// If we didn't find a client connection, maybe create a new one.
-			if( !Connection )
+			// Determine if allowing for client/server connections
+			const bool bAcceptingConnection = Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept;
+
+			if (bAcceptingConnection)
 			{
-				// Determine if allowing for client/server connections
-				const bool bAcceptingConnection = Notify->NotifyAcceptingConnection() == EAcceptConnection::Accept;
+				Connection = NewObject<UIpConnection>(GetTransientPackage(), NetConnectionClass);
+				check(Connection);
+				Connection->InitRemoteConnection( this, Socket,  FURL(), FromAddr, USOCK_Open);
+				Notify->NotifyAcceptedConnection( Connection );
+				AddClientConnection(Connection);
+			}
+		}
 
-				if (bAcceptingConnection)
-				{
-					Connection = NewObject<UIpConnection>(GetTransientPackage(), NetConnectionClass);
-                    check(Connection);
-					Connection->InitRemoteConnection( this, Socket,  FURL(), *FromAddr, USOCK_Open);
-					Notify->NotifyAcceptedConnection( Connection );
-					AddClientConnection(Connection);
-				}
+		// Send the packet to the connection for processing.
+		if( Connection )
+		{
+			Connection->PacketReceiveTime = Timestamp;
+			Connection->ReceivedRawPacket( Data, Count );
+			Connection->PacketReceiveTime = 0.0;
+		}
+	};
+
+	// Process the packets the I/O thread received since the last frame.
+	if (IOThread)
+	{
+		while (FIpNetIOPacket* Packet = IOThread->Dequeue())
+		{
+			if (Packet->Error != SE_NO_ERROR)
+			{
+				HandleRecvError(Packet->Error, *Packet->Address);
 			}
+			else
+			{
+				ReceivePacket(Packet->Data, Packet->Count, *Packet->Address, Packet->Timestamp);
+			}
+			IOThread->Release(Packet);
+		}
+
+		if (const int32 NumDropped = IOThread->TakeNumDropped())
+		{
+			UE_LOG(LogNet, Warning, TEXT("%s: Dropped %i packets received while the game thread fell behind"), *GetDescription(), NumDropped);
+		}
+		return;
+	}
+
+	// Set up the buffers to read a batch of packets into.
+	if (RecvAddresses.Num() == 0)
+	{
+		RecvBuffer.AddUninitialized(NETWORK_RECV_BATCH * NETWORK_MAX_PACKET);
+		for (int32 i = 0; i < NETWORK_RECV_BATCH; i++)
+		{
+			RecvAddresses.Add(SocketSubsystem->CreateInternetAddr());
+		}
+	}
+	FSocketDatagram Datagrams[NETWORK_RECV_BATCH];
+	for (int32 i = 0; i < NETWORK_RECV_BATCH; i++)
+	{
+		Datagrams[i].Data = RecvBuffer.GetData() + i * NETWORK_MAX_PACKET;
+		Datagrams[i].Count = NETWORK_MAX_PACKET;
+		Datagrams[i].BytesTransferred = 0;
+		Datagrams[i].Address = RecvAddresses[i].Get();
+	}
+
+	// Process all incoming packets.
+	for( ; Socket != NULL; )
+	{
+		int32 NumRead = 0;
+		// Get data, if any.
+		CLOCK_CYCLES(RecvCycles);
+		bool bOk = Socket->RecvFromMulti(Datagrams, NETWORK_RECV_BATCH, NumRead);
+		const ESocketErrors Error = bOk ? SE_NO_ERROR : SocketSubsystem->GetLastErrorCode();
+		UNCLOCK_CYCLES(RecvCycles);
 
-			// Send the packet to the connection for processing.
-			if( Connection )
+		// Datagrams read before an error are still good.
+		for( int32 DatagramIndex = 0; DatagramIndex < NumRead; DatagramIndex++ )
+		{
+			const FSocketDatagram& Datagram = Datagrams[DatagramIndex];
+			ReceivePacket( Datagram.Data, Datagram.BytesTransferred, *Datagram.Address, 0.0 );
+		}
+
+		// Handle result. Only would-block means the socket is drained.
+		if( bOk == false )
+		{
+			if (!HandleRecvError(Error, *Datagrams[NumRead].Address))
 			{
-				Connection->ReceivedRawPacket( Data, BytesRead );
+				break;
 			}
 		}
 	}
 }
 
+void UIpNetDriver::TickFlush( float DeltaSeconds )
+{
+	Super::TickFlush( DeltaSeconds );
+
+	// Send the packets the connections queued while they were ticked.
+	FlushPendingSends();
+}
+
+bool UIpNetDriver::QueueSend( const uint8* Data, int32 Count, const TSharedPtr<FInternetAddr>& Destination )
+{
+	if (IOThread)
+	{
+		return IOThread->Send(Data, Count, *Destination);
+	}
+
+	if (CVarNetIpNetDriverBatchSends.GetValueOnGameThread() == 0 || !Socket)
+	{
+		return false;
+	}
+
+	FIpPendingSend& PendingSend = *new(PendingSends) FIpPendingSend;
+	PendingSend.Offset = PendingSendData.Num();
+	PendingSend.Count = Count;
+	PendingSend.Destination = Destination;
+	PendingSendData.Append(Data, Count);
+	return true;
+}
+
+void UIpNetDriver::FlushPendingSends()
+{
+	if (PendingSends.Num() == 0)
+	{
+		return;
+	}
+
+	if (Socket)
+	{
+		TArray<FSocketDatagram, TInlineAllocator<64>> Datagrams;
+		Datagrams.AddUninitialized(PendingSends.Num());
+		for (int32 i = 0; i < PendingSends.Num(); i++)
+		{
+			Datagrams[i].Data = PendingSendData.GetData() + PendingSends[i].Offset;
+			Datagrams[i].Count = PendingSends[i].Count;
+			Datagrams[i].BytesTransferred = 0;
+			Datagrams[i].Address = PendingSends[i].Destination.Get();
+		}
+
+		CLOCK_CYCLES(SendCycles);
+		int32 NumDone = 0;
+		while (NumDone < Datagrams.Num())
+		{
+			int32 NumSent = 0;
+			Socket->SendToMulti(Datagrams.GetData() + NumDone, Datagrams.Num() - NumDone, NumSent);
+			// Like a single sendto that fails, drop a packet that can't be sent and go on with the rest
+			NumDone += NumSent + (NumDone + NumSent < Datagrams.Num() ? 1 : 0);
+		}
+		UNCLOCK_CYCLES(SendCycles);
+	}
+
+	PendingSends.Reset();
+	PendingSendData.Reset();
+}
+
 void UIpNetDriver::ProcessRemoteFunction(class AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack, class UObject* SubObject )
 {
 	bool bIsServer = IsServer();
@@ -345,6 +900,16 @@ void UIpNetDriver::LowLevelDestroy()
 {
 	Super::LowLevelDestroy();
 
+	// Send what the connections queued while they were closed.
+	FlushPendingSends();
+
+	// Stop the I/O thread, which sends what is left in its queue, before the socket goes away.
+	if (IOThread)
+	{
+		delete IOThread;
+		IOThread = NULL;
+	}
+
 	// Close the socket.
 	if( Socket && !HasAnyFlags(RF_ClassDefaultObject) )
 	{
@@ -268,6 +268,56 @@ FPakFile::FPakFile(FArchive* Archive)
 
 FPakFile::~FPakFile()
 {
+	checkf(NumMappedHandles.GetValue() == 0, TEXT("Pak file %s destroyed with %d mapped handles still open"), *PakFilename, NumMappedHandles.GetValue());
+}
+
+bool FPakFile::MapPakFile(IPlatformFile* LowerLevel)
+{
+	if (bSigned || !bIsValid)
+	{
+		return false;
+	}
+	if (!MappedRegion.IsValid())
+	{
+		MappedFile = LowerLevel->OpenMapped(*PakFilename);
+		if (MappedFile.IsValid())
+		{
+			MappedRegion = MappedFile->MapRegion();
+			if (!MappedRegion.IsValid() || MappedRegion->GetMappedSize() != MappedFile->GetFileSize())
+			{
+				MappedRegion.Reset();
+				MappedFile.Reset();
+			}
+		}
+	}
+	return MappedRegion.IsValid();
+}
+
+const uint8* FPakFile::GetMappedEntryData(const FPakEntry& Entry) const
+{
+	if (!MappedRegion.IsValid() || Entry.bEncrypted || (Entry.CompressionMethod != COMPRESS_None && Info.Version >= FPakInfo::PakFile_Version_CompressionEncryption))
+	{
+		return NULL;
+	}
+	const int64 OffsetToFile = Entry.Offset + Entry.GetSerializedSize(Info.Version);
+	if (Entry.Offset < 0 || OffsetToFile + Entry.Size > MappedRegion->GetMappedSize())
+	{
+		return NULL;
+	}
+	const uint8* EntryHeader = MappedRegion->GetMappedPtr() + Entry.Offset;
+	if (!Entry.Verified)
+	{
+		// Same check FPakFileHandle does before its first read
+		FPakEntry FileHeader;
+		FBufferReader HeaderReader((void*)EntryHeader, OffsetToFile - Entry.Offset, false);
+		FileHeader.Serialize(HeaderReader, Info.Version);
+		if (!FPakEntry::VerifyPakEntriesMatch(Entry, FileHeader))
+		{
+			return NULL;
+		}
+		Entry.Verified = true;
+	}
+	return MappedRegion->GetMappedPtr() + OffsetToFile;
 }
 
 FArchive* FPakFile::CreatePakReader(const TCHAR* Filename)
@@ -505,6 +555,7 @@ void FPakPlatformFile::HandlePakListCommand(const TCHAR* Cmd, FOutputDevice& Ar)
 FPakPlatformFile::FPakPlatformFile()
 	: LowerLevel(NULL)
 	, bSigned(false)
+	, bMapPakFiles(false)
 {
 }
 
@@ -651,6 +702,9 @@ bool FPakPlatformFile::Initialize(IPlatformFile* Inner, const TCHAR* CmdLine)
 #else
 	bSigned = true;
 #endif
+
+	// Memory mapping bypasses the signed archive reader so it's only available for unsigned paks.
+	bMapPakFiles = !bSigned && FParse::Param(CmdLine, TEXT("MMapPaks"));
 	
 	TArray<FString> PaksToLoad;
 #if !UE_BUILD_SHIPPING
@@ -706,6 +760,10 @@ bool FPakPlatformFile::Mount(const TCHAR* InPakFilename, uint32 PakOrder, const
 			{
 				Pak->SetMountPoint(InPath);
 			}
+			if (bMapPakFiles && !Pak->MapPakFile(LowerLevel))
+			{
+				UE_LOG(LogPakFile, Log, TEXT("Unable to memory map pak \"%s\", falling back to regular reads."), InPakFilename);
+			}
 			{
 				// Add new pak file
 				FScopeLock ScopedLock(&PakListCritical);
@@ -738,6 +796,13 @@ bool FPakPlatformFile::Unmount(const TCHAR* InPakFilename)
 		{
 			if (PakFiles[PakIndex].PakFile->GetFilename() == InPakFilename)
 			{
+				// Handles reading straight from the mapping would be left pointing at unmapped memory.
+				const int32 NumMappedHandles = PakFiles[PakIndex].PakFile->GetNumMappedHandles().GetValue();
+				if (NumMappedHandles > 0)
+				{
+					UE_LOG(LogPakFile, Warning, TEXT("Unable to unmount pak \"%s\", %d memory mapped handles are still open."), InPakFilename, NumMappedHandles);
+					return false;
+				}
 				delete PakFiles[PakIndex].PakFile;
 				PakFiles.RemoveAt(PakIndex);
 				return true;
@@ -748,9 +813,145 @@ bool FPakPlatformFile::Unmount(const TCHAR* InPakFilename)
 	return false;
 }
 
+/**
+ * File handle reading an uncompressed file straight out of a memory mapped pak file.
+ */
+class FPakMappedFileHandle : public IFileHandle
+{
+	/** Pak file the data is mapped from. */
+	const FPakFile& PakFile;
+	/** First byte of the file data in the mapping. */
+	const uint8* Data;
+	/** File size. */
+	int64 FileSize;
+	/** Current read position. */
+	int64 ReadPos;
+
+public:
+
+	FPakMappedFileHandle(const FPakFile& InPakFile, const uint8* InData, int64 InFileSize)
+		: PakFile(InPakFile)
+		, Data(InData)
+		, FileSize(InFileSize)
+		, ReadPos(0)
+	{
+		PakFile.GetNumMappedHandles().Increment();
+	}
+
+	virtual ~FPakMappedFileHandle()
+	{
+		PakFile.GetNumMappedHandles().Decrement();
+	}
+
+	// BEGIN IFileHandle Interface
+	virtual int64 Tell() override
+	{
+		return ReadPos;
+	}
+	virtual bool Seek(int64 NewPosition) override
+	{
+		if (NewPosition > FileSize || NewPosition < 0)
+		{
+			return false;
+		}
+		ReadPos = NewPosition;
+		return true;
+	}
+	virtual bool SeekFromEnd(int64 NewPositionRelativeToEnd) override
+	{
+		return Seek(FileSize - NewPositionRelativeToEnd);
+	}
+	virtual bool Read(uint8* Destination, int64 BytesToRead) override
+	{
+		if (BytesToRead < 0 || FileSize < (ReadPos + BytesToRead))
+		{
+			return false;
+		}
+		FMemory::Memcpy(Destination, Data + ReadPos, BytesToRead);
+		ReadPos += BytesToRead;
+		return true;
+	}
+	virtual bool Write(const uint8* Source, int64 BytesToWrite) override
+	{
+		// Writing in pak files is not allowed.
+		return false;
+	}
+	virtual int64 Size() override
+	{
+		return FileSize;
+	}
+	/// END IFileHandle Interface
+};
+
+/**
+ * Mapped file handle for an uncompressed file in a memory mapped pak file. Regions are views into the pak mapping.
+ */
+class FPakMappedEntryHandle : public IMappedFileHandle
+{
+	/** View into the pak mapping, counted by the owning handle. */
+	class FPakMappedEntryRegion : public IMappedFileRegion
+	{
+	public:
+		FPakMappedEntryRegion(FPakMappedEntryHandle& InOwner, const uint8* InMappedPtr, int64 InMappedSize)
+			: IMappedFileRegion(InMappedPtr, InMappedSize)
+			, Owner(InOwner)
+		{
+			Owner.NumOutstandingRegions.Increment();
+		}
+
+		virtual ~FPakMappedEntryRegion()
+		{
+			Owner.NumOutstandingRegions.Decrement();
+		}
+
+	private:
+		FPakMappedEntryHandle& Owner;
+	};
+
+	/** Pak file the data is mapped from. */
+	const FPakFile& PakFile;
+	/** First byte of the file data in the mapping. */
+	const uint8* Data;
+	/** Number of regions that still point into the mapping. */
+	FThreadSafeCounter NumOutstandingRegions;
+
+public:
+
+	FPakMappedEntryHandle(const FPakFile& InPakFile, const uint8* InData, int64 InFileSize)
+		: IMappedFileHandle(InFileSize)
+		, PakFile(InPakFile)
+		, Data(InData)
+	{
+		PakFile.GetNumMappedHandles().Increment();
+	}
+
+	virtual ~FPakMappedEntryHandle()
+	{
+		checkf(NumOutstandingRegions.GetValue() == 0, TEXT("Mapped file closed with %d regions still open"), NumOutstandingRegions.GetValue());
+		PakFile.GetNumMappedHandles().Decrement();
+	}
+
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap) override
+	{
+		if (Offset < 0 || Offset > GetFileSize() || BytesToMap < 0)
+		{
+			return NULL;
+		}
+		return new FPakMappedEntryRegion(*this, Data + Offset, FMath::Min(BytesToMap, GetFileSize() - Offset));
+	}
+};
+
 IFileHandle* FPakPlatformFile::CreatePakFileHandle(const TCHAR* Filename, FPakFile* PakFile, const FPakEntry* FileEntry)
 {
 	IFileHandle* Result = NULL;
+
+	// Uncompressed files in mapped paks don't need a reader at all.
+	const uint8* MappedData = PakFile->GetMappedEntryData(*FileEntry);
+	if (MappedData)
+	{
+		return new FPakMappedFileHandle(*PakFile, MappedData, FileEntry->Size);
+	}
+
 	FArchive* PakReader = PakFile->GetSharedReader(LowerLevel);
 
 	// Create the handle.
@@ -806,6 +1007,24 @@ IFileHandle* FPakPlatformFile::OpenRead(const TCHAR* Filename)
 	return Result;
 }
 
+IMappedFileHandle* FPakPlatformFile::OpenMapped(const TCHAR* Filename)
+{
+	IMappedFileHandle* Result = NULL;
+	FPakFile* PakFile = NULL;
+	const FPakEntry* FileEntry = FindFileInPakFiles(Filename, &PakFile);
+	if (FileEntry != NULL)
+	{
+		// Compressed or encrypted files, and files in paks that aren't mapped, have to be read with OpenRead.
+		const uint8* MappedData = PakFile->GetMappedEntryData(*FileEntry);
+		if (MappedData)
+		{
+			Result = new FPakMappedEntryHandle(*PakFile, MappedData, FileEntry->Size);
+		}
+	}
+	// Files outside of pak files aren't mapped, that would create a new mapping for every request.
+	return Result;
+}
+
 bool FPakPlatformFile::BufferedCopyFile(IFileHandle& Dest, IFileHandle& Source, const int64 FileSize, uint8* Buffer, const int64 BufferSize) const
 {	
 	int64 RemainingSizeToCopy = FileSize;
@@ -272,6 +272,12 @@ class PAKFILE_API FPakFile : FNoncopyable
 	bool bSigned;
 	/** True if this pak file is valid and usable */
 	bool bIsValid;
+	/** Memory mapped pak file, only valid if the pak was mapped with MapPakFile. */
+	TAutoPtr<IMappedFileHandle> MappedFile;
+	/** Region covering the whole mapped pak file. Declared after MappedFile so that it's unmapped first. */
+	TAutoPtr<IMappedFileRegion> MappedRegion;
+	/** Number of open file handles reading from the mapping. The pak file can't be unmounted while there are any. */
+	mutable FThreadSafeCounter NumMappedHandles;
 
 	FArchive* CreatePakReader(const TCHAR* Filename);
 	FArchive* CreatePakReader(IFileHandle& InHandle, const TCHAR* Filename);
@@ -342,6 +348,44 @@ public:
 	 */
 	FArchive* GetSharedReader(IPlatformFile* LowerLevel);
 
+	/**
+	 * Memory maps the whole pak file. Signed pak files can't be mapped as their data has to go through the signature check.
+	 *
+	 * @param LowerLevel Lower level platform file.
+	 * @return true if the pak file is mapped.
+	 */
+	bool MapPakFile(IPlatformFile* LowerLevel);
+
+	/**
+	 * Checks if the pak file has been memory mapped.
+	 *
+	 * @return true if the pak file is mapped.
+	 */
+	bool IsMapped() const
+	{
+		return MappedRegion.IsValid();
+	}
+
+	/**
+	 * Gets the number of open file handles reading from the mapping. Handles returned for entries in this pak file
+	 * by OpenRead and OpenMapped add themselves when created and remove themselves when deleted.
+	 *
+	 * @return Number of open mapped handles.
+	 */
+	FThreadSafeCounter& GetNumMappedHandles() const
+	{
+		return NumMappedHandles;
+	}
+
+	/**
+	 * Gets the mapped data of a pak entry. Only uncompressed, unencrypted entries can be read directly from the mapping.
+	 * The entry header is verified on first access.
+	 *
+	 * @param Entry Entry in this pak file.
+	 * @return Pointer to the first byte of the file data or NULL if the entry can't be read from the mapping.
+	 */
+	const uint8* GetMappedEntryData(const FPakEntry& Entry) const;
+
 	/**
 	 * Finds an entry in the pak file matching the given filename.
 	 *
@@ -804,6 +848,8 @@ class PAKFILE_API FPakPlatformFile : public IPlatformFile
 	TArray<FPakListEntry> PakFiles;
 	/** True if this we're using signed content. */
 	bool bSigned;
+	/** True if pak files should be memory mapped when mounted (-MMapPaks). */
+	bool bMapPakFiles;
 	/** Synchronization object for accessing the list of currently mounted pak files. */
 	FCriticalSection PakListCritical;
 
@@ -1118,6 +1164,12 @@ public:
 
 	virtual IFileHandle* OpenRead(const TCHAR* Filename) override;
 
+	/**
+	 * Opens a file for memory mapped reading. Only uncompressed files in pak files mapped with -MMapPaks can be opened, they
+	 * are returned as views into the mapping made when the pak was mounted. Unmount fails while any such handle is open.
+	 */
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) override;
+
 	virtual IFileHandle* OpenWrite(const TCHAR* Filename, bool bAppend = false, bool bAllowRead = false) override
 	{
 		// No modifications allowed on pak files.
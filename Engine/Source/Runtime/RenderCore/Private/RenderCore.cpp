@@ -35,6 +35,7 @@ DEFINE_STAT(STAT_ProjectedShadowDrawTime);
 DEFINE_STAT(STAT_LightingDrawTime);
 DEFINE_STAT(STAT_DynamicPrimitiveDrawTime);
 DEFINE_STAT(STAT_StaticDrawListDrawTime);
+DEFINE_STAT(STAT_StaticDrawListParallelDrawTime);
 DEFINE_STAT(STAT_BasePassDrawTime);
 DEFINE_STAT(STAT_DepthDrawTime);
 DEFINE_STAT(STAT_DynamicShadowSetupTime);
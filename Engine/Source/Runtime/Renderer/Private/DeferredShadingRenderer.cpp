@@ -277,16 +277,18 @@ void FDeferredShadingSceneRenderer::SortBasePassStaticData(FVector ViewPosition)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_SortStaticDrawLists);
 
+		TArray<FStaticMeshDrawListBase*, SceneRenderingAllocator> DrawLists;
 		for (int32 DrawType = 0; DrawType < FScene::EBasePass_MAX; DrawType++)
 		{
-			Scene->BasePassNoLightMapDrawList[DrawType].SortFrontToBack(ViewPosition);
-			Scene->BasePassSimpleDynamicLightingDrawList[DrawType].SortFrontToBack(ViewPosition);
-			Scene->BasePassCachedVolumeIndirectLightingDrawList[DrawType].SortFrontToBack(ViewPosition);
-			Scene->BasePassCachedPointIndirectLightingDrawList[DrawType].SortFrontToBack(ViewPosition);
-			Scene->BasePassHighQualityLightMapDrawList[DrawType].SortFrontToBack(ViewPosition);
-			Scene->BasePassDistanceFieldShadowMapLightMapDrawList[DrawType].SortFrontToBack(ViewPosition);
-			Scene->BasePassLowQualityLightMapDrawList[DrawType].SortFrontToBack(ViewPosition);
+			DrawLists.Add(&Scene->BasePassNoLightMapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassSimpleDynamicLightingDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassCachedVolumeIndirectLightingDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassCachedPointIndirectLightingDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassHighQualityLightMapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassDistanceFieldShadowMapLightMapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassLowQualityLightMapDrawList[DrawType]);
 		}
+		FStaticMeshDrawListBase::SortDrawListsFrontToBack(DrawLists, ViewPosition);
 	}
 }
 
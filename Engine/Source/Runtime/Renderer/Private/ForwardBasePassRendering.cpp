@@ -336,19 +336,21 @@ void FForwardShadingSceneRenderer::RenderForwardShadingBasePass(FRHICommandListI
 	{
 		SCOPE_CYCLE_COUNTER(STAT_SortStaticDrawLists);
 
+		TArray<FStaticMeshDrawListBase*, SceneRenderingAllocator> DrawLists;
 		for (int32 DrawType = 0; DrawType < FScene::EBasePass_MAX; DrawType++)
 		{
-			Scene->BasePassForForwardShadingNoLightMapDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingLowQualityLightMapDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingDistanceFieldShadowMapLightMapDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingDirectionalLightAndSHIndirectDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingDirectionalLightAndSHDirectionalIndirectDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingDirectionalLightAndSHDirectionalCSMIndirectDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingMovableDirectionalLightDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingMovableDirectionalLightCSMDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingMovableDirectionalLightLightmapDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
-			Scene->BasePassForForwardShadingMovableDirectionalLightCSMLightmapDrawList[DrawType].SortFrontToBack(Views[0].ViewLocation);
+			DrawLists.Add(&Scene->BasePassForForwardShadingNoLightMapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingLowQualityLightMapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingDistanceFieldShadowMapLightMapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingDirectionalLightAndSHIndirectDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingDirectionalLightAndSHDirectionalIndirectDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingDirectionalLightAndSHDirectionalCSMIndirectDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingMovableDirectionalLightDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingMovableDirectionalLightCSMDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingMovableDirectionalLightLightmapDrawList[DrawType]);
+			DrawLists.Add(&Scene->BasePassForForwardShadingMovableDirectionalLightCSMLightmapDrawList[DrawType]);
 		}
+		FStaticMeshDrawListBase::SortDrawListsFrontToBack(DrawLists, Views[0].ViewLocation);
 	}
 
 	// Draw the scene's emissive and light-map color.
@@ -208,6 +208,7 @@ void FPrimitiveSceneInfo::AddToScene(FRHICommandListImmediate& RHICmdList, bool
 	PrimitiveBounds.BoxExtent = BoxSphereBounds.BoxExtent;
 	PrimitiveBounds.MinDrawDistanceSq = FMath::Square(Proxy->GetMinDrawDistance());
 	PrimitiveBounds.MaxDrawDistance = Proxy->GetMaxDrawDistance();
+	Scene->PrimitiveCullingBounds.Set(PackedIndex, PrimitiveBounds);
 
 	// Store precomputed visibility ID.
 	int32 VisibilityBitIndex = Proxy->GetVisibilityId();
@@ -231,6 +232,10 @@ void FPrimitiveSceneInfo::AddToScene(FRHICommandListImmediate& RHICmdList, bool
 	{
 		OcclusionFlags |= EOcclusionFlags::HasPrecomputedVisibility;
 	}
+	if (Proxy->ShouldUseAsOccluder() && Proxy->GetOccluderMeshData())
+	{
+		OcclusionFlags |= EOcclusionFlags::IsSoftwareOccluder;
+	}
 	Scene->PrimitiveOcclusionFlags[PackedIndex] = OcclusionFlags;
 
 	// Store occlusion bounds.
@@ -0,0 +1,77 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SceneFrustumCull.h: Frustum culling of the scene primitives, one at a time or four at a time.
+=============================================================================*/
+
+#pragma once
+
+/** What frustum culling needs to know about the view, worked out once for all of the primitives. */
+struct FFrustumCullParams
+{
+	FVector ViewOrigin;
+	float MaxDrawDistanceScale;
+	float FadeRadius;
+	/** Set when the max draw distance of everything but detail meshes is ignored. */
+	bool bDisableDistanceCulling;
+	uint8 CustomVisibilityFlags;
+	const FConvexVolume* ViewFrustum;
+	/** Only used when culling with UseCustomCulling. */
+	ICustomVisibilityQuery* CustomVisibilityQuery;
+
+	/** Culls against the frustum of View, with its draw distance settings and custom visibility query. */
+	FFrustumCullParams(const FViewInfo& View);
+
+	/** Culls against InViewFrustum from InViewOrigin, with draw distances applied as they are and no custom visibility query. */
+	FFrustumCullParams(const FConvexVolume& InViewFrustum, const FVector& InViewOrigin, float InFadeRadius)
+		: ViewOrigin(InViewOrigin)
+		, MaxDrawDistanceScale(1.0f)
+		, FadeRadius(InFadeRadius)
+		, bDisableDistanceCulling(false)
+		, CustomVisibilityFlags(EOcclusionFlags::CanBeOccluded | EOcclusionFlags::HasPrecomputedVisibility)
+		, ViewFrustum(&InViewFrustum)
+		, CustomVisibilityQuery(nullptr)
+	{}
+};
+
+/** The primitive bounds frustum culling reads and the visibility maps of the view it writes. */
+struct FFrustumCullArrays
+{
+	/** Only used to look up proxies when distance culling is disabled, and visibility ids for the custom visibility query. */
+	const FScene* Scene;
+	const TArray<FPrimitiveBounds>& PrimitiveBounds;
+	const FPrimitiveCullingBounds& PrimitiveCullingBounds;
+	FSceneBitArray& PrimitiveVisibilityMap;
+	FSceneBitArray& PotentiallyFadingPrimitiveMap;
+
+	FFrustumCullArrays(const FScene* InScene, FViewInfo& View)
+		: Scene(InScene)
+		, PrimitiveBounds(InScene->PrimitiveBounds)
+		, PrimitiveCullingBounds(InScene->PrimitiveCullingBounds)
+		, PrimitiveVisibilityMap(View.PrimitiveVisibilityMap)
+		, PotentiallyFadingPrimitiveMap(View.PotentiallyFadingPrimitiveMap)
+	{}
+
+	FFrustumCullArrays(const TArray<FPrimitiveBounds>& InPrimitiveBounds, const FPrimitiveCullingBounds& InPrimitiveCullingBounds, FSceneBitArray& InPrimitiveVisibilityMap, FSceneBitArray& InPotentiallyFadingPrimitiveMap)
+		: Scene(nullptr)
+		, PrimitiveBounds(InPrimitiveBounds)
+		, PrimitiveCullingBounds(InPrimitiveCullingBounds)
+		, PrimitiveVisibilityMap(InPrimitiveVisibilityMap)
+		, PotentiallyFadingPrimitiveMap(InPotentiallyFadingPrimitiveMap)
+	{}
+};
+
+/**
+ * Frustum culls primitives [StartIndex, EndIndex) one at a time.
+ * @return The number of culled primitives.
+ */
+template<bool UseCustomCulling>
+int32 FrustumCullRange(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 StartIndex, int32 EndIndex);
+
+/**
+ * Frustum culls primitives [StartIndex, EndIndex) four at a time, from FScene::PrimitiveCullingBounds. Does the same tests as
+ * FrustumCullRange, but writes the visibility maps a word at a time, so StartIndex must be the first bit of a word.
+ * @return The number of culled primitives.
+ */
+template<bool UseCustomCulling>
+int32 FrustumCullRangeVectorized(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 StartIndex, int32 EndIndex);
@@ -1195,6 +1195,124 @@ struct FPrimitiveBounds
 	float MaxDrawDistance;
 };
 
+/**
+ * The scene's primitive bounds again, in packets of four primitives that store each member as four floats, so that
+ * frustum culling can test four primitives at a time with vector instructions. Indexed like FScene::PrimitiveBounds.
+ */
+class FPrimitiveCullingBounds
+{
+public:
+
+	enum { PrimitivesPerPacket = 4 };
+
+	/** Bounds of PrimitivesPerPacket consecutive primitives, see FPrimitiveBounds. */
+	struct FPacket
+	{
+		float OriginX[PrimitivesPerPacket];
+		float OriginY[PrimitivesPerPacket];
+		float OriginZ[PrimitivesPerPacket];
+		float SphereRadius[PrimitivesPerPacket];
+		float BoxExtentX[PrimitivesPerPacket];
+		float BoxExtentY[PrimitivesPerPacket];
+		float BoxExtentZ[PrimitivesPerPacket];
+		float MinDrawDistanceSq[PrimitivesPerPacket];
+		float MaxDrawDistance[PrimitivesPerPacket];
+	};
+
+	FPrimitiveCullingBounds()
+		: NumPrimitives(0)
+	{}
+
+	/** Adds a primitive at the end, whose bounds are then set with Set. */
+	void AddUninitialized()
+	{
+		if (NumPrimitives % PrimitivesPerPacket == 0)
+		{
+			Packets.AddZeroed();
+		}
+		NumPrimitives++;
+	}
+
+	/** Removes a primitive by moving the last one into its place, like TArray::RemoveAtSwap. */
+	void RemoveAtSwap(int32 Index)
+	{
+		check(Index >= 0 && Index < NumPrimitives);
+		NumPrimitives--;
+		if (Index != NumPrimitives)
+		{
+			CopyPrimitive(NumPrimitives, Index);
+		}
+		if (NumPrimitives % PrimitivesPerPacket == 0)
+		{
+			Packets.RemoveAt(Packets.Num() - 1, 1, false);
+		}
+	}
+
+	void Set(int32 Index, const FPrimitiveBounds& Bounds)
+	{
+		FPacket& Packet = Packets[Index / PrimitivesPerPacket];
+		const int32 Lane = Index % PrimitivesPerPacket;
+		Packet.OriginX[Lane] = Bounds.Origin.X;
+		Packet.OriginY[Lane] = Bounds.Origin.Y;
+		Packet.OriginZ[Lane] = Bounds.Origin.Z;
+		Packet.SphereRadius[Lane] = Bounds.SphereRadius;
+		Packet.BoxExtentX[Lane] = Bounds.BoxExtent.X;
+		Packet.BoxExtentY[Lane] = Bounds.BoxExtent.Y;
+		Packet.BoxExtentZ[Lane] = Bounds.BoxExtent.Z;
+		Packet.MinDrawDistanceSq[Lane] = Bounds.MinDrawDistanceSq;
+		Packet.MaxDrawDistance[Lane] = Bounds.MaxDrawDistance;
+	}
+
+	/** Moves every origin by Offset, see FScene::ApplyWorldOffset. */
+	void ApplyOffset(const FVector& Offset)
+	{
+		for (int32 PacketIndex = 0; PacketIndex < Packets.Num(); PacketIndex++)
+		{
+			FPacket& Packet = Packets[PacketIndex];
+			for (int32 Lane = 0; Lane < PrimitivesPerPacket; Lane++)
+			{
+				Packet.OriginX[Lane] += Offset.X;
+				Packet.OriginY[Lane] += Offset.Y;
+				Packet.OriginZ[Lane] += Offset.Z;
+			}
+		}
+	}
+
+	int32 Num() const
+	{
+		return NumPrimitives;
+	}
+
+	/** Returns the packet which holds primitives [PacketIndex * PrimitivesPerPacket, (PacketIndex + 1) * PrimitivesPerPacket). */
+	const FPacket& GetPacket(int32 PacketIndex) const
+	{
+		return Packets[PacketIndex];
+	}
+
+private:
+
+	void CopyPrimitive(int32 FromIndex, int32 ToIndex)
+	{
+		const FPacket& From = Packets[FromIndex / PrimitivesPerPacket];
+		FPacket& To = Packets[ToIndex / PrimitivesPerPacket];
+		const int32 FromLane = FromIndex % PrimitivesPerPacket;
+		const int32 ToLane = ToIndex % PrimitivesPerPacket;
+		To.OriginX[ToLane] = From.OriginX[FromLane];
+		To.OriginY[ToLane] = From.OriginY[FromLane];
+		To.OriginZ[ToLane] = From.OriginZ[FromLane];
+		To.SphereRadius[ToLane] = From.SphereRadius[FromLane];
+		To.BoxExtentX[ToLane] = From.BoxExtentX[FromLane];
+		To.BoxExtentY[ToLane] = From.BoxExtentY[FromLane];
+		To.BoxExtentZ[ToLane] = From.BoxExtentZ[FromLane];
+		To.MinDrawDistanceSq[ToLane] = From.MinDrawDistanceSq[FromLane];
+		To.MaxDrawDistance[ToLane] = From.MaxDrawDistance[FromLane];
+	}
+
+	/** Packets of the primitives, the lanes of the last one past NumPrimitives are unused. */
+	TArray<FPacket> Packets;
+	int32 NumPrimitives;
+};
+
 /**
  * Precomputed primitive visibility ID.
  */
@@ -1221,6 +1339,8 @@ namespace EOcclusionFlags
 		AllowApproximateOcclusion = 0x4,
 		/** Indicates the primitive has a valid ID for precomputed visibility. */
 		HasPrecomputedVisibility = 0x8,
+		/** Indicates the primitive can be drawn into the software occlusion buffer. */
+		IsSoftwareOccluder = 0x10,
 	};
 };
 
@@ -1397,6 +1517,8 @@ public:
 	TArray<FPrimitiveSceneInfo*> Primitives;
 	/** Packed array of primitive bounds. */
 	TArray<FPrimitiveBounds> PrimitiveBounds;
+	/** Packed array of primitive bounds, in the layout frustum culling reads. */
+	FPrimitiveCullingBounds PrimitiveCullingBounds;
 	/** Packed array of precomputed primitive visibility IDs. */
 	TArray<FPrimitiveVisibilityId> PrimitiveVisibilityIds;
 	/** Packed array of primitive occlusion flags. See EOcclusionFlags. */
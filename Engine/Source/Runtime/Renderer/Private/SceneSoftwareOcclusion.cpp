@@ -0,0 +1,401 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SceneSoftwareOcclusion.cpp: Occlusion culling against a depth buffer drawn on the CPU.
+=============================================================================*/
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "SceneSoftwareOcclusion.h"
+
+DECLARE_CYCLE_STAT(TEXT("Software Occlusion Cull"), STAT_SoftwareOcclusionCull, STATGROUP_InitViews);
+
+static int32 GSoftwareOcclusion = 0;
+static FAutoConsoleVariableRef CVarSoftwareOcclusion(
+	TEXT("r.SoftwareOcclusion"),
+	GSoftwareOcclusion,
+	TEXT("Culls primitives behind occluder meshes (see LODForOccluderMesh on static meshes) with a depth buffer drawn on the CPU,\n")
+	TEXT("before hardware occlusion queries. Its results are used in the same frame, and need no GPU.\n")
+	TEXT(" 0: off (default)\n")
+	TEXT(" 1: on"),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GSoftwareOcclusionBufferWidth = 256;
+static FAutoConsoleVariableRef CVarSoftwareOcclusionBufferWidth(
+	TEXT("r.SoftwareOcclusion.BufferWidth"),
+	GSoftwareOcclusionBufferWidth,
+	TEXT("Width in pixels of the software occlusion buffer, its height follows the aspect ratio of the view."),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GSoftwareOcclusionMaxOccluders = 64;
+static FAutoConsoleVariableRef CVarSoftwareOcclusionMaxOccluders(
+	TEXT("r.SoftwareOcclusion.MaxOccluders"),
+	GSoftwareOcclusionMaxOccluders,
+	TEXT("Largest number of occluders drawn per view, the ones that are biggest on screen are drawn."),
+	ECVF_RenderThreadSafe
+	);
+
+static float GSoftwareOcclusionMinOccluderScreenRadius = 0.05f;
+static FAutoConsoleVariableRef CVarSoftwareOcclusionMinOccluderScreenRadius(
+	TEXT("r.SoftwareOcclusion.MinOccluderScreenRadius"),
+	GSoftwareOcclusionMinOccluderScreenRadius,
+	TEXT("Occluders whose bounds radius is smaller than this fraction of their distance to the view aren't drawn."),
+	ECVF_RenderThreadSafe
+	);
+
+FSoftwareOcclusionBuffer::FSoftwareOcclusionBuffer(int32 InWidth, int32 InHeight, float InNearW)
+	: Width(FMath::Max(InWidth, 1))
+	, Height(FMath::Max(InHeight, 1))
+	, Pitch(Align(Width, 4))
+	, NearW(FMath::Max(InNearW, KINDA_SMALL_NUMBER))
+{
+	Depth.AddZeroed(Pitch * Height);
+}
+
+void FSoftwareOcclusionBuffer::Clear()
+{
+	FMemory::Memzero(Depth.GetData(), Depth.Num() * sizeof(float));
+}
+
+void FSoftwareOcclusionBuffer::DrawMesh(const FMatrix& LocalToClip, const FVector* Vertices, int32 NumVertices, const uint32* Indices, int32 NumIndices, const int32* AdjacentTriangles)
+{
+	ClipVertices.Reset(NumVertices);
+	PixelVertices.Reset(NumVertices);
+	for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	{
+		const FVector4 Clip = LocalToClip.TransformPosition(Vertices[VertexIndex]);
+		ClipVertices.Add(Clip);
+		PixelVertices.Add(Clip.W >= NearW ? ClipToPixel(Clip) : FVector::ZeroVector);
+	}
+
+	// Two triangles facing the same way are on either side of the edge they share on screen, so together they cover it
+	const int32 NumTriangles = NumIndices / 3;
+	TriangleFacings.Reset(NumTriangles);
+	for (int32 Triangle = 0; Triangle < NumTriangles; Triangle++)
+	{
+		const uint32* TriangleIndices = Indices + Triangle * 3;
+		int8 Facing = 0;
+		if (ClipVertices[TriangleIndices[0]].W >= NearW && ClipVertices[TriangleIndices[1]].W >= NearW && ClipVertices[TriangleIndices[2]].W >= NearW)
+		{
+			const FVector& V0 = PixelVertices[TriangleIndices[0]];
+			const FVector& V1 = PixelVertices[TriangleIndices[1]];
+			const FVector& V2 = PixelVertices[TriangleIndices[2]];
+			const float Area = (V1.X - V0.X) * (V2.Y - V0.Y) - (V1.Y - V0.Y) * (V2.X - V0.X);
+			Facing = Area > 0.0f ? 1 : (Area < 0.0f ? -1 : 0);
+		}
+		TriangleFacings.Add(Facing);
+	}
+
+	for (int32 Triangle = 0; Triangle < NumTriangles; Triangle++)
+	{
+		const uint32* TriangleIndices = Indices + Triangle * 3;
+		const int8 Facing = TriangleFacings[Triangle];
+		if (Facing == 0)
+		{
+			DrawClippedTriangle(ClipVertices[TriangleIndices[0]], ClipVertices[TriangleIndices[1]], ClipVertices[TriangleIndices[2]]);
+			continue;
+		}
+
+		uint32 ShrunkEdges = 0;
+		for (int32 Edge = 0; Edge < 3; Edge++)
+		{
+			const int32 Adjacent = AdjacentTriangles ? AdjacentTriangles[Triangle * 3 + Edge] : INDEX_NONE;
+			if (Adjacent == INDEX_NONE || TriangleFacings[Adjacent] != Facing)
+			{
+				ShrunkEdges |= 1 << Edge;
+			}
+		}
+		RasterizeTriangle(PixelVertices[TriangleIndices[0]], PixelVertices[TriangleIndices[1]], PixelVertices[TriangleIndices[2]], ShrunkEdges);
+	}
+}
+
+void FSoftwareOcclusionBuffer::DrawClippedTriangle(const FVector4& A, const FVector4& B, const FVector4& C)
+{
+	if (A.W >= NearW && B.W >= NearW && C.W >= NearW)
+	{
+		// Has no area on screen
+		return;
+	}
+
+	// Clipping a triangle against one plane leaves nothing, a triangle or a quad
+	const FVector4* Corners[3] = { &A, &B, &C };
+	FVector Clipped[4];
+	int32 NumClipped = 0;
+
+	for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+	{
+		const FVector4& Current = *Corners[CornerIndex];
+		const FVector4& Next = *Corners[(CornerIndex + 1) % 3];
+		const bool bCurrentInFront = Current.W >= NearW;
+
+		if (bCurrentInFront)
+		{
+			Clipped[NumClipped++] = ClipToPixel(Current);
+		}
+		if (bCurrentInFront != (Next.W >= NearW))
+		{
+			const float Fraction = (NearW - Current.W) / (Next.W - Current.W);
+			Clipped[NumClipped++] = ClipToPixel(Current + (Next - Current) * Fraction);
+		}
+	}
+
+	// The edges along the near plane and between the two halves of a quad aren't edges of the mesh, but shrinking every edge is
+	// simpler and only leaves the pixels along them undrawn
+	if (NumClipped >= 3)
+	{
+		RasterizeTriangle(Clipped[0], Clipped[1], Clipped[2], 7);
+	}
+	if (NumClipped == 4)
+	{
+		RasterizeTriangle(Clipped[0], Clipped[2], Clipped[3], 7);
+	}
+}
+
+void FSoftwareOcclusionBuffer::RasterizeTriangle(FVector V0, FVector V1, FVector V2, uint32 ShrunkEdges)
+{
+	// Make the edge functions positive inside, whichever way the triangle winds, so that back faces are drawn too
+	float Area = (V1.X - V0.X) * (V2.Y - V0.Y) - (V1.Y - V0.Y) * (V2.X - V0.X);
+	if (Area < 0.0f)
+	{
+		// The edges become V0 to V2, V2 to V1 and V1 to V0, which were the last, middle and first edges
+		Swap(V1, V2);
+		Area = -Area;
+		ShrunkEdges = (ShrunkEdges & 2) | ((ShrunkEdges & 1) << 2) | ((ShrunkEdges & 4) >> 2);
+	}
+	if (Area <= SMALL_NUMBER)
+	{
+		return;
+	}
+
+	// Pixels that can be inside the triangle
+	const int32 MinX = FMath::Max(FMath::FloorToInt(FMath::Min3(V0.X, V1.X, V2.X)), 0);
+	const int32 MaxX = FMath::Min(FMath::CeilToInt(FMath::Max3(V0.X, V1.X, V2.X)), Width) - 1;
+	const int32 MinY = FMath::Max(FMath::FloorToInt(FMath::Min3(V0.Y, V1.Y, V2.Y)), 0);
+	const int32 MaxY = FMath::Min(FMath::CeilToInt(FMath::Max3(V0.Y, V1.Y, V2.Y)), Height) - 1;
+	if (MinX > MaxX || MinY > MaxY)
+	{
+		return;
+	}
+
+	// Edge function of the edge from Va to Vb, at a pixel center, is DX * (Y - Va.Y) - DY * (X - Va.X)
+	// Shrunk edges are moved in by how much the function drops from a pixel center to its farthest corner, so that pixels the
+	// edge crosses aren't drawn, and the mesh never hides more than it covers
+	const FVector* EdgeStarts[3] = { &V0, &V1, &V2 };
+	const FVector* EdgeEnds[3] = { &V1, &V2, &V0 };
+	float EdgeStepX[3];
+	float EdgeStepY[3];
+	float EdgeAtOrigin[3];
+	for (int32 Edge = 0; Edge < 3; Edge++)
+	{
+		EdgeStepX[Edge] = -(EdgeEnds[Edge]->Y - EdgeStarts[Edge]->Y);
+		EdgeStepY[Edge] = EdgeEnds[Edge]->X - EdgeStarts[Edge]->X;
+		EdgeAtOrigin[Edge] = -EdgeStepX[Edge] * EdgeStarts[Edge]->X - EdgeStepY[Edge] * EdgeStarts[Edge]->Y;
+		if (ShrunkEdges & (1 << Edge))
+		{
+			EdgeAtOrigin[Edge] -= 0.5f * (FMath::Abs(EdgeStepX[Edge]) + FMath::Abs(EdgeStepY[Edge]));
+		}
+	}
+
+	// 1 / W is a plane in screen space, drawn at its farthest point over each pixel
+	const float DepthStepX = ((V1.Z - V0.Z) * (V2.Y - V0.Y) - (V2.Z - V0.Z) * (V1.Y - V0.Y)) / Area;
+	const float DepthStepY = ((V2.Z - V0.Z) * (V1.X - V0.X) - (V1.Z - V0.Z) * (V2.X - V0.X)) / Area;
+	const float DepthAtOrigin = V0.Z - DepthStepX * V0.X - DepthStepY * V0.Y - 0.5f * (FMath::Abs(DepthStepX) + FMath::Abs(DepthStepY));
+
+	// Four pixels at a time from a multiple of four, the rows are padded so the last group never runs past the row
+	const int32 StartX = MinX & ~3;
+	const VectorRegister LaneCenters = MakeVectorRegister(StartX + 0.5f, StartX + 1.5f, StartX + 2.5f, StartX + 3.5f);
+	const VectorRegister Zero = VectorZero();
+
+	const VectorRegister E0StepX = VectorLoadFloat1(&EdgeStepX[0]);
+	const VectorRegister E1StepX = VectorLoadFloat1(&EdgeStepX[1]);
+	const VectorRegister E2StepX = VectorLoadFloat1(&EdgeStepX[2]);
+	const VectorRegister DepthStepXVector = VectorLoadFloat1(&DepthStepX);
+	const VectorRegister Four = MakeVectorRegister(4.0f, 4.0f, 4.0f, 4.0f);
+	const VectorRegister E0Step4 = VectorMultiply(E0StepX, Four);
+	const VectorRegister E1Step4 = VectorMultiply(E1StepX, Four);
+	const VectorRegister E2Step4 = VectorMultiply(E2StepX, Four);
+	const VectorRegister DepthStep4 = VectorMultiply(DepthStepXVector, Four);
+
+	for (int32 Y = MinY; Y <= MaxY; Y++)
+	{
+		const float CenterY = Y + 0.5f;
+		const float E0Row = EdgeAtOrigin[0] + EdgeStepY[0] * CenterY;
+		const float E1Row = EdgeAtOrigin[1] + EdgeStepY[1] * CenterY;
+		const float E2Row = EdgeAtOrigin[2] + EdgeStepY[2] * CenterY;
+		const float DepthRow = DepthAtOrigin + DepthStepY * CenterY;
+
+		VectorRegister E0 = VectorMultiplyAdd(E0StepX, LaneCenters, VectorLoadFloat1(&E0Row));
+		VectorRegister E1 = VectorMultiplyAdd(E1StepX, LaneCenters, VectorLoadFloat1(&E1Row));
+		VectorRegister E2 = VectorMultiplyAdd(E2StepX, LaneCenters, VectorLoadFloat1(&E2Row));
+		VectorRegister PixelDepth = VectorMultiplyAdd(DepthStepXVector, LaneCenters, VectorLoadFloat1(&DepthRow));
+
+		float* Row = &Depth[Y * Pitch];
+		for (int32 X = StartX; X <= MaxX; X += 4)
+		{
+			const VectorRegister Inside = VectorBitwiseAnd(VectorCompareGE(E0, Zero), VectorBitwiseAnd(VectorCompareGE(E1, Zero), VectorCompareGE(E2, Zero)));
+			if (VectorMaskBits(Inside))
+			{
+				const VectorRegister OldDepth = VectorLoad(Row + X);
+				VectorStore(VectorSelect(Inside, VectorMax(OldDepth, PixelDepth), OldDepth), Row + X);
+			}
+
+			E0 = VectorAdd(E0, E0Step4);
+			E1 = VectorAdd(E1, E1Step4);
+			E2 = VectorAdd(E2, E2Step4);
+			PixelDepth = VectorAdd(PixelDepth, DepthStep4);
+		}
+	}
+}
+
+bool FSoftwareOcclusionBuffer::IsBoxOccluded(const FMatrix& WorldToClip, const FVector& Origin, const FVector& Extent) const
+{
+	float MinX = MAX_flt;
+	float MaxX = -MAX_flt;
+	float MinY = MAX_flt;
+	float MaxY = -MAX_flt;
+	float NearestDepth = 0.0f;
+
+	for (int32 Corner = 0; Corner < 8; Corner++)
+	{
+		const FVector Position = Origin + Extent * FVector((Corner & 1) ? 1.0f : -1.0f, (Corner & 2) ? 1.0f : -1.0f, (Corner & 4) ? 1.0f : -1.0f);
+		const FVector4 Clip = WorldToClip.TransformPosition(Position);
+
+		// Nothing drawn can be in front of a box which reaches the near plane
+		if (Clip.W < NearW)
+		{
+			return false;
+		}
+
+		const FVector Pixel = ClipToPixel(Clip);
+		MinX = FMath::Min(MinX, Pixel.X);
+		MaxX = FMath::Max(MaxX, Pixel.X);
+		MinY = FMath::Min(MinY, Pixel.Y);
+		MaxY = FMath::Max(MaxY, Pixel.Y);
+		// W is linear over the box, so its nearest point is a corner
+		NearestDepth = FMath::Max(NearestDepth, Pixel.Z);
+	}
+
+	// Every pixel the screen rectangle of the box touches
+	const int32 X0 = FMath::Max(FMath::FloorToInt(MinX), 0);
+	const int32 X1 = FMath::Min(FMath::FloorToInt(MaxX), Width - 1);
+	const int32 Y0 = FMath::Max(FMath::FloorToInt(MinY), 0);
+	const int32 Y1 = FMath::Min(FMath::FloorToInt(MaxY), Height - 1);
+	if (X0 > X1 || Y0 > Y1)
+	{
+		return false;
+	}
+
+	const VectorRegister BoxDepth = VectorLoadFloat1(&NearestDepth);
+	const int32 StartX = X0 & ~3;
+
+	for (int32 Y = Y0; Y <= Y1; Y++)
+	{
+		const float* Row = &Depth[Y * Pitch];
+		for (int32 X = StartX; X <= X1; X += 4)
+		{
+			int32 LaneMask = 0xf;
+			if (X < X0)
+			{
+				LaneMask &= 0xf << (X0 - X);
+			}
+			if (X + 3 > X1)
+			{
+				LaneMask &= 0xf >> (X + 3 - X1);
+			}
+
+			// The box may be seen through any pixel where nothing was drawn in front of its nearest point
+			if (VectorMaskBits(VectorCompareGE(BoxDepth, VectorLoad(Row + X))) & LaneMask)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int32 SoftwareOcclusionCull(const FScene* Scene, FViewInfo& View)
+{
+	// 1 / W doesn't vary under an orthographic projection
+	if (!GSoftwareOcclusion || !View.IsPerspectiveProjection())
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SoftwareOcclusionCull);
+
+	struct FOccluder
+	{
+		int32 PrimitiveIndex;
+		float ScreenRadiusSquared;
+	};
+
+	// The occluders that are biggest on screen hide the most
+	TArray<FOccluder, SceneRenderingAllocator> Occluders;
+	const float MinScreenRadiusSquared = FMath::Square(GSoftwareOcclusionMinOccluderScreenRadius);
+
+	for (FSceneSetBitIterator BitIt(View.PrimitiveVisibilityMap); BitIt; ++BitIt)
+	{
+		if (Scene->PrimitiveOcclusionFlags[BitIt.GetIndex()] & EOcclusionFlags::IsSoftwareOccluder)
+		{
+			const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[BitIt.GetIndex()];
+			const float DistanceSquared = FMath::Max((Bounds.Origin - View.ViewMatrices.ViewOrigin).SizeSquared(), 1.0f);
+			const float ScreenRadiusSquared = FMath::Square(Bounds.SphereRadius) / DistanceSquared;
+
+			if (ScreenRadiusSquared >= MinScreenRadiusSquared)
+			{
+				FOccluder Occluder;
+				Occluder.PrimitiveIndex = BitIt.GetIndex();
+				Occluder.ScreenRadiusSquared = ScreenRadiusSquared;
+				Occluders.Add(Occluder);
+			}
+		}
+	}
+
+	if (Occluders.Num() == 0)
+	{
+		return 0;
+	}
+
+	Occluders.Sort([](const FOccluder& A, const FOccluder& B) { return A.ScreenRadiusSquared > B.ScreenRadiusSquared; });
+	const int32 NumOccluders = FMath::Min(Occluders.Num(), FMath::Max(GSoftwareOcclusionMaxOccluders, 0));
+
+	const int32 BufferWidth = FMath::Clamp(GSoftwareOcclusionBufferWidth, 16, 2048);
+	const int32 BufferHeight = FMath::Max(BufferWidth * View.ViewRect.Height() / FMath::Max(View.ViewRect.Width(), 1), 1);
+	FSoftwareOcclusionBuffer Buffer(BufferWidth, BufferHeight, View.NearClippingDistance);
+
+	for (int32 OccluderIndex = 0; OccluderIndex < NumOccluders; OccluderIndex++)
+	{
+		const FPrimitiveSceneProxy* Proxy = Scene->Primitives[Occluders[OccluderIndex].PrimitiveIndex]->Proxy;
+		const FOccluderMeshData* Mesh = Proxy->GetOccluderMeshData();
+		checkSlow(Mesh);
+		Buffer.DrawMesh(Proxy->GetLocalToWorld() * View.ViewProjectionMatrix, Mesh->Vertices.GetData(), Mesh->Vertices.Num(), Mesh->Indices.GetData(), Mesh->Indices.Num(), Mesh->AdjacentTriangles.GetData());
+	}
+
+	// Occluders are tested too, but never hide themselves: the nearest point of their bounds is in front of all of their triangles
+	int32 NumOccludedPrimitives = 0;
+	for (FSceneSetBitIterator BitIt(View.PrimitiveVisibilityMap); BitIt; ++BitIt)
+	{
+		if (!(Scene->PrimitiveOcclusionFlags[BitIt.GetIndex()] & EOcclusionFlags::CanBeOccluded))
+		{
+			continue;
+		}
+
+		// Keep the occluded outline of selected primitives, like hardware occlusion does
+		if (GIsEditor && Scene->Primitives[BitIt.GetIndex()]->Proxy->IsSelected())
+		{
+			continue;
+		}
+
+		const FBoxSphereBounds& Bounds = Scene->PrimitiveOcclusionBounds[BitIt.GetIndex()];
+		if (Buffer.IsBoxOccluded(View.ViewProjectionMatrix, Bounds.Origin, Bounds.BoxExtent))
+		{
+			View.PrimitiveVisibilityMap.AccessCorrespondingBit(BitIt) = false;
+			NumOccludedPrimitives++;
+		}
+	}
+
+	return NumOccludedPrimitives;
+}
@@ -0,0 +1,99 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	SceneSoftwareOcclusion.h: Occlusion culling against a depth buffer drawn on the CPU.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Low resolution depth buffer which occluder meshes are drawn into on the CPU, to cull what is behind them in the same frame,
+ * without the frame of latency and the round trips of hardware occlusion queries, and without a GPU at all.
+ *
+ * Stores the largest 1 / W drawn at each pixel, so that nearer is larger and 0 means nothing was drawn. 1 / W interpolates
+ * linearly across a projected triangle, and works with any perspective projection, whatever it does with Z.
+ */
+class FSoftwareOcclusionBuffer
+{
+public:
+
+	/**
+	 * @param InWidth Width in pixels, rows are padded to a multiple of four pixels.
+	 * @param InHeight Height in pixels.
+	 * @param InNearW Clip space W of the near plane, nothing nearer is drawn and boxes which reach nearer are never occluded.
+	 */
+	FSoftwareOcclusionBuffer(int32 InWidth, int32 InHeight, float InNearW);
+
+	/** Clears the buffer to nothing drawn. */
+	void Clear();
+
+	/**
+	 * Draws the front and back faces of a triangle list. Only pixels entirely covered by the mesh are drawn, at the farthest
+	 * depth of the mesh over them.
+	 * @param LocalToClip Transforms the vertices to clip space.
+	 * @param AdjacentTriangles Optional triangle on the other side of each edge, see FOccluderMeshData::AdjacentTriangles.
+	 *                          Without it, pixels along the edges between triangles aren't drawn either.
+	 */
+	void DrawMesh(const FMatrix& LocalToClip, const FVector* Vertices, int32 NumVertices, const uint32* Indices, int32 NumIndices, const int32* AdjacentTriangles = NULL);
+
+	/** Returns whether everything drawn covers the screen rectangle of a box, nearer than the nearest point of the box. */
+	bool IsBoxOccluded(const FMatrix& WorldToClip, const FVector& Origin, const FVector& Extent) const;
+
+	/** Returns the 1 / W drawn at a pixel, 0 if nothing was drawn. */
+	float GetDepth(int32 X, int32 Y) const
+	{
+		return Depth[Y * Pitch + X];
+	}
+
+	int32 GetWidth() const
+	{
+		return Width;
+	}
+
+	int32 GetHeight() const
+	{
+		return Height;
+	}
+
+private:
+
+	/** Clips a clip space triangle reaching nearer than the near plane against it, then rasterizes what is left. */
+	void DrawClippedTriangle(const FVector4& A, const FVector4& B, const FVector4& C);
+
+	/**
+	 * Rasterizes a triangle given in pixels, with 1 / W in Z, four pixels at a time.
+	 * @param ShrunkEdges Bit per edge, from V0 to V1 and so on, set if pixels it only partly covers aren't drawn. Edges another
+	 *                    triangle of the mesh continues across in screen space are left out, so the mesh has no cracks.
+	 */
+	void RasterizeTriangle(FVector V0, FVector V1, FVector V2, uint32 ShrunkEdges);
+
+	/** Projects a clip space position in front of the near plane to pixels, with 1 / W in Z. */
+	FORCEINLINE FVector ClipToPixel(const FVector4& Clip) const
+	{
+		const float InvW = 1.0f / Clip.W;
+		return FVector(
+			(Clip.X * InvW * 0.5f + 0.5f) * Width,
+			(0.5f - Clip.Y * InvW * 0.5f) * Height,
+			InvW);
+	}
+
+	int32 Width;
+	int32 Height;
+	/** Floats per row, Width rounded up to a multiple of four. */
+	int32 Pitch;
+	float NearW;
+	TArray<float> Depth;
+	/** Clip space positions of the mesh being drawn, kept to reuse the allocation. */
+	TArray<FVector4> ClipVertices;
+	/** Pixel positions of the vertices of the mesh being drawn in front of the near plane. */
+	TArray<FVector> PixelVertices;
+	/** Which way each triangle of the mesh being drawn faces on screen, 0 if it reaches the near plane or has no area. */
+	TArray<int8> TriangleFacings;
+};
+
+/**
+ * Draws the largest occluders visible in the view into a software occlusion buffer, then removes the primitives it hides from
+ * the view's visibility map. Does nothing unless r.SoftwareOcclusion is set.
+ * @return The number of primitives culled.
+ */
+int32 SoftwareOcclusionCull(const FScene* Scene, FViewInfo& View);
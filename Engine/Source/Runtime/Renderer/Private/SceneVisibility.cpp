@@ -11,6 +11,9 @@
 #include "../../Engine/Private/SkeletalRenderGPUSkin.h"		// GPrevPerBoneMotionBlur
 #include "SceneUtils.h"
 #include "PostProcessing.h"
+#include "ParallelFor.h"
+#include "SceneSoftwareOcclusion.h"
+#include "SceneFrustumCull.h"
 
 /*------------------------------------------------------------------------------
 	Globals
@@ -101,6 +104,26 @@ static FAutoConsoleVariableRef CVarLODFadeTime( TEXT("r.LODFadeTime"), GFadeTime
 static float GDistanceFadeMaxTravel = 1000.0f;
 static FAutoConsoleVariableRef CVarDistanceFadeMaxTravel( TEXT("r.DistanceFadeMaxTravel"), GDistanceFadeMaxTravel, TEXT("Max distance that the player can travel during the fade time."), ECVF_RenderThreadSafe );
 
+/** Frustum culling cvars */
+static int32 GParallelFrustumCull = 1;
+static FAutoConsoleVariableRef CVarParallelFrustumCull(
+	TEXT("r.ParallelFrustumCull"),
+	GParallelFrustumCull,
+	TEXT("Splits frustum culling of the primitives in the scene over the task graph's worker threads."),
+	ECVF_RenderThreadSafe
+	);
+
+static int32 GFrustumCullVectorized = 1;
+static FAutoConsoleVariableRef CVarFrustumCullVectorized(
+	TEXT("r.FrustumCullVectorized"),
+	GFrustumCullVectorized,
+	TEXT("Frustum culls four primitives at a time with vector instructions, rather than one at a time."),
+	ECVF_RenderThreadSafe
+	);
+
+/** Number of primitives each thread frustum culls at a time, a multiple of the bits in a word of the visibility maps. */
+static const int32 GFrustumCullNumPrimitivesPerTask = 1024;
+
 /*------------------------------------------------------------------------------
 	Visibility determination.
 ------------------------------------------------------------------------------*/
@@ -220,69 +243,222 @@ bool FViewInfo::IsDistanceCulled( float DistanceSquared, float MinDrawDistance,
 	return ( bDistanceCulled && !bStillFading );
 }
 
-/**
- * Frustum cull primitives in the scene against the view.
- */
-template<bool UseCustomCulling>
-static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
+FFrustumCullParams::FFrustumCullParams(const FViewInfo& View)
+	: ViewOrigin(View.ViewMatrices.ViewOrigin)
+	, MaxDrawDistanceScale(GetCachedScalabilityCVars().ViewDistanceScale)
+	, FadeRadius(GDisableLODFade ? 0.0f : GDistanceFadeMaxTravel)
+	, bDisableDistanceCulling(View.Family->EngineShowFlags.DistanceCulledPrimitives != 0)
+	, CustomVisibilityFlags(EOcclusionFlags::CanBeOccluded | EOcclusionFlags::HasPrecomputedVisibility)
+	, ViewFrustum(&View.ViewFrustum)
+	, CustomVisibilityQuery(View.CustomVisibilityQuery)
+{}
+
+/** Returns whether the custom visibility query of the view culls a primitive. */
+static FORCEINLINE bool IsCulledByCustomVisibility(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 PrimitiveIndex)
 {
-	SCOPE_CYCLE_COUNTER(STAT_FrustumCull);
+	int32 VisibilityId = INDEX_NONE;
+	if ((Arrays.Scene->PrimitiveOcclusionFlags[PrimitiveIndex] & Params.CustomVisibilityFlags) == Params.CustomVisibilityFlags)
+	{
+		VisibilityId = Arrays.Scene->PrimitiveVisibilityIds[PrimitiveIndex].ByteIndex;
+	}
 
+	const FPrimitiveBounds& Bounds = Arrays.PrimitiveBounds[PrimitiveIndex];
+	return !Params.CustomVisibilityQuery->IsVisible(VisibilityId, FBoxSphereBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius));
+}
+
+template<bool UseCustomCulling>
+int32 FrustumCullRange(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 StartIndex, int32 EndIndex)
+{
+	const FConvexVolume& ViewFrustum = *Params.ViewFrustum;
 	int32 NumCulledPrimitives = 0;
-	FVector ViewOriginForDistanceCulling = View.ViewMatrices.ViewOrigin;
-	float MaxDrawDistanceScale = GetCachedScalabilityCVars().ViewDistanceScale;
-	float FadeRadius = GDisableLODFade ? 0.0f : GDistanceFadeMaxTravel;
-	uint8 CustomVisibilityFlags = EOcclusionFlags::CanBeOccluded | EOcclusionFlags::HasPrecomputedVisibility;
 
-	for (FSceneBitArray::FIterator BitIt(View.PrimitiveVisibilityMap); BitIt; ++BitIt)
+	for (int32 PrimitiveIndex = StartIndex; PrimitiveIndex < EndIndex; PrimitiveIndex++)
 	{
-		const FPrimitiveBounds& Bounds = Scene->PrimitiveBounds[BitIt.GetIndex()];
-		float DistanceSquared = (Bounds.Origin - ViewOriginForDistanceCulling).SizeSquared();
-		float MaxDrawDistance = Bounds.MaxDrawDistance * MaxDrawDistanceScale;
-		int32 VisibilityId = INDEX_NONE;
-
-		if (UseCustomCulling &&
-			((Scene->PrimitiveOcclusionFlags[BitIt.GetIndex()] & CustomVisibilityFlags) == CustomVisibilityFlags))
-		{
-			VisibilityId = Scene->PrimitiveVisibilityIds[BitIt.GetIndex()].ByteIndex;
-		}
+		const FPrimitiveBounds& Bounds = Arrays.PrimitiveBounds[PrimitiveIndex];
+		float DistanceSquared = (Bounds.Origin - Params.ViewOrigin).SizeSquared();
+		float MaxDrawDistance = Bounds.MaxDrawDistance * Params.MaxDrawDistanceScale;
 
 		// If cull distance is disabled, always show (except foliage)
-		if (View.Family->EngineShowFlags.DistanceCulledPrimitives
-			&& !Scene->Primitives[BitIt.GetIndex()]->Proxy->IsDetailMesh())
+		if (Params.bDisableDistanceCulling
+			&& !Arrays.Scene->Primitives[PrimitiveIndex]->Proxy->IsDetailMesh())
 		{
 			MaxDrawDistance = FLT_MAX;
 		}
 
 		// The primitive is always culled if it exceeds the max fade distance or lay outside the view frustum.
-		if (DistanceSquared > FMath::Square(MaxDrawDistance + FadeRadius) ||
+		if (DistanceSquared > FMath::Square(MaxDrawDistance + Params.FadeRadius) ||
 			DistanceSquared < Bounds.MinDrawDistanceSq ||
-			(UseCustomCulling && !View.CustomVisibilityQuery->IsVisible(VisibilityId, FBoxSphereBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius))) ||
-			View.ViewFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius) == false ||
-			View.ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent) == false)
+			(UseCustomCulling && IsCulledByCustomVisibility(Params, Arrays, PrimitiveIndex)) ||
+			ViewFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius) == false ||
+			ViewFrustum.IntersectBox(Bounds.Origin, Bounds.BoxExtent) == false)
 		{
-			STAT(NumCulledPrimitives++);
+			NumCulledPrimitives++;
 			continue;
 		}
 
 		if (DistanceSquared > FMath::Square(MaxDrawDistance))
 		{
-			View.PotentiallyFadingPrimitiveMap.AccessCorrespondingBit(BitIt) = true;
+			Arrays.PotentiallyFadingPrimitiveMap[PrimitiveIndex] = true;
 		}
 		else
 		{
 			// The primitive is visible!
-			BitIt.GetValue() = true;
-			if (DistanceSquared > FMath::Square(MaxDrawDistance - FadeRadius))
+			Arrays.PrimitiveVisibilityMap[PrimitiveIndex] = true;
+			if (DistanceSquared > FMath::Square(MaxDrawDistance - Params.FadeRadius))
+			{
+				Arrays.PotentiallyFadingPrimitiveMap[PrimitiveIndex] = true;
+			}
+		}
+	}
+
+	return NumCulledPrimitives;
+}
+
+template<bool UseCustomCulling>
+int32 FrustumCullRangeVectorized(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 StartIndex, int32 EndIndex)
+{
+	checkSlow(StartIndex % NumBitsPerDWORD == 0);
+	checkSlow(NumBitsPerDWORD % FPrimitiveCullingBounds::PrimitivesPerPacket == 0);
+
+	const FPlane* Planes = Params.ViewFrustum->Planes.GetData();
+	const int32 NumPlanes = Params.ViewFrustum->Planes.Num();
+	uint32* VisibilityWords = Arrays.PrimitiveVisibilityMap.GetData();
+	uint32* FadingWords = Arrays.PotentiallyFadingPrimitiveMap.GetData();
+
+	const VectorRegister ViewOriginX = VectorLoadFloat1(&Params.ViewOrigin.X);
+	const VectorRegister ViewOriginY = VectorLoadFloat1(&Params.ViewOrigin.Y);
+	const VectorRegister ViewOriginZ = VectorLoadFloat1(&Params.ViewOrigin.Z);
+	const VectorRegister MaxDrawDistanceScale = VectorLoadFloat1(&Params.MaxDrawDistanceScale);
+	const VectorRegister FadeRadius = VectorLoadFloat1(&Params.FadeRadius);
+
+	int32 NumCulledPrimitives = 0;
+
+	for (int32 WordStart = StartIndex; WordStart < EndIndex; WordStart += NumBitsPerDWORD)
+	{
+		const int32 NumInWord = FMath::Min<int32>(NumBitsPerDWORD, EndIndex - WordStart);
+		uint32 VisibleBits = 0;
+		uint32 FadingBits = 0;
+
+		for (int32 Lane = 0; Lane < NumInWord; Lane += FPrimitiveCullingBounds::PrimitivesPerPacket)
+		{
+			const int32 PacketStart = WordStart + Lane;
+			const FPrimitiveCullingBounds::FPacket& Packet = Arrays.PrimitiveCullingBounds.GetPacket(PacketStart / FPrimitiveCullingBounds::PrimitivesPerPacket);
+			const int32 NumInPacket = FMath::Min<int32>(FPrimitiveCullingBounds::PrimitivesPerPacket, NumInWord - Lane);
+			const uint32 PacketMask = (1 << NumInPacket) - 1;
+
+			const VectorRegister OriginX = VectorLoad(Packet.OriginX);
+			const VectorRegister OriginY = VectorLoad(Packet.OriginY);
+			const VectorRegister OriginZ = VectorLoad(Packet.OriginZ);
+			const VectorRegister SphereRadius = VectorLoad(Packet.SphereRadius);
+			const VectorRegister BoxExtentX = VectorLoad(Packet.BoxExtentX);
+			const VectorRegister BoxExtentY = VectorLoad(Packet.BoxExtentY);
+			const VectorRegister BoxExtentZ = VectorLoad(Packet.BoxExtentZ);
+
+			// Outside if the sphere or the box is entirely in front of any of the planes, like IntersectSphere and IntersectBox
+			VectorRegister Outside = VectorZero();
+			for (int32 PlaneIndex = 0; PlaneIndex < NumPlanes; PlaneIndex++)
+			{
+				const FPlane& Plane = Planes[PlaneIndex];
+				const VectorRegister PlaneX = VectorLoadFloat1(&Plane.X);
+				const VectorRegister PlaneY = VectorLoadFloat1(&Plane.Y);
+				const VectorRegister PlaneZ = VectorLoadFloat1(&Plane.Z);
+				const VectorRegister PlaneW = VectorLoadFloat1(&Plane.W);
+
+				const VectorRegister Distance = VectorSubtract(VectorMultiplyAdd(OriginZ, PlaneZ, VectorMultiplyAdd(OriginY, PlaneY, VectorMultiply(OriginX, PlaneX))), PlaneW);
+				const VectorRegister PushOut = VectorMultiplyAdd(BoxExtentZ, VectorAbs(PlaneZ), VectorMultiplyAdd(BoxExtentY, VectorAbs(PlaneY), VectorMultiply(BoxExtentX, VectorAbs(PlaneX))));
+				Outside = VectorBitwiseOr(Outside, VectorCompareGT(Distance, VectorMin(SphereRadius, PushOut)));
+			}
+
+			const VectorRegister DeltaX = VectorSubtract(OriginX, ViewOriginX);
+			const VectorRegister DeltaY = VectorSubtract(OriginY, ViewOriginY);
+			const VectorRegister DeltaZ = VectorSubtract(OriginZ, ViewOriginZ);
+			const VectorRegister DistanceSquared = VectorMultiplyAdd(DeltaZ, DeltaZ, VectorMultiplyAdd(DeltaY, DeltaY, VectorMultiply(DeltaX, DeltaX)));
+
+			VectorRegister MaxDrawDistance = VectorMultiply(VectorLoad(Packet.MaxDrawDistance), MaxDrawDistanceScale);
+			if (Params.bDisableDistanceCulling)
+			{
+				// If cull distance is disabled, always show (except foliage)
+				float MaxDrawDistances[FPrimitiveCullingBounds::PrimitivesPerPacket];
+				for (int32 PacketLane = 0; PacketLane < FPrimitiveCullingBounds::PrimitivesPerPacket; PacketLane++)
+				{
+					const bool bDetailMesh = PacketLane < NumInPacket && Arrays.Scene->Primitives[PacketStart + PacketLane]->Proxy->IsDetailMesh();
+					MaxDrawDistances[PacketLane] = bDetailMesh ? Packet.MaxDrawDistance[PacketLane] * Params.MaxDrawDistanceScale : FLT_MAX;
+				}
+				MaxDrawDistance = VectorLoad(MaxDrawDistances);
+			}
+
+			const VectorRegister MaxFadeDistance = VectorAdd(MaxDrawDistance, FadeRadius);
+			const VectorRegister MinFadeDistance = VectorSubtract(MaxDrawDistance, FadeRadius);
+
+			// The primitive is always culled if it exceeds the max fade distance or lay outside the view frustum.
+			uint32 CulledMask = VectorMaskBits(VectorBitwiseOr(Outside, VectorBitwiseOr(
+				VectorCompareGT(DistanceSquared, VectorMultiply(MaxFadeDistance, MaxFadeDistance)),
+				VectorCompareGT(VectorLoad(Packet.MinDrawDistanceSq), DistanceSquared))));
+			const uint32 FadingOutMask = VectorMaskBits(VectorCompareGT(DistanceSquared, VectorMultiply(MaxDrawDistance, MaxDrawDistance)));
+			const uint32 FadingInMask = VectorMaskBits(VectorCompareGT(DistanceSquared, VectorMultiply(MinFadeDistance, MinFadeDistance)));
+
+			if (UseCustomCulling)
 			{
-				View.PotentiallyFadingPrimitiveMap.AccessCorrespondingBit(BitIt) = true;
+				for (int32 PacketLane = 0; PacketLane < NumInPacket; PacketLane++)
+				{
+					if (!(CulledMask & (1 << PacketLane)) && IsCulledByCustomVisibility(Params, Arrays, PacketStart + PacketLane))
+					{
+						CulledMask |= 1 << PacketLane;
+					}
+				}
 			}
+
+			const uint32 KeptMask = ~CulledMask & PacketMask;
+			VisibleBits |= (KeptMask & ~FadingOutMask) << Lane;
+			FadingBits |= (KeptMask & (FadingOutMask | FadingInMask)) << Lane;
+			NumCulledPrimitives += NumInPacket - ((KeptMask & 1) + ((KeptMask >> 1) & 1) + ((KeptMask >> 2) & 1) + ((KeptMask >> 3) & 1));
 		}
+
+		VisibilityWords[WordStart / NumBitsPerDWORD] |= VisibleBits;
+		FadingWords[WordStart / NumBitsPerDWORD] |= FadingBits;
 	}
 
 	return NumCulledPrimitives;
 }
 
+// Instantiated for the Renderer.FrustumCull test, which culls without a scene.
+template int32 FrustumCullRange<false>(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 StartIndex, int32 EndIndex);
+template int32 FrustumCullRangeVectorized<false>(const FFrustumCullParams& Params, const FFrustumCullArrays& Arrays, int32 StartIndex, int32 EndIndex);
+
+/**
+ * Frustum cull primitives in the scene against the view.
+ */
+template<bool UseCustomCulling>
+static int32 FrustumCull(const FScene* Scene, FViewInfo& View)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FrustumCull);
+
+	const FFrustumCullParams Params(View);
+	const FFrustumCullArrays Arrays(Scene, View);
+	const int32 NumPrimitives = View.PrimitiveVisibilityMap.Num();
+	const bool bVectorized = GFrustumCullVectorized != 0;
+	check(!bVectorized || Scene->PrimitiveCullingBounds.Num() == NumPrimitives);
+
+	// Each task starts on a word boundary, so no two threads write to the same word of the visibility maps
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumPrimitives, GFrustumCullNumPrimitivesPerTask);
+	volatile int32 NumCulledPrimitives = 0;
+
+	// Custom visibility queries are only called from several threads at once if they say they can be
+	const bool bForceSingleThread = !GParallelFrustumCull || (UseCustomCulling && !View.CustomVisibilityQuery->IsThreadsafe());
+
+	ParallelFor(NumTasks, [&Params, &Arrays, NumPrimitives, bVectorized, &NumCulledPrimitives](int32 TaskIndex)
+	{
+		const int32 StartIndex = TaskIndex * GFrustumCullNumPrimitivesPerTask;
+		const int32 EndIndex = FMath::Min(StartIndex + GFrustumCullNumPrimitivesPerTask, NumPrimitives);
+		const int32 NumCulled = bVectorized
+			? FrustumCullRangeVectorized<UseCustomCulling>(Params, Arrays, StartIndex, EndIndex)
+			: FrustumCullRange<UseCustomCulling>(Params, Arrays, StartIndex, EndIndex);
+		FPlatformAtomics::InterlockedAdd(&NumCulledPrimitives, NumCulled);
+	}, bForceSingleThread);
+
+	return NumCulledPrimitives;
+}
+
 /**
  * Updated primitive fading states for the view.
  */
@@ -371,6 +547,9 @@ static int32 OcclusionCull(FRHICommandListImmediate& RHICmdList, const FScene* S
 		}
 	}
 
+	// Cull what the occluder meshes hide before any queries are issued for it
+	NumOccludedPrimitives += SoftwareOcclusionCull(Scene, View);
+
 	float CurrentRealTime = View.Family->CurrentRealTime;
 	if (ViewState)
 	{
@@ -2419,4 +2598,4 @@ void FLODSceneTree::PopulateHiddenFlags(FViewInfo& View, FSceneBitArray& HiddenF
 			}
 		}
 	}
-}
\ No newline at end of file
+}
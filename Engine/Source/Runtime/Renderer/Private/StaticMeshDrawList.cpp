@@ -0,0 +1,36 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	StaticMeshDrawList.cpp: Static mesh draw list settings shared by every drawing policy type.
+=============================================================================*/
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "ParallelFor.h"
+
+int32 GParallelSortStaticDrawLists = 1;
+static FAutoConsoleVariableRef CVarParallelSortStaticDrawLists(
+	TEXT("r.ParallelSortStaticDrawLists"),
+	GParallelSortStaticDrawLists,
+	TEXT("Whether to sort the static draw lists front to back on the task graph's worker threads.\n")
+	TEXT(" 0: on the rendering thread\n")
+	TEXT(" 1: on the worker threads (default)"),
+	ECVF_RenderThreadSafe
+	);
+
+int32 GMinStaticDrawsPerParallelCmdList = 64;
+static FAutoConsoleVariableRef CVarMinStaticDrawsPerParallelCmdList(
+	TEXT("r.MinStaticDrawsPerParallelCmdList"),
+	GMinStaticDrawsPerParallelCmdList,
+	TEXT("Fewest static meshes a draw list puts in one parallel command list, draw lists with fewer meshes use fewer command\n")
+	TEXT("lists than r.RHICmdWidth, since every command list costs time to set up, translate and submit. Default 64."),
+	ECVF_RenderThreadSafe
+	);
+
+void FStaticMeshDrawListBase::SortDrawListsFrontToBack(const TArray<FStaticMeshDrawListBase*, SceneRenderingAllocator>& DrawLists, FVector ViewPosition)
+{
+	ParallelFor(DrawLists.Num(), [&DrawLists, ViewPosition](int32 Index)
+	{
+		DrawLists[Index]->SortFrontToBack(ViewPosition);
+	}, !GParallelSortStaticDrawLists);
+}
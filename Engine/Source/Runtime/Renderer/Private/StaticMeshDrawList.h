@@ -7,11 +7,29 @@
 #ifndef __STATICMESHDRAWLIST_H__
 #define __STATICMESHDRAWLIST_H__
 
+/** Whether to sort static draw lists front to back on the task graph's worker threads, see r.ParallelSortStaticDrawLists. */
+extern int32 GParallelSortStaticDrawLists;
+
+/** Fewest mesh elements a draw list hands to one parallel command list, see r.MinStaticDrawsPerParallelCmdList. */
+extern int32 GMinStaticDrawsPerParallelCmdList;
+
 /** Base class of the static draw list, used when comparing draw lists and the drawing policy type is not necessary. */
 class FStaticMeshDrawListBase
 {
 public:
 
+	virtual ~FStaticMeshDrawListBase() {}
+
+	/** Sorts the draw list's drawing policies front to back. */
+	virtual void SortFrontToBack(FVector ViewPosition) = 0;
+
+	/**
+	 * Sorts a number of draw lists front to back, spread over the task graph's worker threads.
+	 * @param DrawLists - The draw lists to sort, each is only touched by one thread.
+	 * @param ViewPosition - The position to sort from.
+	 */
+	static void SortDrawListsFrontToBack(const TArray<FStaticMeshDrawListBase*, SceneRenderingAllocator>& DrawLists, FVector ViewPosition);
+
 	static SIZE_T TotalBytesUsed;
 };
 
@@ -329,8 +347,8 @@ public:
 		return DrawVisibleFrontToBack(RHICmdList, View, typename DrawingPolicyType::ContextDataType(), StaticMeshVisibilityMap, BatchVisibilityArray, MaxToDraw);
 	}
 
-	/** Sorts OrderedDrawingPolicies front to back. */
-	void SortFrontToBack(FVector ViewPosition);
+	/** Sorts OrderedDrawingPolicies front to back, accumulating the policies' bounds on the task graph's worker threads. */
+	virtual void SortFrontToBack(FVector ViewPosition);
 
 	/** Builds a list of primitives that use the given materials in this static draw list. */
 	void GetUsedPrimitivesBasedOnMaterials(ERHIFeatureLevel::Type FeatureLevel, const TArray<const FMaterial*>& Materials, TArray<FPrimitiveSceneInfo*>& PrimitivesToUpdate);
@@ -353,9 +371,6 @@ public:
 	// FRenderResource interface.
 	virtual void ReleaseRHI();
 
-	/** Sorts OrderedDrawingPolicies front to back.  Relies on static variables SortDrawingPolicySet and SortViewPosition being set. */
-	static int32 Compare(FSetElementId A, FSetElementId B);
-
 	/** Computes statistics for this draw list. */
 	FDrawListStats GetStats() const;
 
@@ -367,23 +382,24 @@ private:
 	/** All drawing policy element sets in the draw list, hashed by drawing policy. */
 	TDrawingPolicySet DrawingPolicySet;
 
-	/** 
-	 * Static variables for getting data into the Compare function.
-	 * Ideally Sort would accept a non-static member function which would avoid having to go through globals.
-	 */ 
-	static TDrawingPolicySet* SortDrawingPolicySet;
-	static FVector SortViewPosition;
-};
-
-/** Helper stuct for sorting */
-template<typename DrawingPolicyType>
-struct TCompareStaticMeshDrawList
-{
-	FORCEINLINE bool operator()( const FSetElementId& A, const FSetElementId& B ) const
+	/**
+	 * Orders drawing policies front to back by their cached bounding spheres.
+	 * Holds the set and the view position itself rather than going through globals, so that several draw lists of the same
+	 * type can be sorted at once on different threads.
+	 */
+	struct FCompareFrontToBack
 	{
-		// Use static Compare from TStaticMeshDrawList
-		return TStaticMeshDrawList<DrawingPolicyType>::Compare( A, B ) < 0;
-	}
+		const TDrawingPolicySet& DrawingPolicySet;
+		FVector ViewPosition;
+
+		FCompareFrontToBack(const TDrawingPolicySet& InDrawingPolicySet, FVector InViewPosition)
+			: DrawingPolicySet(InDrawingPolicySet)
+			, ViewPosition(InViewPosition)
+		{
+		}
+
+		bool operator()(const FSetElementId& A, const FSetElementId& B) const;
+	};
 };
 
 #include "StaticMeshDrawList.inl"
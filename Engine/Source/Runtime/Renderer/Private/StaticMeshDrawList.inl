@@ -8,6 +8,7 @@
 #define __STATICMESHDRAWLIST_INL__
 
 #include "RHICommandList.h"
+#include "ParallelFor.h"
 
 // Expensive
 #define PER_MESH_DRAW_STATS 0
@@ -345,6 +346,9 @@ public:
 
 	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 	{
+		// Divided by the static list draw calls, this is the CPU cost of a draw on the worker threads, e.g. against -nullrhi
+		SCOPE_CYCLE_COUNTER(STAT_StaticDrawListParallelDrawTime);
+
 		if (this->Caller.DrawVisibleInner(this->RHICmdList, this->View, this->PolicyContext, this->StaticMeshVisibilityMap, this->BatchVisibilityArray, this->FirstPolicy, this->LastPolicy))
 		{
 			this->OutDirty = true;
@@ -361,35 +365,44 @@ void TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleParallel(
 	FParallelCommandListSet& ParallelCommandListSet
 	)
 {
+	const int32 NumPolicies = OrderedDrawingPolicies.Num();
+	if (!NumPolicies)
+	{
+		return;
+	}
 
-	int32 EffectiveThreads = FMath::Min<int32>(OrderedDrawingPolicies.Num(), ParallelCommandListSet.Width);
+	// Split the policies by the number of meshes they hold rather than by count, a policy may hold one mesh or thousands.
+	// Small lists get fewer command lists, each of which has a fixed cost to set up, translate and submit.
+	int32 NumElements = 0;
+	for (int32 Index = 0; Index < NumPolicies; Index++)
+	{
+		NumElements += DrawingPolicySet[OrderedDrawingPolicies[Index]].Elements.Num();
+	}
+	const int32 MaxCmdLists = FMath::Max(ParallelCommandListSet.Width, 1);
+	const int32 NumCmdLists = FMath::Clamp(NumElements / FMath::Max(GMinStaticDrawsPerParallelCmdList, 1), 1, MaxCmdLists);
+	const int32 NumElementsPerCmdList = FMath::DivideAndRoundUp(FMath::Max(NumElements, 1), NumCmdLists);
 
 	int32 Start = 0;
-	if (EffectiveThreads)
+	int32 NumElementsInCmdList = 0;
+	for (int32 Index = 0; Index < NumPolicies; Index++)
 	{
-
-		int32 NumPer = OrderedDrawingPolicies.Num() / EffectiveThreads;
-		int32 Extra = OrderedDrawingPolicies.Num() - NumPer * EffectiveThreads;
-
-
-		for (int32 ThreadIndex = 0; ThreadIndex < EffectiveThreads; ThreadIndex++)
+		NumElementsInCmdList += DrawingPolicySet[OrderedDrawingPolicies[Index]].Elements.Num();
+		if (NumElementsInCmdList >= NumElementsPerCmdList || Index == NumPolicies - 1)
 		{
-			int32 Last = Start + (NumPer - 1) + (ThreadIndex < Extra);
-			check(Last >= Start);
+			const int32 Last = Index;
 
-			{
-				FRHICommandList* CmdList = ParallelCommandListSet.NewParallelCommandList();
+			FRHICommandList* CmdList = ParallelCommandListSet.NewParallelCommandList();
 
-				FGraphEventRef AnyThreadCompletionEvent = TGraphTask<FDrawVisibleAnyThreadTask<DrawingPolicyType> >::CreateTask(nullptr, ENamedThreads::RenderThread)
-					.ConstructAndDispatchWhenReady(*this, *CmdList, ParallelCommandListSet.View, PolicyContext, StaticMeshVisibilityMap, BatchVisibilityArray, Start, Last, ParallelCommandListSet.OutDirty);
+			FGraphEventRef AnyThreadCompletionEvent = TGraphTask<FDrawVisibleAnyThreadTask<DrawingPolicyType> >::CreateTask(nullptr, ENamedThreads::RenderThread)
+				.ConstructAndDispatchWhenReady(*this, *CmdList, ParallelCommandListSet.View, PolicyContext, StaticMeshVisibilityMap, BatchVisibilityArray, Start, Last, ParallelCommandListSet.OutDirty);
 
-				ParallelCommandListSet.AddParallelCommandList(CmdList, AnyThreadCompletionEvent);
-			}
+			ParallelCommandListSet.AddParallelCommandList(CmdList, AnyThreadCompletionEvent);
 
 			Start = Last + 1;
+			NumElementsInCmdList = 0;
 		}
 	}
-	check(Start == OrderedDrawingPolicies.Num());
+	check(Start == NumPolicies);
 }
 
 template<typename DrawingPolicyType>
@@ -456,60 +469,44 @@ int32 TStaticMeshDrawList<DrawingPolicyType>::DrawVisibleFrontToBack(
 }
 
 template<typename DrawingPolicyType>
-FVector TStaticMeshDrawList<DrawingPolicyType>::SortViewPosition = FVector(0);
-
-template<typename DrawingPolicyType>
-typename TStaticMeshDrawList<DrawingPolicyType>::TDrawingPolicySet* TStaticMeshDrawList<DrawingPolicyType>::SortDrawingPolicySet;
-
-template<typename DrawingPolicyType>
-int32 TStaticMeshDrawList<DrawingPolicyType>::Compare(FSetElementId A, FSetElementId B)
+bool TStaticMeshDrawList<DrawingPolicyType>::FCompareFrontToBack::operator()(const FSetElementId& A, const FSetElementId& B) const
 {
-	const FSphere& BoundsA = (*SortDrawingPolicySet)[A].CachedBoundingSphere;
-	const FSphere& BoundsB = (*SortDrawingPolicySet)[B].CachedBoundingSphere;
+	const FSphere& BoundsA = DrawingPolicySet[A].CachedBoundingSphere;
+	const FSphere& BoundsB = DrawingPolicySet[B].CachedBoundingSphere;
 
 	// Assume state buckets with large bounds are background geometry
-	if (BoundsA.W >= HALF_WORLD_MAX / 2 && BoundsB.W < HALF_WORLD_MAX / 2)
-	{
-		return 1;
-	}
-	else if (BoundsB.W >= HALF_WORLD_MAX / 2 && BoundsA.W < HALF_WORLD_MAX / 2)
+	const bool bBackgroundA = BoundsA.W >= HALF_WORLD_MAX / 2;
+	const bool bBackgroundB = BoundsB.W >= HALF_WORLD_MAX / 2;
+	if (bBackgroundA != bBackgroundB)
 	{
-		return -1;
-	}
-	else
-	{
-		const float DistanceASquared = (BoundsA.Center - SortViewPosition).SizeSquared();
-		const float DistanceBSquared = (BoundsB.Center - SortViewPosition).SizeSquared();
-		// Sort front to back
-		return DistanceASquared > DistanceBSquared ? 1 : -1;
+		return bBackgroundB;
 	}
+
+	// Sort front to back
+	return (BoundsA.Center - ViewPosition).SizeSquared() < (BoundsB.Center - ViewPosition).SizeSquared();
 }
 
 template<typename DrawingPolicyType>
 void TStaticMeshDrawList<DrawingPolicyType>::SortFrontToBack(FVector ViewPosition)
 {
-	// Cache policy link bounds
-	for (typename TDrawingPolicySet::TIterator DrawingPolicyIt(DrawingPolicySet); DrawingPolicyIt; ++DrawingPolicyIt)
+	// Cache policy link bounds, which walks every element, so spread the policies over the worker threads
+	ParallelFor(OrderedDrawingPolicies.Num(), [this](int32 Index)
 	{
+		FDrawingPolicyLink& DrawingPolicyLink = DrawingPolicySet[OrderedDrawingPolicies[Index]];
 		FBoxSphereBounds AccumulatedBounds(ForceInit);
 
-		FDrawingPolicyLink& DrawingPolicyLink = *DrawingPolicyIt;
 		if (DrawingPolicyLink.Elements.Num())
 		{
 			AccumulatedBounds = DrawingPolicyLink.Elements[0].Bounds;
 			for (int32 ElementIndex = 1; ElementIndex < DrawingPolicyLink.Elements.Num(); ElementIndex++)
-		    {
-		        FElement& Element = DrawingPolicyLink.Elements[ElementIndex];
-		        AccumulatedBounds = AccumulatedBounds + Element.Bounds;
-		    }
+			{
+				AccumulatedBounds = AccumulatedBounds + DrawingPolicyLink.Elements[ElementIndex].Bounds;
+			}
 		}
-		DrawingPolicyIt->CachedBoundingSphere = AccumulatedBounds.GetSphere();
-	}
-
-	SortViewPosition = ViewPosition;
-	SortDrawingPolicySet = &DrawingPolicySet;
+		DrawingPolicyLink.CachedBoundingSphere = AccumulatedBounds.GetSphere();
+	}, !GParallelSortStaticDrawLists);
 
-	OrderedDrawingPolicies.Sort( TCompareStaticMeshDrawList<DrawingPolicyType>() );
+	OrderedDrawingPolicies.Sort(FCompareFrontToBack(DrawingPolicySet, ViewPosition));
 }
 
 template<typename DrawingPolicyType>
@@ -0,0 +1,95 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "SceneFrustumCull.h"
+#include "AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFrustumCullTest, "Renderer.FrustumCull", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FFrustumCullTest::RunTest(const FString& Parameters)
+{
+	FMemMark Mark(FMemStack::Get());
+	FRandomStream RandomStream(0x1ce);
+
+	// Looking down +X from the origin with a 90 degree field of view, up to 2000 units away
+	TArray<FPlane, TInlineAllocator<6>> Planes;
+	Planes.Add(FPlane(FVector(-1, 0, 0), 0));
+	Planes.Add(FPlane(FVector(1, 0, 0), 2000));
+	Planes.Add(FPlane(FVector(-1, 1, 0).GetSafeNormal(), 0));
+	Planes.Add(FPlane(FVector(-1, -1, 0).GetSafeNormal(), 0));
+	Planes.Add(FPlane(FVector(-1, 0, 1).GetSafeNormal(), 0));
+	Planes.Add(FPlane(FVector(-1, 0, -1).GetSafeNormal(), 0));
+	const FConvexVolume ViewFrustum(Planes);
+	const FFrustumCullParams Params(ViewFrustum, FVector::ZeroVector, 100.0f);
+
+	// Two full words of the visibility maps and a last word that ends in a partial packet
+	const int32 NumPrimitives = 2 * NumBitsPerDWORD + FPrimitiveCullingBounds::PrimitivesPerPacket + 3;
+	TArray<FPrimitiveBounds> PrimitiveBounds;
+	FPrimitiveCullingBounds PrimitiveCullingBounds;
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < NumPrimitives; PrimitiveIndex++)
+	{
+		FPrimitiveBounds Bounds;
+		Bounds.Origin = FVector(RandomStream.FRandRange(-500, 2500), RandomStream.FRandRange(-2000, 2000), RandomStream.FRandRange(-2000, 2000));
+		Bounds.BoxExtent = FVector(RandomStream.FRandRange(1, 200), RandomStream.FRandRange(1, 200), RandomStream.FRandRange(1, 200));
+		Bounds.SphereRadius = Bounds.BoxExtent.Size() * RandomStream.FRandRange(0.5f, 1.0f);
+		Bounds.MinDrawDistanceSq = RandomStream.FRand() < 0.25f ? FMath::Square(RandomStream.FRandRange(0, 1000)) : 0.0f;
+		Bounds.MaxDrawDistance = RandomStream.FRand() < 0.5f ? RandomStream.FRandRange(100, 2500) : FLT_MAX;
+		PrimitiveBounds.Add(Bounds);
+		PrimitiveCullingBounds.AddUninitialized();
+		PrimitiveCullingBounds.Set(PrimitiveIndex, Bounds);
+	}
+
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		// The second pass culls what is left after removing primitives like FScene::RemovePrimitiveSceneInfo does
+		if (Pass == 1)
+		{
+			const int32 IndicesToRemove[] = { 0, 5, NumBitsPerDWORD + 1, 17, 3 };
+			for (int32 Index = 0; Index < ARRAY_COUNT(IndicesToRemove); Index++)
+			{
+				PrimitiveBounds.RemoveAtSwap(IndicesToRemove[Index]);
+				PrimitiveCullingBounds.RemoveAtSwap(IndicesToRemove[Index]);
+			}
+		}
+		const int32 NumLeft = PrimitiveBounds.Num();
+		const TCHAR* PassName = Pass == 0 ? TEXT("as added") : TEXT("after RemoveAtSwap");
+
+		FSceneBitArray VisibilityMaps[2];
+		FSceneBitArray FadingMaps[2];
+		int32 NumCulled[2];
+		for (int32 Vectorized = 0; Vectorized < 2; Vectorized++)
+		{
+			VisibilityMaps[Vectorized].Init(false, NumLeft);
+			FadingMaps[Vectorized].Init(false, NumLeft);
+			const FFrustumCullArrays Arrays(PrimitiveBounds, PrimitiveCullingBounds, VisibilityMaps[Vectorized], FadingMaps[Vectorized]);
+
+			// Ranges start on word boundaries, like the tasks of FrustumCull
+			NumCulled[Vectorized] = 0;
+			for (int32 StartIndex = 0; StartIndex < NumLeft; StartIndex += NumBitsPerDWORD)
+			{
+				const int32 EndIndex = FMath::Min(StartIndex + NumBitsPerDWORD, NumLeft);
+				NumCulled[Vectorized] += Vectorized
+					? FrustumCullRangeVectorized<false>(Params, Arrays, StartIndex, EndIndex)
+					: FrustumCullRange<false>(Params, Arrays, StartIndex, EndIndex);
+			}
+		}
+
+		int32 NumVisible = 0;
+		int32 NumVisibilityMismatches = 0;
+		int32 NumFadingMismatches = 0;
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < NumLeft; PrimitiveIndex++)
+		{
+			NumVisible += VisibilityMaps[0][PrimitiveIndex] ? 1 : 0;
+			NumVisibilityMismatches += VisibilityMaps[0][PrimitiveIndex] != VisibilityMaps[1][PrimitiveIndex] ? 1 : 0;
+			NumFadingMismatches += FadingMaps[0][PrimitiveIndex] != FadingMaps[1][PrimitiveIndex] ? 1 : 0;
+		}
+
+		TestTrue(FString::Printf(TEXT("Some primitives are culled and some are visible (%s)"), PassName), NumCulled[0] > 0 && NumVisible > 0);
+		TestEqual(FString::Printf(TEXT("Vectorized culling culls as many primitives (%s)"), PassName), NumCulled[1], NumCulled[0]);
+		TestEqual(FString::Printf(TEXT("Vectorized culling gives the same visibility map (%s)"), PassName), NumVisibilityMismatches, 0);
+		TestEqual(FString::Printf(TEXT("Vectorized culling gives the same fading map (%s)"), PassName), NumFadingMismatches, 0);
+	}
+
+	return true;
+}
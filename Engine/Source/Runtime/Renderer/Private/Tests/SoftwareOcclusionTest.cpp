@@ -0,0 +1,107 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "RendererPrivate.h"
+#include "ScenePrivate.h"
+#include "SceneSoftwareOcclusion.h"
+#include "AutomationTest.h"
+
+/**
+ * Draws a square into a software occlusion buffer through a 90 degree perspective, looking down +Z from the origin, and checks
+ * which boxes it hides. The square is 100 units wide at Z = 100, so it covers the middle half of the screen.
+ */
+namespace SoftwareOcclusionTest
+{
+	const int32 BufferSize = 64;
+	const float NearW = 10.0f;
+
+	/** Draws a square of half size HalfSize at depth Z, as two triangles wound either way, with or without their adjacency. */
+	void DrawSquare(FSoftwareOcclusionBuffer& Buffer, const FMatrix& ViewToClip, float HalfSize, float Z, bool bReverseWinding, bool bAdjacency = true)
+	{
+		FOccluderMeshData Mesh;
+		Mesh.Vertices.Add(FVector(-HalfSize, -HalfSize, Z));
+		Mesh.Vertices.Add(FVector(HalfSize, -HalfSize, Z));
+		Mesh.Vertices.Add(FVector(HalfSize, HalfSize, Z));
+		Mesh.Vertices.Add(FVector(-HalfSize, HalfSize, Z));
+		const uint32 Indices[6] = { 0, 1, 2, 0, 2, 3 };
+		const uint32 ReversedIndices[6] = { 0, 2, 1, 0, 3, 2 };
+		Mesh.Indices.Append(bReverseWinding ? ReversedIndices : Indices, 6);
+		if (bAdjacency)
+		{
+			Mesh.BuildAdjacency();
+		}
+		Buffer.DrawMesh(ViewToClip, Mesh.Vertices.GetData(), Mesh.Vertices.Num(), Mesh.Indices.GetData(), Mesh.Indices.Num(), Mesh.AdjacentTriangles.GetData());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSoftwareOcclusionTest, "Renderer.SoftwareOcclusion", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+bool FSoftwareOcclusionTest::RunTest(const FString& Parameters)
+{
+	using namespace SoftwareOcclusionTest;
+
+	const FMatrix ViewToClip = FReversedZPerspectiveMatrix(PI / 4.0f, 1.0f, 1.0f, NearW);
+
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		const bool bReverseWinding = Pass == 1;
+		FSoftwareOcclusionBuffer Buffer(BufferSize, BufferSize, NearW);
+		DrawSquare(Buffer, ViewToClip, 50.0f, 100.0f, bReverseWinding);
+
+		const TCHAR* Winding = bReverseWinding ? TEXT("reversed") : TEXT("forward");
+		TestTrue(FString::Printf(TEXT("The middle of the square is drawn at 1 / W (%s winding)"), Winding),
+			FMath::IsNearlyEqual(Buffer.GetDepth(BufferSize / 2, BufferSize / 2), 0.01f, 0.0001f));
+		TestEqual(FString::Printf(TEXT("Nothing is drawn outside of the square (%s winding)"), Winding), Buffer.GetDepth(2, 2), 0.0f);
+
+		TestTrue(TEXT("A box behind the square is occluded"), Buffer.IsBoxOccluded(ViewToClip, FVector(0, 0, 200), FVector(10, 10, 10)));
+		TestFalse(TEXT("A box in front of the square isn't occluded"), Buffer.IsBoxOccluded(ViewToClip, FVector(0, 0, 50), FVector(5, 5, 5)));
+		TestFalse(TEXT("A box through the square isn't occluded"), Buffer.IsBoxOccluded(ViewToClip, FVector(0, 0, 100), FVector(10, 10, 10)));
+		TestFalse(TEXT("A box peeking out from behind the square isn't occluded"), Buffer.IsBoxOccluded(ViewToClip, FVector(90, 0, 200), FVector(10, 10, 10)));
+		TestFalse(TEXT("A box reaching the near plane isn't occluded"), Buffer.IsBoxOccluded(ViewToClip, FVector(0, 0, 12), FVector(5, 5, 5)));
+	}
+
+	// Pixels the square only partly covers aren't drawn, even where it covers their centers. Its edges are 0.64 pixels into the
+	// pixels next to the middle half of the screen
+	{
+		FSoftwareOcclusionBuffer Buffer(BufferSize, BufferSize, NearW);
+		DrawSquare(Buffer, ViewToClip, 52.0f, 100.0f, false);
+
+		TestTrue(TEXT("A pixel entirely inside the square is drawn"), Buffer.GetDepth(BufferSize / 4, BufferSize * 3 / 8) > 0.0f);
+		TestEqual(TEXT("A pixel partly inside the square isn't drawn"), Buffer.GetDepth(BufferSize / 4 - 1, BufferSize * 3 / 8), 0.0f);
+		TestTrue(TEXT("The pixels along the diagonal the triangles share are drawn"), Buffer.GetDepth(BufferSize / 2 - 1, BufferSize / 2) > 0.0f);
+	}
+
+	// Without adjacency, the pixels along the shared diagonal are left out too
+	{
+		FSoftwareOcclusionBuffer Buffer(BufferSize, BufferSize, NearW);
+		DrawSquare(Buffer, ViewToClip, 52.0f, 100.0f, false, false);
+
+		TestEqual(TEXT("The pixels along the diagonal aren't drawn without adjacency"), Buffer.GetDepth(BufferSize / 2 - 1, BufferSize / 2), 0.0f);
+		TestTrue(TEXT("The inside of the triangles is drawn without adjacency"), Buffer.GetDepth(BufferSize / 4, BufferSize * 3 / 8) > 0.0f);
+	}
+
+	// A square reaching behind the viewer is clipped at the near plane rather than drawn inverted
+	{
+		FSoftwareOcclusionBuffer Buffer(BufferSize, BufferSize, NearW);
+		const FVector Vertices[4] =
+		{
+			FVector(-1000, -50, -100),
+			FVector(1000, -50, -100),
+			FVector(1000, -50, 1000),
+			FVector(-1000, -50, 1000),
+		};
+		const uint32 Indices[6] = { 0, 1, 2, 0, 2, 3 };
+		Buffer.DrawMesh(ViewToClip, Vertices, 4, Indices, 6);
+
+		bool bDrawnAboveHorizon = false;
+		bool bDrawnBelowHorizon = false;
+		for (int32 X = 0; X < BufferSize; X++)
+		{
+			bDrawnAboveHorizon |= Buffer.GetDepth(X, 0) > 0.0f;
+			bDrawnBelowHorizon |= Buffer.GetDepth(X, BufferSize - 1) > 0.0f;
+		}
+		TestFalse(TEXT("A floor clipped at the near plane isn't drawn above the horizon"), bDrawnAboveHorizon);
+		TestTrue(TEXT("A floor clipped at the near plane is drawn below the horizon"), bDrawnBelowHorizon);
+	}
+
+	return true;
+}
@@ -458,6 +458,9 @@ public:
 
 	/** test primitive visiblity */
 	virtual bool IsVisible(int32 VisibilityId, const FBoxSphereBounds& Bounds) = 0;
+
+	/** whether IsVisible may be called from several threads at once, otherwise frustum culling calls it from one thread */
+	virtual bool IsThreadsafe() const { return false; }
 };
 
 class ICustomCulling
@@ -393,6 +393,16 @@ public:
 		return LowerLevel->OpenWrite( *ConvertToSandboxPath( Filename ), bAppend, bAllowRead );
 	}
 
+	virtual IMappedFileHandle*	OpenMapped(const TCHAR* Filename) override
+	{
+		IMappedFileHandle* Result = LowerLevel->OpenMapped( *ConvertToSandboxPath( Filename ) );
+		if( !Result && OkForInnerAccess(Filename) )
+		{
+			Result = LowerLevel->OpenMapped( Filename );
+		}
+		return Result;
+	}
+
 	virtual bool		DirectoryExists(const TCHAR* Directory) override
 	{
 		bool Result = LowerLevel->DirectoryExists( *ConvertToSandboxPath( Directory ) );
@@ -193,6 +193,111 @@ bool FSocketBSD::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketRe
 }
 
 
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_RECVMMSG
+
+/** Max number of datagrams passed to one sendmmsg/recvmmsg call, larger batches are split. */
+static const int32 MaxDatagramsPerCall = 64;
+
+
+bool FSocketBSD::SendToMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumSent)
+{
+	mmsghdr Messages[MaxDatagramsPerCall];
+	iovec Buffers[MaxDatagramsPerCall];
+
+	NumSent = 0;
+	while (NumSent < NumDatagrams)
+	{
+		const int32 NumInCall = FMath::Min(NumDatagrams - NumSent, MaxDatagramsPerCall);
+		FMemory::Memzero(Messages, sizeof(mmsghdr) * NumInCall);
+
+		for (int32 Index = 0; Index < NumInCall; Index++)
+		{
+			FSocketDatagram& Datagram = Datagrams[NumSent + Index];
+			Buffers[Index].iov_base = Datagram.Data;
+			Buffers[Index].iov_len = Datagram.Count;
+			Messages[Index].msg_hdr.msg_name = (sockaddr*)(FInternetAddrBSD&)*Datagram.Address;
+			Messages[Index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			Messages[Index].msg_hdr.msg_iov = &Buffers[Index];
+			Messages[Index].msg_hdr.msg_iovlen = 1;
+		}
+
+		const int32 NumSentInCall = sendmmsg(Socket, Messages, NumInCall, 0);
+		if (NumSentInCall <= 0)
+		{
+			break;
+		}
+
+		for (int32 Index = 0; Index < NumSentInCall; Index++)
+		{
+			Datagrams[NumSent + Index].BytesTransferred = Messages[Index].msg_len;
+		}
+		NumSent += NumSentInCall;
+
+		if (NumSentInCall < NumInCall)
+		{
+			// The next datagram failed, let the caller see its error
+			break;
+		}
+	}
+
+	bool Result = NumSent > 0 || NumDatagrams == 0;
+	if (NumSent > 0)
+	{
+		LastActivityTime = FDateTime::UtcNow();
+	}
+	return Result;
+}
+
+
+bool FSocketBSD::RecvFromMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumRead)
+{
+	mmsghdr Messages[MaxDatagramsPerCall];
+	iovec Buffers[MaxDatagramsPerCall];
+
+	bool Result = true;
+	NumRead = 0;
+	while (NumRead < NumDatagrams)
+	{
+		const int32 NumInCall = FMath::Min(NumDatagrams - NumRead, MaxDatagramsPerCall);
+		FMemory::Memzero(Messages, sizeof(mmsghdr) * NumInCall);
+
+		for (int32 Index = 0; Index < NumInCall; Index++)
+		{
+			FSocketDatagram& Datagram = Datagrams[NumRead + Index];
+			Buffers[Index].iov_base = Datagram.Data;
+			Buffers[Index].iov_len = Datagram.Count;
+			Messages[Index].msg_hdr.msg_name = (sockaddr*)(FInternetAddrBSD&)*Datagram.Address;
+			Messages[Index].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			Messages[Index].msg_hdr.msg_iov = &Buffers[Index];
+			Messages[Index].msg_hdr.msg_iovlen = 1;
+		}
+
+		// Don't wait for the batch to fill up, only take what is already there. An error hit after the first datagram
+		// is returned by the next call, so keep going until a call fails rather than stopping at a short batch.
+		const int32 NumReadInCall = recvmmsg(Socket, Messages, NumInCall, MSG_DONTWAIT, nullptr);
+		if (NumReadInCall <= 0)
+		{
+			Result = false;
+			break;
+		}
+
+		for (int32 Index = 0; Index < NumReadInCall; Index++)
+		{
+			Datagrams[NumRead + Index].BytesTransferred = Messages[Index].msg_len;
+		}
+		NumRead += NumReadInCall;
+	}
+
+	if (NumRead > 0)
+	{
+		LastActivityTime = FDateTime::UtcNow();
+	}
+	return Result;
+}
+
+#endif	//PLATFORM_HAS_BSD_SOCKET_FEATURE_RECVMMSG
+
+
 bool FSocketBSD::Wait(ESocketWaitConditions::Type Condition, FTimespan WaitTime)
 {
 	if ((Condition == ESocketWaitConditions::WaitForRead) || (Condition == ESocketWaitConditions::WaitForReadOrWrite))
@@ -91,6 +91,10 @@ public:
 	virtual bool Send(const uint8* Data, int32 Count, int32& BytesSent) override;
 	virtual bool RecvFrom(uint8* Data, int32 BufferSize, int32& BytesRead, FInternetAddr& Source, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None) override;
 	virtual bool Recv(uint8* Data,int32 BufferSize,int32& BytesRead, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None) override;
+#if PLATFORM_HAS_BSD_SOCKET_FEATURE_RECVMMSG
+	virtual bool SendToMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumSent) override;
+	virtual bool RecvFromMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumRead) override;
+#endif
 	virtual bool Wait(ESocketWaitConditions::Type Condition, FTimespan WaitTime) override;
 	virtual ESocketConnectionState GetConnectionState() override;
 	virtual void GetAddress(FInternetAddr& OutAddr) override;
@@ -41,4 +41,33 @@ bool FSocket::Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketRecei
 		UE_LOG(LogSockets, Verbose, TEXT("Socket '%s' Recv %i Bytes"), *SocketDescription, BytesRead );
 	}
 	return true;
-}
\ No newline at end of file
+}
+
+
+bool FSocket::SendToMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumSent)
+{
+	for (NumSent = 0; NumSent < NumDatagrams; NumSent++)
+	{
+		FSocketDatagram& Datagram = Datagrams[NumSent];
+		if (!SendTo(Datagram.Data, Datagram.Count, Datagram.BytesTransferred, *Datagram.Address))
+		{
+			break;
+		}
+	}
+	return NumSent > 0 || NumDatagrams == 0;
+}
+
+
+bool FSocket::RecvFromMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumRead)
+{
+	for (NumRead = 0; NumRead < NumDatagrams; NumRead++)
+	{
+		FSocketDatagram& Datagram = Datagrams[NumRead];
+		if (!RecvFrom(Datagram.Data, Datagram.Count, Datagram.BytesTransferred, *Datagram.Address))
+		{
+			// Don't lose the error, the datagrams read so far are still reported through NumRead
+			return false;
+		}
+	}
+	return true;
+}
@@ -6,6 +6,21 @@
 #include "IPAddress.h"
 #include "SocketTypes.h"
 
+/**
+ * A datagram for FSocket::SendToMulti and FSocket::RecvFromMulti
+ */
+struct FSocketDatagram
+{
+	/** The data to send, or the buffer to read into */
+	uint8* Data;
+	/** The size of the data to send, or the max size of the buffer */
+	int32 Count;
+	/** Out param indicating how much was sent or read */
+	int32 BytesTransferred;
+	/** The network byte ordered address to send to, or receiving the address of the sender */
+	FInternetAddr* Address;
+};
+
 /**
  * This is our abstract base class that hides the platform specific socket implementation
  */
@@ -155,6 +170,29 @@ public:
 	 */
 	virtual bool Recv(uint8* Data, int32 BufferSize, int32& BytesRead, ESocketReceiveFlags::Type Flags = ESocketReceiveFlags::None);
 
+	/**
+	 * Sends several datagrams, with as few system calls as the platform allows. Stops at the first datagram that can't be sent.
+	 *
+	 * @param Datagrams the datagrams to send, their BytesTransferred is filled in
+	 * @param NumDatagrams the number of datagrams to send
+	 * @param NumSent out param indicating how many datagrams were sent
+	 * @return false if not even the first datagram could be sent
+	 */
+	virtual bool SendToMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumSent);
+
+	/**
+	 * Reads the datagrams that are waiting on the socket, up to NumDatagrams, with as few system calls as the platform allows.
+	 * Only makes sense for non-blocking sockets. Callers should keep calling until it returns false, and handle the NumRead
+	 * datagrams that were read before looking at the error.
+	 *
+	 * @param Datagrams the buffers to read into, their BytesTransferred and Address are filled in
+	 * @param NumDatagrams the number of buffers
+	 * @param NumRead out param indicating how many datagrams were read, also when returning false
+	 * @return false if reading stopped before all of the buffers were filled, the socket subsystem's last error code tells
+	 *         why (SE_EWOULDBLOCK once no more datagrams are waiting)
+	 */
+	virtual bool RecvFromMulti(FSocketDatagram* Datagrams, int32 NumDatagrams, int32& NumRead);
+
 	/**
 	 * Blocks until the specified condition is met.
 	 *